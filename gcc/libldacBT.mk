@@ -21,6 +21,8 @@ CCOPTIONS	+= -Wno-long-long
 #CCOPTIONS	+= -ansi
 #CCOPTIONS	+= -pedantic
 #CCOPTIONS	+= -pedantic-errors
+#CCOPTIONS	+= -msse4.1
+#CCOPTIONS	+= -mavx2
 CCOPTIONS	+= -fPIC -fno-merge-constants
 
 ifeq ($(FIXED_POINT), TRUE)
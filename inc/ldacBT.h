@@ -366,6 +366,154 @@ LDACBT_API int  ldacBT_get_eqmid( HANDLE_LDAC_BT hLdacBt );
 #define LDACBT_EQMID_INC_CONNECTION -1
 LDACBT_API int  ldacBT_alter_eqmid_priority( HANDLE_LDAC_BT hLdacBt, int priority );
 
+/* Configuration of encoder complexity level.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_encode() prior to
+ * calling this function. The level trades the CPU load of encoding against the quality of bit
+ * allocation, without changing bit rate or bitstream syntax.
+ * Configurable values for "level" are shown below.
+ *   - LDACBT_COMPLEXITY_FAST       : Searches 3 of 8 scale factor weighting tables, skips the
+ *                                    refinement steps of bit allocation once 6 cost calculations
+ *                                    are spent, starts bit allocation from the result of the
+ *                                    previous frame (see ldacBT_set_warm_start()) and analyzes
+ *                                    frame status every 4 frames.
+ *   - LDACBT_COMPLEXITY_DEFAULT    : Full search as in the initial state.
+ *   - LDACBT_COMPLEXITY_EXHAUSTIVE : Full search, then also tries up to 3 higher offsets of the
+ *                                    gradient curve and keeps the one that fills the frame most.
+ * The level is reset to LDACBT_COMPLEXITY_DEFAULT by ldacBT_init_handle_encode().
+ * The API function can be called at any time, after the completion of initializing.
+ *  Format
+ *      int  ldacBT_set_complexity( HANDLE_LDAC_BT hLdacBt, int level );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      level      int               Encoder complexity level.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_COMPLEXITY_FAST       0
+#define LDACBT_COMPLEXITY_DEFAULT    1
+#define LDACBT_COMPLEXITY_EXHAUSTIVE 2
+LDACBT_API int  ldacBT_set_complexity( HANDLE_LDAC_BT hLdacBt, int level );
+
+/* Get current encoder complexity level.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_encode() prior to
+ * calling this function. While the deadline governor is active, the level in use may be lower
+ * than the level configured by ldacBT_set_complexity().
+ *  Format
+ *      int  ldacBT_get_complexity( HANDLE_LDAC_BT hLdacBt );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *  Return value
+ *      int : Encoder complexity level for success, -1 for failure.
+ */
+LDACBT_API int  ldacBT_get_complexity( HANDLE_LDAC_BT hLdacBt );
+
+/* Configuration of deadline governor for encoder complexity level.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_encode() prior to
+ * calling this function.
+ * The governor measures the encoding time of every frame in ldacBT_encode() with "clock_func",
+ * which must return a monotonic time in microseconds ("p_ctx" is passed through). When the
+ * average encoding time exceeds "load" percent of the frame period (frame samples / sampling
+ * frequency), the complexity level is lowered by one step. When it stays below half of that
+ * for 64 frames, the level is raised by one step up to the level configured by
+ * ldacBT_set_complexity(). The level in use can be read by ldacBT_get_complexity().
+ * Setting "clock_func" to NULL disables the governor and restores the configured level.
+ * The governor is disabled by ldacBT_init_handle_encode().
+ *  Format
+ *      int  ldacBT_set_deadline_governor( HANDLE_LDAC_BT hLdacBt, LDACBT_CLOCK_FUNC clock_func,
+ *                                         void *p_ctx, int load );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      clock_func LDACBT_CLOCK_FUNC Monotonic clock function. Unit:us.
+ *      p_ctx      void *            Argument for clock_func.
+ *      load       int               Allowed encoding time in percent of frame period. (1-100)
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+typedef unsigned int (*LDACBT_CLOCK_FUNC)( void *p_ctx );
+LDACBT_API int  ldacBT_set_deadline_governor( HANDLE_LDAC_BT hLdacBt, LDACBT_CLOCK_FUNC clock_func,
+                                              void *p_ctx, int load );
+
+/* Configuration of callback for signal analysis features of encoded frames.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_encode() prior to
+ * calling this function.
+ * "feature_func" is called from ldacBT_encode() for every LDAC frame encoded from input PCM, with
+ * the features the encoder computed for the frame ("p_ctx" is passed through). The structure is
+ * held in the LDAC handle and is valid only during the call.
+ * The members of LDACBT_FRAME_FEATURES are shown below. Array members are per channel.
+ *   - frame_status   : Frame status used for bit allocation. 0 for normal frames, and 1 to 3
+ *                      for frames with lower energy.
+ *   - nch            : Number of channels.
+ *   - a_low_energy   : Energy of low band pseudo spectrum. Q15.
+ *   - a_centroid     : Centroid of pseudo spectrum in spectral lines. Q15.
+ *   - a_zero_cross   : Number of zero crosses in the current and previous frame of input.
+ *   - a_nqus         : Number of quantization units.
+ *   - aa_idsf        : Scale factor index of each quantization unit. (one step per 6dB)
+ * Frame status, low band energy and centroid are updated every frame, except at
+ * LDACBT_COMPLEXITY_FAST where they are updated every 4 frames.
+ * Setting "feature_func" to NULL disables the callback.
+ * The callback is disabled by ldacBT_init_handle_encode().
+ *  Format
+ *      int  ldacBT_set_feature_callback( HANDLE_LDAC_BT hLdacBt, LDACBT_FEATURE_FUNC feature_func,
+ *                                        void *p_ctx );
+ *  Arguments
+ *      hLdacBt      HANDLE_LDAC_BT      LDAC handle.
+ *      feature_func LDACBT_FEATURE_FUNC Callback function.
+ *      p_ctx        void *              Argument for feature_func.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_MAX_NQUS 34
+typedef struct _ldacbt_frame_features {
+    int frame_status;
+    int nch;
+    int a_low_energy[2];
+    int a_centroid[2];
+    int a_zero_cross[2];
+    int a_nqus[2];
+    int aa_idsf[2][LDACBT_MAX_NQUS];
+} LDACBT_FRAME_FEATURES;
+typedef void (*LDACBT_FEATURE_FUNC)( void *p_ctx, const LDACBT_FRAME_FEATURES *p_features );
+LDACBT_API int  ldacBT_set_feature_callback( HANDLE_LDAC_BT hLdacBt, LDACBT_FEATURE_FUNC feature_func,
+                                             void *p_ctx );
+
+/* Configuration of encoder packing mode.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_encode() prior to
+ * calling this function. Both modes output identical bitstreams.
+ * Configurable values for "mode" are shown below.
+ *   - LDACBT_PACKMODE_REFERENCE : Quantizes the whole spectrum of a frame, then packs it.
+ *   - LDACBT_PACKMODE_FUSED     : Quantizes each quantization unit while packing it, without
+ *                                 storing the quantized spectrum.
+ * The mode is reset to LDACBT_PACKMODE_FUSED by ldacBT_init_handle_encode().
+ *  Format
+ *      int  ldacBT_set_pack_mode( HANDLE_LDAC_BT hLdacBt, int mode );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      mode       int               Encoder packing mode.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_PACKMODE_REFERENCE 0
+#define LDACBT_PACKMODE_FUSED     1
+LDACBT_API int  ldacBT_set_pack_mode( HANDLE_LDAC_BT hLdacBt, int mode );
+
+/* Configuration of warm start of encoder bit allocation.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_encode() prior to
+ * calling this function. When enabled, bit allocation starts from the result of the previous
+ * frame, which reduces the CPU load of encoding without changing bit rate or bitstream syntax.
+ * The switch is independent of the complexity level: LDACBT_COMPLEXITY_FAST always warm starts,
+ * and changing the level, including by the deadline governor, does not alter the switch.
+ * Warm start is reset to disabled by ldacBT_init_handle_encode().
+ * The API function can be called at any time, after the completion of initializing.
+ *  Format
+ *      int  ldacBT_set_warm_start( HANDLE_LDAC_BT hLdacBt, int enable );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      enable     int               Nonzero to enable warm start, 0 to disable it.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+LDACBT_API int  ldacBT_set_warm_start( HANDLE_LDAC_BT hLdacBt, int enable );
+
 
 /* LDAC encode processing.
  * The LDAC handle must be initialized by API function ldacBT_init_handle_encode() prior to calling
@@ -423,6 +571,12 @@ LDACBT_API int  ldacBT_encode( HANDLE_LDAC_BT hLdacBt, void *p_pcm, int *pcm_use
  * Bluetooth transmission.
  * "sf" is configured to sampling frequency, which is determined by SRC and SNK devices in
  * Bluetooth transmission.
+ * "nshift" reduces or raises the sampling frequency of the output pcm to "sf" * 2^"nshift",
+ * for example 24000 Hz from a 96000 Hz bit stream with -2. Only the part of the spectrum below
+ * the output Nyquist frequency is dequantized, so the processing load drops with the output
+ * sampling frequency. Supported values are -2 to 1 for 44100 and 48000 Hz, and -2 to 0 for
+ * 88200 and 96000 Hz. The frame samples and the output bytes of the decode functions follow
+ * the output sampling frequency.
  * Reserved arguments must be set to "0".
  *  Format
  *      int  ldacBT_init_handle_decode( HANDLE_LDAC_BT hLdacBt, int cm, int sf, int nshift,
@@ -431,7 +585,7 @@ LDACBT_API int  ldacBT_encode( HANDLE_LDAC_BT hLdacBt, void *p_pcm, int *pcm_use
  *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
  *      cm         int               Information of the channel_mode.
  *      sf         int               Sampling frequency of input LDAC bit stream.
- *      nshift     int               Reserved, must be "0".
+ *      nshift     int               Shift of the output sampling frequency in octaves.
  *      var0       int               Reserved, must be "0".
  *      var1       int               Reserved, must be "0".
  *  Return value
@@ -475,6 +629,355 @@ LDACBT_API int ldacBT_decode( HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs, unsig
                               LDACBT_SMPL_FMT_T fmt, int bs_bytes,
                               int *used_bytes, int *wrote_bytes );
 
+/* Set the output gain of a channel of the decoder.
+ * The gain is applied to the spectrum as part of the dequantization, and needs no extra pass
+ * over the PCM signal. A change of the gain is ramped over 8 frames, and is cross-faded by the
+ * overlap of the IMDCT, so that it does not click. A gain set before ldacBT_init_handle_decode()
+ * takes effect from the first frame without ramp.
+ * At the gain of 0, the channel is muted and its dequantization is skipped.
+ * "ch" is 0 for the left or mono channel, and 1 for the right channel. The gain is kept over
+ * ldacBT_init_handle_decode(), and is reset to LDACBT_DEC_GAIN_UNITY by ldacBT_get_handle().
+ *  Format
+ *      int  ldacBT_set_decode_gain( HANDLE_LDAC_BT hLdacBt, int ch, int gain );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      ch         int               Channel. (0-1)
+ *      gain       int               Linear gain. (0-LDACBT_DEC_GAIN_UNITY)
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_DEC_GAIN_UNITY 0x8000
+LDACBT_API int  ldacBT_set_decode_gain( HANDLE_LDAC_BT hLdacBt, int ch, int gain );
+
+/* Set the quality of the decoder, to trade the fidelity for the processing load.
+ * At LDACBT_DEC_QUALITY_LOW, the residual data which refines the spectrum is not dequantized.
+ * The spectrum above the first "nqus" quantization units is treated as zero, and the IMDCT of
+ * a channel whose spectrum is all zero is skipped. All data is still parsed from the bit stream.
+ * The quality can be changed between any frames, and takes effect from the next frame decoded.
+ * It is kept over ldacBT_init_handle_decode(), and is reset to LDACBT_DEC_QUALITY_HIGH with
+ * "nqus" of LDACBT_MAX_NQUS by ldacBT_get_handle().
+ *  Format
+ *      int  ldacBT_set_decode_quality( HANDLE_LDAC_BT hLdacBt, int quality, int nqus );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      quality    int               Decoder quality. (LDACBT_DEC_QUALITY_HIGH or
+ *                                   LDACBT_DEC_QUALITY_LOW)
+ *      nqus       int               Number of quantization units to be dequantized.
+ *                                   (0-LDACBT_MAX_NQUS)
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_DEC_QUALITY_HIGH 0
+#define LDACBT_DEC_QUALITY_LOW  1
+LDACBT_API int  ldacBT_set_decode_quality( HANDLE_LDAC_BT hLdacBt, int quality, int nqus );
+
+/* LDAC decode processing with planar output.
+ * Same as ldacBT_decode() except that the PCM signal of each channel is written directly into
+ * the buffer of the channel, without being staged and interleaved. The buffers must be aligned
+ * to the size of a sample of "fmt", and hold "frame sample" samples each.
+ * "ap_pcm" must have as many non-NULL pointers as the number of channels, which is 1 for
+ * LDACBT_CHANNEL_MODE_MONO and 2 for the others.
+ * The size of output PCM signal of a channel will be set to "wrote_bytes". The value of
+ * "frame sample" * "bit length of pcm sample"/8 will be set in normal.
+ *  Format
+ *      int  ldacBT_decode_planar( HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs,
+ *                                 unsigned char *ap_pcm[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+ *                                 int *used_bytes, int *wrote_bytes );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      p_bs       unsigned char *   Pointer to "ldac_transport_frame".
+ *      ap_pcm     unsigned char *[] Decoded out PCM signal sequence of each channel.
+ *      fmt        LDACBT_SMPL_FMT_T Audio format type of output pcm.
+ *      bs_bytes    int              Data size of input "ldac_transport_frame". Unit: Byte.
+ *      used_bytes  int *            Data size of referenced "ldac_transport_frame". Unit: Byte.
+ *      wrote_bytes int *            Size of decoded out PCM signal per channel. Unit: Byte.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+LDACBT_API int ldacBT_decode_planar( HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs,
+                                     unsigned char *ap_pcm[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+                                     int *used_bytes, int *wrote_bytes );
+
+/* LDAC decode processing up to the spectrum.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_decode() prior to
+ * calling this function. The input is the same as for ldacBT_decode().
+ * The dequantized MDCT coefficients of each channel are written into "ap_spec", and the IMDCT
+ * and the windowing are skipped. "fmt" is LDACBT_SMPL_FMT_S32 for 32bit integers with 1<<30 as
+ * the full scale of the PCM signal, or LDACBT_SMPL_FMT_F32 for floating point values with 1.0 as
+ * the full scale. LDACBT_SMPL_FMT_F32 is not supported by the fixed point library.
+ * The buffer of each channel must hold "frame sample" coefficients, and the number of bytes
+ * written per channel is set to "wrote_bytes".
+ * Optionally, the scale factor index and the word length index of each quantization unit are
+ * written into "ap_idsf" and "ap_idwl", which must hold LDACBT_MAX_NQUS values per channel, and
+ * the number of quantization units of each channel is set into "p_nqus". NULL can be set to
+ * these arguments when not needed.
+ * Since the overlap of the IMDCT is not updated, this function should not be used alternately
+ * with the PCM decoding functions on the same handle.
+ *  Format
+ *      int  ldacBT_decode_spectrum( HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs,
+ *                                   unsigned char *ap_spec[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+ *                                   int *used_bytes, int *wrote_bytes,
+ *                                   int *ap_idsf[], int *ap_idwl[], int *p_nqus );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      p_bs       unsigned char *   Pointer to "ldac_transport_frame".
+ *      ap_spec    unsigned char *[] Spectrum of each channel.
+ *      fmt        LDACBT_SMPL_FMT_T Format of the spectrum.
+ *      bs_bytes    int              Data size of input "ldac_transport_frame". Unit: Byte.
+ *      used_bytes  int *            Data size of referenced "ldac_transport_frame". Unit: Byte.
+ *      wrote_bytes int *            Size of the spectrum per channel. Unit: Byte.
+ *      ap_idsf     int *[]          Scale factor index of each channel, or NULL.
+ *      ap_idwl     int *[]          Word length index of each channel, or NULL.
+ *      p_nqus      int *            Number of quantization units of each channel, or NULL.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_MAX_NQUS 34
+LDACBT_API int ldacBT_decode_spectrum( HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs,
+                                       unsigned char *ap_spec[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+                                       int *used_bytes, int *wrote_bytes,
+                                       int *ap_idsf[], int *ap_idwl[], int *p_nqus );
+
+/* LDAC decode processing mixing frames of several streams.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_decode() prior to
+ * calling this function.
+ * One "ldac_transport_frame" of each of "n_streams" streams is given by "ap_bs" and
+ * "a_bs_bytes", and the referenced data size of each is set in "a_used_bytes" on return. As for
+ * ldacBT_decode(), two bytes must be readable beyond each frame.
+ * The spectra of the frames are summed before a single IMDCT, so that the sum of the streams is
+ * output at the cost of one synthesis. The frames must share the sampling frequency and the
+ * channel config of the first one, while their frame lengths may differ. The first frame
+ * configures the decoder as for ldacBT_decode().
+ * The mixed PCM signal is saturated to the output format; the streams should be attenuated by
+ * the encoder side or by ldacBT_set_decode_gain() as needed. A frame with a non-fatal error is
+ * left out of the mix. On a fatal error nothing is output, and ldacBT_decode_conceal() still
+ * conceals from the last output frame.
+ *  Format
+ *      int  ldacBT_decode_mix( HANDLE_LDAC_BT hLdacBt, unsigned char *ap_bs[], int a_bs_bytes[],
+ *                              int n_streams, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+ *                              int a_used_bytes[], int *wrote_bytes );
+ *  Arguments
+ *      hLdacBt      HANDLE_LDAC_BT    LDAC handle.
+ *      ap_bs        unsigned char *[] Pointer to "ldac_transport_frame" of each stream.
+ *      a_bs_bytes   int []            Data size of each "ldac_transport_frame". Unit: Byte.
+ *      n_streams    int               Number of streams. (1-LDACBT_MAX_NMIX)
+ *      p_pcm        unsigned char *   Decoded out PCM signal sequence.
+ *      fmt          LDACBT_SMPL_FMT_T Audio format type of output pcm.
+ *      a_used_bytes int []            Data size of each referenced "ldac_transport_frame".
+ *                                     Unit: Byte.
+ *      wrote_bytes  int *             Size of decoded out PCM signal. Unit: Byte.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_MAX_NMIX 8
+LDACBT_API int ldacBT_decode_mix( HANDLE_LDAC_BT hLdacBt, unsigned char *ap_bs[], int a_bs_bytes[],
+                                  int n_streams, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                  int a_used_bytes[], int *wrote_bytes );
+
+/* LDAC decode processing of a whole media payload.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_decode() prior to
+ * calling this function.
+ * < Regarding on input "media payload" >
+ *   The media payload consists of one byte whose lower 4 bits hold the number of frames,
+ *   followed by that number of "ldac_transport_frame". All frames are decoded in one call.
+ *   The configuration is checked and updated from the first frame only. The following frames
+ *   must have the same sampling frequency and channel config, otherwise the call fails.
+ *   As for ldacBT_decode(), two bytes must be readable beyond "payload_bytes".
+ * < Regarding on output PCM signal >
+ *   The PCM signal of all frames is written contiguously to "p_pcm". "pcm_bytes" must be at
+ *   least "Number of frames" * "frame sample" * "Number of channels" * "bit length of pcm sample"/8.
+ *   On failure in the middle of the payload, "used_bytes" and "wrote_bytes" hold the amount of
+ *   data for the frames decoded so far.
+ *
+ *  Format
+ *      int  ldacBT_decode_packet( HANDLE_LDAC_BT hLdacBt, unsigned char *p_payload,
+ *                                 unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+ *                                 int payload_bytes, int pcm_bytes,
+ *                                 int *used_bytes, int *wrote_bytes );
+ *  Arguments
+ *      hLdacBt       HANDLE_LDAC_BT    LDAC handle.
+ *      p_payload     unsigned char *   Pointer to "media payload".
+ *      p_pcm         unsigned char *   Decoded out PCM signal sequence.
+ *      fmt           LDACBT_SMPL_FMT_T Audio format type of output pcm.
+ *      payload_bytes int               Data size of input "media payload". Unit: Byte.
+ *      pcm_bytes     int               Size of the buffer for the output PCM signal. Unit: Byte.
+ *      used_bytes    int *             Data size of referenced "media payload". Unit: Byte.
+ *      wrote_bytes   int *             Size of decoded out PCM signal. Unit: Byte.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_PKT_NFRM_MASK 0x0f
+LDACBT_API int ldacBT_decode_packet( HANDLE_LDAC_BT hLdacBt, unsigned char *p_payload,
+                                     unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                     int payload_bytes, int pcm_bytes,
+                                     int *used_bytes, int *wrote_bytes );
+
+/* LDAC packet loss concealment processing.
+ * Synthesizes the PCM signal of "n_frames" lost frames in place of decoding them, so that the
+ * output stays continuous across the gap. The spectra of the last decoded frame are repeated
+ * with decay and random signs, and the output fades to silence after several lost frames.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_decode() prior to
+ * calling this function. The next call of ldacBT_decode() continues from the concealed frames.
+ * < Regarding on output PCM signal >
+ *   The PCM signal of all frames is written contiguously to "p_pcm". "pcm_bytes" must be at
+ *   least "n_frames" * "frame sample" * "Number of channels" * "bit length of pcm sample"/8.
+ *
+ *  Format
+ *      int  ldacBT_decode_conceal( HANDLE_LDAC_BT hLdacBt, unsigned char *p_pcm,
+ *                                  LDACBT_SMPL_FMT_T fmt, int n_frames, int pcm_bytes,
+ *                                  int *wrote_bytes );
+ *  Arguments
+ *      hLdacBt     HANDLE_LDAC_BT    LDAC handle.
+ *      p_pcm       unsigned char *   Concealed PCM signal sequence.
+ *      fmt         LDACBT_SMPL_FMT_T Audio format type of output pcm.
+ *      n_frames    int               Number of lost frames.
+ *      pcm_bytes   int               Size of the buffer for the output PCM signal. Unit: Byte.
+ *      wrote_bytes int *             Size of concealed PCM signal. Unit: Byte.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+LDACBT_API int ldacBT_decode_conceal( HANDLE_LDAC_BT hLdacBt, unsigned char *p_pcm,
+                                      LDACBT_SMPL_FMT_T fmt, int n_frames, int pcm_bytes,
+                                      int *wrote_bytes );
+
+/* LDAC decode processing of a byte stream.
+ * Decodes a sequence of "ldac_transport_frame" delivered in chunks of any size, e.g. read from a
+ * file or a socket. The bytes of an incomplete frame are buffered in the handle and used at the
+ * next call. The decoder searches the syncword by itself; after corrupted or missing data it
+ * skips to the next frame header that is followed by another matching one.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_decode() prior to
+ * calling this function. ldacBT_init_handle_decode() also discards the buffered bytes.
+ * < Regarding on input byte stream >
+ *   Referenced data size of "p_data" will be set in "used_bytes" on return. It is less than
+ *   "data_bytes" only when the output buffer is full; pass the rest at the next call.
+ * < Regarding on output PCM signal >
+ *   The PCM signal of all decoded frames is written contiguously to "p_pcm". Decoding stops
+ *   before a frame whose PCM signal does not fit into the rest of "pcm_bytes".
+ * < Regarding on return value >
+ *   When the stream had to be resynchronized, -1 is returned with the non fatal error code
+ *   LDACBT_ERR_DEC_RESYNC, and the decoded out PCM signal is valid.
+ *
+ *  Format
+ *      int  ldacBT_decode_stream( HANDLE_LDAC_BT hLdacBt, unsigned char *p_data,
+ *                                 unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+ *                                 int data_bytes, int pcm_bytes,
+ *                                 int *used_bytes, int *wrote_bytes );
+ *  Arguments
+ *      hLdacBt     HANDLE_LDAC_BT    LDAC handle.
+ *      p_data      unsigned char *   Pointer to the chunk of byte stream.
+ *      p_pcm       unsigned char *   Decoded out PCM signal sequence.
+ *      fmt         LDACBT_SMPL_FMT_T Audio format type of output pcm.
+ *      data_bytes  int               Data size of the chunk. Unit: Byte.
+ *      pcm_bytes   int               Size of the buffer for the output PCM signal. Unit: Byte.
+ *      used_bytes  int *             Data size of referenced chunk. Unit: Byte.
+ *      wrote_bytes int *             Size of decoded out PCM signal. Unit: Byte.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+LDACBT_API int ldacBT_decode_stream( HANDLE_LDAC_BT hLdacBt, unsigned char *p_data,
+                                     unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                     int data_bytes, int pcm_bytes,
+                                     int *used_bytes, int *wrote_bytes );
+
+/* Reset of sink side jitter buffer.
+ * The jitter buffer receives RTP packets of LDAC media payload by ldacBT_jb_put(), reorders them
+ * by sequence number, and plays them out through ldacBT_jb_pull(). Its target depth is adapted
+ * to the inter-arrival jitter measured from the RTP timestamps, between "min_depth" and
+ * "max_depth" packets.
+ * The jitter buffer is emptied and its statistics are cleared by this function. It must be
+ * called before the jitter buffer is used and when a new stream starts. The first call
+ * allocates the jitter buffer, which is freed by ldacBT_free_handle(). It is not affected by
+ * ldacBT_init_handle_decode().
+ *  Format
+ *      int  ldacBT_jb_reset( HANDLE_LDAC_BT hLdacBt, int min_depth, int max_depth );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      min_depth  int               Minimum target depth. Unit: packet. (1-15)
+ *      max_depth  int               Maximum target depth. Unit: packet. (min_depth-15)
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+#define LDACBT_JB_MAX_DEPTH         15
+#define LDACBT_JB_MIN_DEPTH_DEFAULT  2
+#define LDACBT_JB_MAX_DEPTH_DEFAULT  8
+LDACBT_API int  ldacBT_jb_reset( HANDLE_LDAC_BT hLdacBt, int min_depth, int max_depth );
+
+/* Put a received RTP packet into the jitter buffer.
+ * "p_rtp" points to the RTP header, which is followed by the media payload of one byte with the
+ * number of frames and the "ldac_transport_frame" sequence. "arrival_us" is the time of arrival
+ * in microseconds by a monotonic clock.
+ * Packets that arrive after their playout time or twice are counted and discarded; this is not
+ * an error.
+ *  Format
+ *      int  ldacBT_jb_put( HANDLE_LDAC_BT hLdacBt, unsigned char *p_rtp, int rtp_bytes,
+ *                          unsigned int arrival_us );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      p_rtp      unsigned char *   Pointer to the RTP packet.
+ *      rtp_bytes  int               Size of the RTP packet. Unit: Byte.
+ *      arrival_us unsigned int      Time of arrival. Unit: us.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+LDACBT_API int  ldacBT_jb_put( HANDLE_LDAC_BT hLdacBt, unsigned char *p_rtp, int rtp_bytes,
+                               unsigned int arrival_us );
+
+/* Play out the next packet of the jitter buffer.
+ * The LDAC handle must be initialized by API function ldacBT_init_handle_decode() prior to
+ * calling this function. It is to be called once per packet period by the playback clock.
+ * Until the buffer holds the target number of packets, nothing is output ("wrote_bytes" is 0).
+ * Then the packet of the next sequence number is decoded by ldacBT_decode_packet(). If it is
+ * missing or fails to decode, its frames are concealed by ldacBT_decode_conceal(), so that a
+ * playout always outputs a whole packet period; if the buffer ran empty, the buffer is filled
+ * up to the target again before the playout resumes. When the buffer holds more than the
+ * target depth by 2 packets, the oldest packet is dropped to reduce the latency.
+ *  Format
+ *      int  ldacBT_jb_pull( HANDLE_LDAC_BT hLdacBt, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+ *                           int pcm_bytes, int *wrote_bytes );
+ *  Arguments
+ *      hLdacBt     HANDLE_LDAC_BT    LDAC handle.
+ *      p_pcm       unsigned char *   Decoded out PCM signal sequence.
+ *      fmt         LDACBT_SMPL_FMT_T Audio format type of output pcm.
+ *      pcm_bytes   int               Size of the buffer for the output PCM signal. Unit: Byte.
+ *      wrote_bytes int *             Size of decoded out PCM signal. Unit: Byte.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+LDACBT_API int  ldacBT_jb_pull( HANDLE_LDAC_BT hLdacBt, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                int pcm_bytes, int *wrote_bytes );
+
+/* Acquisition of jitter buffer statistics.
+ * The members of LDACBT_JB_STATS are shown below. The counters are cleared by ldacBT_jb_reset().
+ *   - depth     : Number of packets in the buffer.
+ *   - target    : Target depth. Unit: packet.
+ *   - jitter    : Inter-arrival jitter. Unit: us.
+ *   - received  : Number of packets put into the buffer.
+ *   - late      : Number of packets discarded since they arrived after their playout.
+ *   - duplicate : Number of packets discarded since they were already in the buffer.
+ *   - lost      : Number of packets missing at their playout, and concealed.
+ *   - underrun  : Number of playouts from an empty buffer.
+ *   - dropped   : Number of packets dropped to reduce the latency or on buffer overflow.
+ *  Format
+ *      int  ldacBT_jb_get_stats( HANDLE_LDAC_BT hLdacBt, LDACBT_JB_STATS *p_stats );
+ *  Arguments
+ *      hLdacBt    HANDLE_LDAC_BT    LDAC handle.
+ *      p_stats    LDACBT_JB_STATS * Statistics of jitter buffer.
+ *  Return value
+ *      int : 0 for success, -1 for failure.
+ */
+typedef struct _ldacbt_jb_stats {
+    int depth;
+    int target;
+    int jitter;
+    int received;
+    int late;
+    int duplicate;
+    int lost;
+    int underrun;
+    int dropped;
+} LDACBT_JB_STATS;
+LDACBT_API int  ldacBT_jb_get_stats( HANDLE_LDAC_BT hLdacBt, LDACBT_JB_STATS *p_stats );
+
 #endif /* _ENCODE_ONLY */
 
 /* Acquisition of previously established error code.
@@ -561,6 +1064,8 @@ LDACBT_API int  ldacBT_get_error_code( HANDLE_LDAC_BT hLdacBt );
 #define LDACBT_ERR_ENC_ILL_GRADPAR_D        555
 #define LDACBT_ERR_ENC_ILL_NBANDS           556
 #define LDACBT_ERR_PACK_BLOCK_FAILED        557
+#define LDACBT_ERR_ENC_ILL_COMPLEXITY       558
+#define LDACBT_ERR_ENC_ILL_PACKMODE         559
 
 #define LDACBT_ERR_DEC_INIT_ALLOC           570
 #define LDACBT_ERR_INPUT_BUFFER_SIZE        571
@@ -569,6 +1074,8 @@ LDACBT_API int  ldacBT_get_error_code( HANDLE_LDAC_BT hLdacBt );
 #define LDACBT_ERR_UNPACK_FRAME_ALIGN       574
 #define LDACBT_ERR_FRAME_LENGTH_OVER        575
 #define LDACBT_ERR_FRAME_ALIGN_OVER         576
+#define LDACBT_ERR_DEC_ILL_GAIN             577
+#define LDACBT_ERR_DEC_ILL_QUALITY          578
 
 
 /* LDAC API for Encode */
@@ -580,6 +1087,7 @@ LDACBT_API int  ldacBT_get_error_code( HANDLE_LDAC_BT hLdacBt );
 #define LDACBT_ERR_ILL_MTU_SIZE             1027
 /* LDAC API for Decode */
 #define LDACBT_ERR_DEC_CONFIG_UPDATED       40
+#define LDACBT_ERR_DEC_RESYNC               41
 
 
 /* Macro Functions for Error Code ********************************************/
@@ -8,6 +8,32 @@
 
 #ifndef _DECODE_ONLY
 
+/***************************************************************************************************
+    Word Length Scaling Parameters for Each Gradient Mode (Multiplier, Shift, Additional WL)
+***************************************************************************************************/
+static const int saa_grad_scale_ldac[4][3] = {
+    {1, 0, 0},
+    {1, 1, 1},
+    {3, 3, 1},
+    {1, 2, 1},
+};
+
+/***************************************************************************************************
+    Subfunction: Calculate Word Length from Gradient Curve
+***************************************************************************************************/
+__inline static int calc_word_length_ldac(
+int idsf,
+int grad,
+int addwl,
+const int *p_scale)
+{
+    int tmp;
+
+    tmp = idsf + grad + addwl * p_scale[2];
+    tmp = ((max_ldac(tmp, 0) * p_scale[0]) >> p_scale[1]) + min_ldac(tmp, 0);
+
+    return max_ldac(tmp, LDAC_MINIDWL1);
+}
 
 /***************************************************************************************************
     Subfunction: Calculate Bits for Audio Block
@@ -20,14 +46,14 @@ int hqu)
     int ich, iqu;
     int nchs = p_ab->blk_nchs;
     int tmp, nbits = 0;
-    int idsp, idwl1, idwl2;
-    int grad_mode = p_ab->grad_mode;
+    int idwl, idwl1;
     int grad_qu_l = p_ab->grad_qu_l;
     int grad_qu_h = p_ab->grad_qu_h;
     int grad_os_l = p_ab->grad_os_l;
     int grad_os_h = p_ab->grad_os_h;
     int *p_grad = p_ab->a_grad;
     int *p_idsf, *p_addwl, *p_idwl1, *p_idwl2;
+    const int *p_scale = saa_grad_scale_ldac[p_ab->grad_mode];
     const unsigned char *p_t;
 
     /* Calculate Gradient Curve */
@@ -66,94 +92,13 @@ int hqu)
         p_idwl1 = p_ac->a_idwl1;
         p_idwl2 = p_ac->a_idwl2;
 
-        if (grad_mode == LDAC_MODE_0) { 
-            for (iqu = 0; iqu < hqu; iqu++) {
-                idwl1 = p_idsf[iqu] + p_grad[iqu];
-                if (idwl1 < LDAC_MINIDWL1) {
-                    idwl1 = LDAC_MINIDWL1;
-                }
-                idwl2 = 0;
-                if (idwl1 > LDAC_MAXIDWL1) {
-                    idwl2 = idwl1 - LDAC_MAXIDWL1;
-                    if (idwl2 > LDAC_MAXIDWL2) {
-                        idwl2 = LDAC_MAXIDWL2;
-                    }
-                    idwl1 = LDAC_MAXIDWL1;
-                }
-                p_idwl1[iqu] = idwl1;
-                p_idwl2[iqu] = idwl2;
-                idsp = ga_idsp_ldac[iqu];
-                nbits += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-            }
-        }
-        else if (grad_mode == LDAC_MODE_1) {
-            for (iqu = 0; iqu < hqu; iqu++) {
-                idwl1 = p_idsf[iqu] + p_grad[iqu] + p_addwl[iqu];
-                if (idwl1 > 0) {
-                    idwl1 = idwl1 >> 1;
-                }
-                if (idwl1 < LDAC_MINIDWL1) {
-                    idwl1 = LDAC_MINIDWL1;
-                }
-                idwl2 = 0;
-                if (idwl1 > LDAC_MAXIDWL1) {
-                    idwl2 = idwl1 - LDAC_MAXIDWL1;
-                    if (idwl2 > LDAC_MAXIDWL2) {
-                        idwl2 = LDAC_MAXIDWL2;
-                    }
-                    idwl1 = LDAC_MAXIDWL1;
-                }
-                p_idwl1[iqu] = idwl1;
-                p_idwl2[iqu] = idwl2;
-                idsp = ga_idsp_ldac[iqu];
-                nbits += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-            }
-        }
-        else if (grad_mode == LDAC_MODE_2) {
-            for (iqu = 0; iqu < hqu; iqu++) {
-                idwl1 = p_idsf[iqu] + p_grad[iqu] + p_addwl[iqu];
-                if (idwl1 > 0) {
-                    idwl1 = (idwl1*3) >> 3;
-                }
-                if (idwl1 < LDAC_MINIDWL1) {
-                    idwl1 = LDAC_MINIDWL1;
-                }
-                idwl2 = 0;
-                if (idwl1 > LDAC_MAXIDWL1) {
-                    idwl2 = idwl1 - LDAC_MAXIDWL1;
-                    if (idwl2 > LDAC_MAXIDWL2) {
-                        idwl2 = LDAC_MAXIDWL2;
-                    }
-                    idwl1 = LDAC_MAXIDWL1;
-                }
-                p_idwl1[iqu] = idwl1;
-                p_idwl2[iqu] = idwl2;
-                idsp = ga_idsp_ldac[iqu];
-                nbits += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-            }
-        }
-        else if (grad_mode == LDAC_MODE_3) {
-            for (iqu = 0; iqu < hqu; iqu++) {
-                idwl1 = p_idsf[iqu] + p_grad[iqu] + p_addwl[iqu];
-                if (idwl1 > 0) {
-                    idwl1 = idwl1 >> 2;
-                }
-                if (idwl1 < LDAC_MINIDWL1) {
-                    idwl1 = LDAC_MINIDWL1;
-                }
-                idwl2 = 0;
-                if (idwl1 > LDAC_MAXIDWL1) {
-                    idwl2 = idwl1 - LDAC_MAXIDWL1;
-                    if (idwl2 > LDAC_MAXIDWL2) {
-                        idwl2 = LDAC_MAXIDWL2;
-                    }
-                    idwl1 = LDAC_MAXIDWL1;
-                }
-                p_idwl1[iqu] = idwl1;
-                p_idwl2[iqu] = idwl2;
-                idsp = ga_idsp_ldac[iqu];
-                nbits += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-            }
+        for (iqu = 0; iqu < hqu; iqu++) {
+            idwl = calc_word_length_ldac(p_idsf[iqu], p_grad[iqu], p_addwl[iqu], p_scale);
+            idwl = min_ldac(idwl, LDAC_NIDWLS-1);
+            idwl1 = min_ldac(idwl, LDAC_MAXIDWL1);
+            p_idwl1[iqu] = idwl1;
+            p_idwl2[iqu] = idwl - idwl1;
+            nbits += ga_nbits_wls_ldac[ga_idsp_ldac[iqu]*LDAC_NIDWLS+idwl];
         }
     }
 
@@ -172,7 +117,7 @@ int nadjqus)
     int nchs = p_ab->blk_nchs;
     int nqus = min_ldac(LDAC_MAXNADJQUS, p_ab->nqus);
     int nbits = 0;
-    int idsp, idwl1, idwl2;
+    int idwl, idwl1;
     int *p_idwl1, *p_idwl2, *p_tmp;
 
     /* Calculate Bits */
@@ -183,22 +128,11 @@ int nadjqus)
         p_tmp = p_ac->a_tmp;
 
         for (iqu = 0; iqu < nqus; iqu++) {
-            idwl1 = p_tmp[iqu];
-            if (iqu < nadjqus) {
-                idwl1++;
-            }
-            idwl2 = 0;
-            if (idwl1 > LDAC_MAXIDWL1) {
-                idwl2 = idwl1 - LDAC_MAXIDWL1;
-                if (idwl2 > LDAC_MAXIDWL2) {
-                    idwl2 = LDAC_MAXIDWL2;
-                }
-                idwl1 = LDAC_MAXIDWL1;
-            }
+            idwl = min_ldac(p_tmp[iqu] + (iqu < nadjqus), LDAC_NIDWLS-1);
+            idwl1 = min_ldac(idwl, LDAC_MAXIDWL1);
             p_idwl1[iqu] = idwl1;
-            p_idwl2[iqu] = idwl2;
-            idsp = ga_idsp_ldac[iqu];
-            nbits += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
+            p_idwl2[iqu] = idwl - idwl1;
+            nbits += ga_nbits_wls_ldac[ga_idsp_ldac[iqu]*LDAC_NIDWLS+idwl];
         }
     }
 
@@ -528,6 +462,8 @@ int *p_nbits_spec)
 ***************************************************************************************************/
 static int adjust_remain_bits_ldac(
 AB *p_ab, 
+int nadjqus,
+int step,
 int *p_nbits_spec,
 int *p_nadjqus)
 {
@@ -535,13 +471,10 @@ int *p_nadjqus)
     int ncalls = 0;
     int nbits_fix, nbits_spec;
     int nbits_avail = p_ab->nbits_avail;
-    int idsp, idwl1, idwl2, tmp;
-    int step = LDAC_MAXNADJQUS>>1;
-    int nadjqus = LDAC_MAXNADJQUS>>1;
     int nchs = p_ab->blk_nchs;
     int nqus = min_ldac(LDAC_MAXNADJQUS, p_ab->nqus);
-    int grad_mode = p_ab->grad_mode;
     int *p_grad = p_ab->a_grad;
+    const int *p_scale = saa_grad_scale_ldac[p_ab->grad_mode];
     int *p_idsf, *p_addwl, *p_idwl1, *p_idwl2, *p_tmp;
     AC *p_ac;
 
@@ -554,66 +487,9 @@ int *p_nadjqus)
         p_idwl2 = p_ac->a_idwl2;
         p_tmp = p_ac->a_tmp;
 
-        if (grad_mode == LDAC_MODE_0) {
-            for (iqu = 0; iqu < nqus; iqu++) {
-                idwl1 = p_idwl1[iqu];
-                idwl2 = p_idwl2[iqu];
-                idsp = ga_idsp_ldac[iqu];
-                nbits_fix += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-                tmp = p_idsf[iqu] + p_grad[iqu];
-                if (tmp < LDAC_MINIDWL1) {
-                    tmp = LDAC_MINIDWL1;
-                }
-                p_tmp[iqu] = tmp;
-            }
-        }
-        else if (grad_mode == LDAC_MODE_1) {
-            for (iqu = 0; iqu < nqus; iqu++) {
-                idwl1 = p_idwl1[iqu];
-                idwl2 = p_idwl2[iqu];
-                idsp = ga_idsp_ldac[iqu];
-                nbits_fix += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-                tmp = p_idsf[iqu] + p_grad[iqu] + p_addwl[iqu];
-                if (tmp > 0) {
-                    tmp = tmp >> 1;
-                }
-                if (tmp < LDAC_MINIDWL1) {
-                    tmp = LDAC_MINIDWL1;
-                }
-                p_tmp[iqu] = tmp;
-            }
-        }
-        else if (grad_mode == LDAC_MODE_2) {
-            for (iqu = 0; iqu < nqus; iqu++) {
-                idwl1 = p_idwl1[iqu];
-                idwl2 = p_idwl2[iqu];
-                idsp = ga_idsp_ldac[iqu];
-                nbits_fix += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-                tmp = p_idsf[iqu] + p_grad[iqu] + p_addwl[iqu];
-                if (tmp > 0) {
-                    tmp = (tmp*3) >> 3;
-                }
-                if (tmp < LDAC_MINIDWL1) {
-                    tmp = LDAC_MINIDWL1;
-                }
-                p_tmp[iqu] = tmp;
-            }
-        }
-        else if (grad_mode == LDAC_MODE_3) {
-            for (iqu = 0; iqu < nqus; iqu++) {
-                idwl1 = p_idwl1[iqu];
-                idwl2 = p_idwl2[iqu];
-                idsp = ga_idsp_ldac[iqu];
-                nbits_fix += gaa_ndim_wls_ldac[idsp][idwl1] + ga_wl_ldac[idwl2] * ga_nsps_ldac[iqu];
-                tmp = p_idsf[iqu] + p_grad[iqu] + p_addwl[iqu];
-                if (tmp > 0) {
-                    tmp = tmp >> 2;
-                }
-                if (tmp < LDAC_MINIDWL1) {
-                    tmp = LDAC_MINIDWL1;
-                }
-                p_tmp[iqu] = tmp;
-            }
+        for (iqu = 0; iqu < nqus; iqu++) {
+            nbits_fix += ga_nbits_wls_ldac[ga_idsp_ldac[iqu]*LDAC_NIDWLS+p_idwl1[iqu]+p_idwl2[iqu]];
+            p_tmp[iqu] = calc_word_length_ldac(p_idsf[iqu], p_grad[iqu], p_addwl[iqu], p_scale);
         }
     }
 
@@ -654,69 +530,227 @@ int *p_nadjqus)
     return ncalls;
 }
 
+/***************************************************************************************************
+    Subfunction: Fill Remaining Bits with Higher Offsets of Gradient Curve
+***************************************************************************************************/
+#define LDAC_FILL_GRADOS_RANGE 3
+
+static int fill_remain_bits_ldac(
+AB *p_ab,
+int *p_nbits_spec)
+{
+    int i;
+    int ncalls = 0;
+    int nqus = p_ab->nqus;
+    int grad_os_l = p_ab->grad_os_l;
+    int nbits_avail = p_ab->nbits_avail;
+    int nbits_spec, nbits_best = *p_nbits_spec;
+    int nadjqus, grad_os_best = grad_os_l;
+
+    for (i = 1; i <= LDAC_FILL_GRADOS_RANGE; i++) {
+        if (grad_os_l+i > LDAC_MAXGRADOS) {
+            break;
+        }
+        p_ab->grad_os_l = grad_os_l + i;
+        nbits_spec = encode_audio_block_a_ldac(p_ab, nqus);
+        ncalls++;
+        ncalls += adjust_remain_bits_ldac(p_ab, LDAC_MAXNADJQUS>>1, LDAC_MAXNADJQUS>>1,
+                &nbits_spec, &nadjqus);
+        if ((nbits_spec <= nbits_avail) && (nbits_spec > nbits_best)) {
+            grad_os_best = grad_os_l + i;
+            nbits_best = nbits_spec;
+        }
+    }
+
+    p_ab->grad_os_l = grad_os_best;
+    *p_nbits_spec = encode_audio_block_a_ldac(p_ab, nqus);
+    ncalls++;
+    ncalls += adjust_remain_bits_ldac(p_ab, LDAC_MAXNADJQUS>>1, LDAC_MAXNADJQUS>>1,
+            p_nbits_spec, &p_ab->nadjqus);
+
+    return ncalls;
+}
+
+/***************************************************************************************************
+    Subfunction: Allocate Bits from Previous Frame Result
+***************************************************************************************************/
+#define LDAC_WARM_GRADOS_RANGE 4
+#define LDAC_WARM_NADJQUS_STEP 4
+
+static int alloc_bits_warm_ldac(
+AB *p_ab,
+int *p_nbits_side,
+int *p_nbits_spec)
+{
+    int i;
+    int nbits_avail, nbits_side, nbits_spec;
+    int nqus = p_ab->nqus;
+    int grad_os_l = p_ab->prev_grad_os_l;
+
+    if ((p_ab->prev_nbands != p_ab->nbands) || (p_ab->prev_frame_status != *p_ab->p_frame_status)) {
+        return LDAC_FALSE;
+    }
+
+    p_ab->grad_qu_l = p_ab->prev_grad_qu_l;
+    p_ab->grad_os_l = grad_os_l;
+    p_ab->grad_os_h = p_ab->prev_grad_os_h;
+
+    nbits_side = encode_side_info_ldac(p_ab);
+    p_ab->nbits_avail = nbits_avail = p_ab->nbits_ab - nbits_side;
+
+    nbits_spec = encode_audio_block_a_ldac(p_ab, nqus);
+
+    /* Transient: Cost Jumped away from Previous Frame */
+    if (abs(nbits_spec - p_ab->prev_nbits_spec) > (nbits_avail >> 3)) {
+        return LDAC_FALSE;
+    }
+
+    /* Local Search around Previous Lower Offset */
+    if (nbits_spec > nbits_avail) {
+        for (i = 0; i < LDAC_WARM_GRADOS_RANGE; i++) {
+            if ((nbits_spec <= nbits_avail) || (grad_os_l >= LDAC_MAXGRADOS)) {
+                break;
+            }
+            p_ab->grad_os_l = ++grad_os_l;
+            nbits_spec = encode_audio_block_a_ldac(p_ab, nqus);
+        }
+        if (nbits_spec > nbits_avail) {
+            return LDAC_FALSE;
+        }
+    }
+    else {
+        for (i = 0; i < LDAC_WARM_GRADOS_RANGE; i++) {
+            if (grad_os_l <= 0) {
+                break;
+            }
+            p_ab->grad_os_l = --grad_os_l;
+            nbits_spec = encode_audio_block_a_ldac(p_ab, nqus);
+            if (nbits_spec > nbits_avail) {
+                p_ab->grad_os_l = ++grad_os_l;
+                nbits_spec = encode_audio_block_a_ldac(p_ab, nqus);
+                break;
+            }
+        }
+    }
+
+    *p_nbits_side = nbits_side;
+    *p_nbits_spec = nbits_spec;
+
+    return LDAC_TRUE;
+}
+
 /***************************************************************************************************
     Allocate Bits
 ***************************************************************************************************/
 #define LDAC_UPPER_NOISE_LEVEL 20
 #define LDAC_LOWER_NOISE_LEVEL 5
 
+/* Number of Cost Calculations after which Refinement Steps are Skipped */
+static const int sa_maxncalls_ldac[LDAC_NCOMPLEXITY] = {
+    6, LDAC_MAXBITNUM, LDAC_MAXBITNUM,
+};
+
 DECLFUNC int alloc_bits_ldac(
 AB *p_ab)
 {
     int nbits_avail, nbits_side = 0, nbits_spec = 0;
     int nbits_ab = p_ab->nbits_ab;
+    int nbands = p_ab->nbands;
+    int nadjqus = LDAC_MAXNADJQUS>>1;
+    int step = LDAC_MAXNADJQUS>>1;
+    int ncalls = 0;
+    int maxncalls = sa_maxncalls_ldac[p_ab->complexity];
+    int warm = LDAC_FALSE;
 
-    nbits_side = encode_side_info_ldac(p_ab);
-    p_ab->nbits_avail = nbits_avail = nbits_ab - nbits_side;
+    if (p_ab->warm_start && p_ab->prev_nbands) {
+        int grad_qu_l = p_ab->grad_qu_l;
+        int grad_os_l = p_ab->grad_os_l;
+        int grad_os_h = p_ab->grad_os_h;
 
-    nbits_spec = encode_audio_block_a_ldac(p_ab, p_ab->nqus);
+        warm = alloc_bits_warm_ldac(p_ab, &nbits_side, &nbits_spec);
+        if (!warm) {
+            p_ab->grad_qu_l = grad_qu_l;
+            p_ab->grad_os_l = grad_os_l;
+            p_ab->grad_os_h = grad_os_h;
+        }
+    }
 
-    if (nbits_spec > nbits_avail) {
-        if (p_ab->grad_mode == LDAC_MODE_0) {
-            decrease_offset_low_ldac(p_ab, LDAC_UPPER_NOISE_LEVEL, &nbits_spec);
+    if (warm) {
+        nbits_avail = p_ab->nbits_avail;
+        step = LDAC_WARM_NADJQUS_STEP;
+        nadjqus = min_ldac(max_ldac(p_ab->prev_nadjqus, step), LDAC_MAXNADJQUS-step);
+    }
+    else {
+        nbits_side = encode_side_info_ldac(p_ab);
+        p_ab->nbits_avail = nbits_avail = nbits_ab - nbits_side;
 
-            decrease_offset_high_ldac(p_ab, &nbits_spec);
+        nbits_spec = encode_audio_block_a_ldac(p_ab, p_ab->nqus);
 
-            decrease_offset_low_ldac(p_ab, LDAC_MAXGRADOS, &nbits_spec);
-        }
-        else {
-            decrease_offset_low_ldac(p_ab, LDAC_MAXGRADOS, &nbits_spec);
-        }
+        if (nbits_spec > nbits_avail) {
+            if (p_ab->grad_mode == LDAC_MODE_0) {
+                ncalls += decrease_offset_low_ldac(p_ab, LDAC_UPPER_NOISE_LEVEL, &nbits_spec);
 
-        while ((nbits_spec > nbits_avail) && (p_ab->nbands > LDAC_BAND_OFFSET)) {
-            p_ab->nbands--;
-            p_ab->nqus = ga_nqus_ldac[p_ab->nbands];
+                ncalls += decrease_offset_high_ldac(p_ab, &nbits_spec);
 
-            nbits_side = encode_side_info_ldac(p_ab);
-            p_ab->nbits_avail = nbits_avail = nbits_ab - nbits_side;
+                ncalls += decrease_offset_low_ldac(p_ab, LDAC_MAXGRADOS, &nbits_spec);
+            }
+            else {
+                ncalls += decrease_offset_low_ldac(p_ab, LDAC_MAXGRADOS, &nbits_spec);
+            }
 
-            nbits_spec = encode_audio_block_a_ldac(p_ab, p_ab->nqus);
-        }
-    }
+            while ((nbits_spec > nbits_avail) && (p_ab->nbands > LDAC_BAND_OFFSET)) {
+                p_ab->nbands--;
+                p_ab->nqus = ga_nqus_ldac[p_ab->nbands];
 
-    if (nbits_spec < nbits_avail) {
-        if (p_ab->grad_mode == LDAC_MODE_0) {
-            increase_offset_low_ldac(p_ab, &nbits_spec);
+                nbits_side = encode_side_info_ldac(p_ab);
+                p_ab->nbits_avail = nbits_avail = nbits_ab - nbits_side;
 
-            increase_qu_low_0_ldac(p_ab, &nbits_spec);
-        }    
-        else {
-            increase_offset_low_ldac(p_ab, &nbits_spec);
+                nbits_spec = encode_audio_block_a_ldac(p_ab, p_ab->nqus);
+            }
+        }
 
-            increase_qu_low_ldac(p_ab, &nbits_spec);
+        if ((nbits_spec < nbits_avail) && (ncalls < maxncalls)) {
+            ncalls += increase_offset_low_ldac(p_ab, &nbits_spec);
+
+            if (ncalls < maxncalls) {
+                if (p_ab->grad_mode == LDAC_MODE_0) {
+                    increase_qu_low_0_ldac(p_ab, &nbits_spec);
+                }
+                else {
+                    increase_qu_low_ldac(p_ab, &nbits_spec);
+                }
+            }
         }
     }
+    p_ab->prev_nbits_spec = nbits_spec;
 
     p_ab->nadjqus = 0;
-    adjust_remain_bits_ldac(p_ab, &nbits_spec, &p_ab->nadjqus);
+    adjust_remain_bits_ldac(p_ab, nadjqus, step, &nbits_spec, &p_ab->nadjqus);
+
+    if ((nbits_spec > nbits_avail) && warm) {
+        adjust_remain_bits_ldac(p_ab, LDAC_MAXNADJQUS>>1, LDAC_MAXNADJQUS>>1,
+                &nbits_spec, &p_ab->nadjqus);
+    }
+
+    if ((nbits_spec <= nbits_avail) && (p_ab->complexity == LDAC_COMPLEXITY_EXHAUSTIVE)) {
+        fill_remain_bits_ldac(p_ab, &nbits_spec);
+    }
 
     if (nbits_spec > nbits_avail) {
         *p_ab->p_error_code = LDAC_ERR_BIT_ALLOCATION;
+        p_ab->prev_nbands = 0;
         return LDAC_FALSE;
     }
     p_ab->nbits_spec = nbits_spec;
     p_ab->nbits_used = nbits_spec + nbits_side;
 
+    /* Keep Converged Parameters for Warm Start of Next Frame */
+    p_ab->prev_nbands = (p_ab->nbands == nbands) ? nbands : 0;
+    p_ab->prev_grad_qu_l = p_ab->grad_qu_l;
+    p_ab->prev_grad_os_l = p_ab->grad_os_l;
+    p_ab->prev_grad_os_h = p_ab->grad_os_h;
+    p_ab->prev_nadjqus = p_ab->nadjqus;
+    p_ab->prev_frame_status = *p_ab->p_frame_status;
 
     return LDAC_TRUE;
 }
@@ -65,157 +65,186 @@ int n)
     return id;
 }
 
-typedef struct {
-    int bitlen;
-    int offset;
-    int weight;
-} SFCINF;
+/***************************************************************************************************
+    Weighting Tables Searched for Each Complexity Level
+***************************************************************************************************/
+static const int sa_nsfcwtbl_ldac[LDAC_NCOMPLEXITY] = {
+    3, LDAC_NSFCWTBL, LDAC_NSFCWTBL,
+};
+
+static const unsigned char saa_sfcwtbl_ldac[LDAC_NCOMPLEXITY][LDAC_NSFCWTBL] = {
+    {0, 6, 2, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7},
+    {0, 1, 2, 3, 4, 5, 6, 7},
+};
 
 /***************************************************************************************************
-    Subfunction: Calculate Bits for Scale Factor Data - Mode 0
+    Subfunction: Calculate Bits for Scale Factor Data of All QU Prefixes - Mode 0
 ***************************************************************************************************/
 static const unsigned char sa_bitlen_maxdif_0_ldac[LDAC_NIDSF] = {
     3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
 };
 
-static int encode_scale_factor_0_ldac(
+static void encode_scale_factor_0_ldac(
 AC *p_ac,
+int nqus,
 SFCINF *p_sfcinf)
 {
-    HCENC *p_hcsf;
-    int iqu, iwt;
-    int nqus = p_ac->p_ab->nqus;
-    int nbits = LDAC_MAXBITNUM;
-    int bitlen, vmin, vmax, val0, val1;
+    HCENC *p_hcsf = ga_hcenc_sf0_ldac;
+    int iqu, iwt, i, n;
+    int nwtbls = sa_nsfcwtbl_ldac[p_ac->p_ab->complexity];
+    int nbits, bitlen, vmin, vmax, val0, val1;
     int *p_idsf = p_ac->a_idsf;
     int *p_idsf_dif = p_ac->a_tmp;
+    const unsigned char *p_wtbl = saa_sfcwtbl_ldac[p_ac->p_ab->complexity];
     const unsigned char *p_tbl;
 
-    for (iwt = 0; iwt < LDAC_NSFCWTBL; iwt++) {
+    for (n = 1; n <= nqus; n++) {
+        p_sfcinf[n].nbits = LDAC_MAXBITNUM;
+    }
+
+    for (i = 0; i < nwtbls; i++) {
+        iwt = p_wtbl[i];
         p_tbl = gaa_sfcwgt_ldac[iwt];
         vmin = vmax = val0 = p_idsf[0] + p_tbl[0];
-        for (iqu = 1; iqu < nqus; iqu++) {
-            val1 = p_idsf[iqu] + p_tbl[iqu];
-            if (vmin > val1) {
-                vmin = val1;
+        bitlen = nbits = 0;
+
+        for (n = 1; n <= nqus; n++) {
+            iqu = n-1;
+            if (iqu > 0) {
+                val1 = p_idsf[iqu] + p_tbl[iqu];
+                vmin = min_ldac(vmin, val1);
+                vmax = max_ldac(vmax, val1);
+                p_idsf_dif[iqu] = val1 - val0;
+                val0 = val1;
+            }
+
+            /* The code length grows with the prefix, so the sum is rebuilt only when it changes */
+            if (bitlen != sa_bitlen_maxdif_0_ldac[(vmax-vmin)>>1]) {
+                bitlen = sa_bitlen_maxdif_0_ldac[(vmax-vmin)>>1];
+                p_hcsf = ga_hcenc_sf0_ldac + (bitlen-LDAC_MINSFCBLEN_0);
+                nbits = 0;
+                for (iqu = 1; iqu < n; iqu++) {
+                    nbits += hc_len_ldac(p_hcsf->p_tbl+(p_idsf_dif[iqu]&p_hcsf->mask));
+                }
             }
-            if (vmax < val1) {
-                vmax = val1;
+            else if (iqu > 0) {
+                nbits += hc_len_ldac(p_hcsf->p_tbl+(p_idsf_dif[iqu]&p_hcsf->mask));
             }
-            p_idsf_dif[iqu] = val1 - val0;
-            val0 = val1;
-        }
 
-        val1 = bitlen = sa_bitlen_maxdif_0_ldac[(vmax-vmin)>>1];
-        p_hcsf = ga_hcenc_sf0_ldac + (bitlen-LDAC_MINSFCBLEN_0);
-        for (iqu = 1; iqu < nqus; iqu++) {
-            val0 = p_idsf_dif[iqu] & p_hcsf->mask;
-            val1 += hc_len_ldac(p_hcsf->p_tbl+val0);
+            if (p_sfcinf[n].nbits > bitlen+nbits) {
+                p_sfcinf[n].nbits = bitlen + nbits;
+                p_sfcinf[n].bitlen = bitlen;
+                p_sfcinf[n].offset = vmin;
+                p_sfcinf[n].weight = iwt;
+            }
         }
+    }
 
-        if (nbits > val1) {
-            p_sfcinf->bitlen = bitlen;
-            p_sfcinf->offset = vmin;
-            p_sfcinf->weight = iwt;
-            nbits = val1;
-        }
+    for (n = 1; n <= nqus; n++) {
+        p_sfcinf[n].nbits += LDAC_SFCBLENBITS + LDAC_IDSFBITS + LDAC_SFCWTBLBITS;
     }
-    nbits += LDAC_SFCBLENBITS + LDAC_IDSFBITS + LDAC_SFCWTBLBITS;
 
-    return nbits;
+    return;
 }
 
 /***************************************************************************************************
-    Subfunction: Calculate Bits for Scale Factor Data - Mode 1
+    Subfunction: Calculate Bits for Scale Factor Data of All QU Prefixes - Mode 1
 ***************************************************************************************************/
 static const unsigned char sa_bitlen_maxdif_1_ldac[LDAC_NIDSF] = {
     2, 2, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
 };
 
-static int encode_scale_factor_1_ldac(
+static void encode_scale_factor_1_ldac(
 AC *p_ac,
+int nqus,
 SFCINF *p_sfcinf)
 {
-    int iqu, iwt;
-    int nqus = p_ac->p_ab->nqus;
-    int nbits = LDAC_MAXBITNUM;
+    int iqu, iwt, i, n;
+    int nwtbls = sa_nsfcwtbl_ldac[p_ac->p_ab->complexity];
     int bitlen, vmin, vmax, val;
     int *p_idsf = p_ac->a_idsf;
+    const unsigned char *p_wtbl = saa_sfcwtbl_ldac[p_ac->p_ab->complexity];
     const unsigned char *p_tbl;
 
-    for (iwt = 0; iwt < LDAC_NSFCWTBL; iwt++) {
+    for (n = 1; n <= nqus; n++) {
+        p_sfcinf[n].nbits = LDAC_MAXBITNUM;
+    }
+
+    for (i = 0; i < nwtbls; i++) {
+        iwt = p_wtbl[i];
         p_tbl = gaa_sfcwgt_ldac[iwt];
         vmin = vmax = p_idsf[0] + p_tbl[0];
-        for (iqu = 1; iqu < nqus; iqu++) {
+
+        for (n = 1; n <= nqus; n++) {
+            iqu = n-1;
             val = p_idsf[iqu] + p_tbl[iqu];
-            if (vmin > val) {
-                vmin = val;
+            vmin = min_ldac(vmin, val);
+            vmax = max_ldac(vmax, val);
+
+            bitlen = sa_bitlen_maxdif_1_ldac[(vmax-vmin)>>1];
+            if (bitlen > 4) {
+                val = LDAC_SFCBLENBITS;
             }
-            if (vmax < val) {
-                vmax = val;
+            else {
+                val = LDAC_SFCBLENBITS + LDAC_IDSFBITS + LDAC_SFCWTBLBITS;
             }
-        }
+            val += bitlen * n;
 
-        bitlen = sa_bitlen_maxdif_1_ldac[(vmax-vmin)>>1];
-        if (bitlen > 4) {
-            val = LDAC_SFCBLENBITS;
-        }
-        else {
-            val = LDAC_SFCBLENBITS + LDAC_IDSFBITS + LDAC_SFCWTBLBITS;
-        }
-        val += bitlen * nqus;
-
-        if (nbits > val) {
-            p_sfcinf->bitlen = bitlen;
-            p_sfcinf->offset = vmin;
-            p_sfcinf->weight = iwt;
-            nbits = val;
+            if (p_sfcinf[n].nbits > val) {
+                p_sfcinf[n].nbits = val;
+                p_sfcinf[n].bitlen = bitlen;
+                p_sfcinf[n].offset = vmin;
+                p_sfcinf[n].weight = iwt;
+            }
         }
     }
 
-    return nbits;
+    return;
 }
 
 /***************************************************************************************************
-    Subfunction: Calculate Bits for Scale Factor Data - Mode 2
+    Subfunction: Calculate Bits for Scale Factor Data of All QU Prefixes - Mode 2
 ***************************************************************************************************/
 static const unsigned char sa_bitlen_absmax_2_ldac[LDAC_NIDSF>>1] = {
     2, 3, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
 };
 
-static int encode_scale_factor_2_ldac(
+static void encode_scale_factor_2_ldac(
 AC *p_ac,
+int nqus,
 SFCINF *p_sfcinf)
 {
-    HCENC *p_hcsf;
-    int iqu;
-    int nqus = p_ac->p_ab->nqus;
-    int nbits, bitlen, vmax, val;
+    HCENC *p_hcsf = ga_hcenc_sf1_ldac;
+    int iqu, n;
+    int nbits, bitlen = 0, vmax = 0;
     int *p_idsf_dif = p_ac->a_tmp;
 
-    p_idsf_dif[0] = p_ac->a_idsf[0] - p_ac->p_ab->ap_ac[0]->a_idsf[0];
-    vmax = abs(p_idsf_dif[0]);
-    for (iqu = 1; iqu < nqus; iqu++) {
+    nbits = 0;
+    for (n = 1; n <= nqus; n++) {
+        iqu = n-1;
         p_idsf_dif[iqu] = p_ac->a_idsf[iqu] - p_ac->p_ab->ap_ac[0]->a_idsf[iqu];
-        val = abs(p_idsf_dif[iqu]);
-        if (vmax < val) {
-            vmax = val;
+        vmax = max_ldac(vmax, abs(p_idsf_dif[iqu]));
+
+        if (bitlen != sa_bitlen_absmax_2_ldac[vmax>>1]) {
+            bitlen = sa_bitlen_absmax_2_ldac[vmax>>1];
+            p_hcsf = ga_hcenc_sf1_ldac + (bitlen-LDAC_MINSFCBLEN_2);
+            nbits = 0;
+            for (iqu = 0; iqu < n; iqu++) {
+                nbits += hc_len_ldac(p_hcsf->p_tbl+(p_idsf_dif[iqu]&p_hcsf->mask));
+            }
+        }
+        else {
+            nbits += hc_len_ldac(p_hcsf->p_tbl+(p_idsf_dif[iqu]&p_hcsf->mask));
         }
-    }
 
-    nbits = LDAC_SFCBLENBITS;
-    bitlen = sa_bitlen_absmax_2_ldac[vmax>>1];
-    p_hcsf = ga_hcenc_sf1_ldac + (bitlen-LDAC_MINSFCBLEN_2);
-    for (iqu = 0; iqu < nqus; iqu++) {
-        val = p_idsf_dif[iqu] & p_hcsf->mask;
-        nbits += hc_len_ldac(p_hcsf->p_tbl+val);
+        p_sfcinf[n].nbits = LDAC_SFCBLENBITS + nbits;
+        p_sfcinf[n].bitlen = bitlen;
+        p_sfcinf[n].offset = 0;
+        p_sfcinf[n].weight = 0;
     }
 
-    p_sfcinf->bitlen = bitlen;
-    p_sfcinf->offset = 0;
-    p_sfcinf->weight = 0;
-
-    return nbits;
+    return;
 }
 
 /***************************************************************************************************
@@ -224,22 +253,28 @@ SFCINF *p_sfcinf)
 static int encode_scale_factor_ldac(
 AC *p_ac)
 {
-    SFCINF a_sfcinf[LDAC_NSFCMODE];
     SFCINF *p_sfcinf;
     int nbits, sfc_mode;
+    int nqus = p_ac->p_ab->nqus;
     int a_nbits[LDAC_NSFCMODE];
 
-    if (p_ac->ich == 0) {
-        a_nbits[LDAC_MODE_0] = encode_scale_factor_0_ldac(p_ac, a_sfcinf+LDAC_MODE_0);
-        a_nbits[LDAC_MODE_1] = encode_scale_factor_1_ldac(p_ac, a_sfcinf+LDAC_MODE_1);
-    }
-    else {
-        a_nbits[LDAC_MODE_0] = encode_scale_factor_0_ldac(p_ac, a_sfcinf+LDAC_MODE_0);
-        a_nbits[LDAC_MODE_1] = encode_scale_factor_2_ldac(p_ac, a_sfcinf+LDAC_MODE_1);
+    /* Scale factors stay the same within a frame, so bits for all QU prefixes are cached */
+    if (nqus > p_ac->sfc_ncached) {
+        encode_scale_factor_0_ldac(p_ac, nqus, p_ac->aa_sfcinf[LDAC_MODE_0]);
+        if (p_ac->ich == 0) {
+            encode_scale_factor_1_ldac(p_ac, nqus, p_ac->aa_sfcinf[LDAC_MODE_1]);
+        }
+        else {
+            encode_scale_factor_2_ldac(p_ac, nqus, p_ac->aa_sfcinf[LDAC_MODE_1]);
+        }
+        p_ac->sfc_ncached = nqus;
     }
 
+    a_nbits[LDAC_MODE_0] = p_ac->aa_sfcinf[LDAC_MODE_0][nqus].nbits;
+    a_nbits[LDAC_MODE_1] = p_ac->aa_sfcinf[LDAC_MODE_1][nqus].nbits;
+
     p_ac->sfc_mode = sfc_mode = get_minimum_id_ldac(a_nbits, LDAC_MODE_1+1);
-    p_sfcinf = a_sfcinf + sfc_mode;
+    p_sfcinf = &p_ac->aa_sfcinf[sfc_mode][nqus];
     p_ac->sfc_bitlen = p_sfcinf->bitlen;
     p_ac->sfc_offset = p_sfcinf->offset;
     p_ac->sfc_weight = p_sfcinf->weight;
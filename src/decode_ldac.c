@@ -121,48 +121,5 @@ SFINFO *p_sfinfo)
     return;
 }
 
-/***************************************************************************************************
-    Decode Audio Block
-***************************************************************************************************/
-static void decode_audio_block_ldac(
-AB *p_ab)
-{
-    AC *p_ac;
-    int ich;
-    int nchs = p_ab->blk_nchs;
-
-    for (ich = 0; ich < nchs; ich++) {
-        p_ac = p_ab->ap_ac[ich];
-
-        clear_spectrum_ldac(p_ac, LDAC_MAXLSU);
-
-        dequant_spectrum_ldac(p_ac);
-
-        dequant_residual_ldac(p_ac);
-
-
-    }
-
-    return;
-}
-
-/***************************************************************************************************
-    Decode
-***************************************************************************************************/
-DECLFUNC void decode_ldac(
-SFINFO *p_sfinfo)
-{
-    AB *p_ab = p_sfinfo->p_ab;
-    int ibk;
-    int nbks = gaa_block_setting_ldac[p_sfinfo->cfg.chconfig_id][1];
-
-    for (ibk = 0; ibk < nbks; ibk++) {
-        decode_audio_block_ldac(p_ab);
-
-        p_ab++;
-    }
-
-    return;
-}
 #endif /* _ENCODE_ONLY */
 
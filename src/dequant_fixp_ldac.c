@@ -8,117 +8,166 @@
 
 #ifndef _ENCODE_ONLY
 
+#define LDAC_CONCEAL_DECAY 0x5a82799a /* Q31, _scalar(0.70710678) */
+
 /***************************************************************************************************
-    Subfunction: Dequantize Spectrum Core
+    Subfunction: Multiply and Shift for Dequantization
 ***************************************************************************************************/
-__inline static void dequant_spectrum_core_ldac(
-AC *p_ac,
-int iqu)
+__inline static INT32 mul_sftrnd_ldac(
+INT32 in1,
+INT32 in2,
+int shift)
 {
-    int i;
-    int isp = ga_isp_ldac[iqu];
-    int nsps = ga_nsps_ldac[iqu];
-    int shift = LDAC_Q_DEQUANT1 + LDAC_Q_NORM - p_ac->a_idsf[iqu];
-    int *p_qspec = p_ac->a_qspec+isp;
-    INT32 iqf = ga_iqf_ldac[p_ac->a_idwl1[iqu]];
-    INT32 *p_nspec = p_ac->p_acsub->a_spec+isp;
-
-    if (shift > 0){
-        for (i = 0; i < nsps; i++) {
-            /* Q31 <- Q00 * Q31 */
-            p_nspec[i] = mul_rsftrnd_ldac(p_qspec[i], iqf, shift);
-        }
-    }
-    else{
-        for (i = 0; i < nsps; i++) {
-            /* Q31 <- Q00 * Q31 */
-            p_nspec[i] = mul_lsftrnd_ldac(p_qspec[i], iqf, shift);
-        }
+    if (shift > 0) {
+        return mul_rsftrnd_ldac(in1, in2, shift);
     }
 
-    return;
+    return mul_lsftrnd_ldac(in1, in2, shift);
 }
 
 /***************************************************************************************************
     Dequantize Spectrum
 ***************************************************************************************************/
 DECLFUNC void dequant_spectrum_ldac(
-AC *p_ac)
+AC *p_ac,
+int iqu,
+int *p_qspec)
 {
-    int iqu;
-    int nqus = p_ac->p_ab->nqus;
+    int i;
+    int nsps = ga_nsps_ldac[iqu];
+    int shift = LDAC_Q_DEQUANT1 + LDAC_Q_NORM - p_ac->a_idsf[iqu];
+    INT32 iqf = ga_iqf_ldac[p_ac->a_idwl1[iqu]];
+    INT32 *p_nspec = p_ac->p_acsub->a_spec+ga_isp_ldac[iqu];
 
-    for (iqu = 0; iqu < nqus; iqu++) {
-        dequant_spectrum_core_ldac(p_ac, iqu);
+    if (p_ac->gain != LDAC_GAIN_UNITY) {
+        /* Q31 <- Q31 * Q30 */
+        iqf = mul_rsftrnd_ldac(iqf, p_ac->gain, LDAC_Q_GAIN);
+    }
+
+    for (i = 0; i < nsps; i++) {
+        /* Q31 <- Q00 * Q31 */
+        p_nspec[i] = mul_sftrnd_ldac(p_qspec[i], iqf, shift);
     }
 
     return;
 }
 
 /***************************************************************************************************
-    Subfunction: Dequantize Residual Spectrum Core
+    Dequantize Spectrum and Residual Spectrum
 ***************************************************************************************************/
-static void dequant_residual_core_ldac(
+DECLFUNC void dequant_spectrum_residual_ldac(
 AC *p_ac,
-int iqu)
+int iqu,
+int *p_qspec,
+int *p_rspec)
 {
     int i;
-    int isp = ga_isp_ldac[iqu];
     int nsps = ga_nsps_ldac[iqu];
-    int shift = LDAC_Q_DEQUANT3 + LDAC_Q_NORM - p_ac->a_idsf[iqu];
-    int *p_rspec = p_ac->a_rspec+isp;
+    int shift = LDAC_Q_DEQUANT1 + LDAC_Q_NORM - p_ac->a_idsf[iqu];
+    int rshift = LDAC_Q_DEQUANT3 + LDAC_Q_NORM - p_ac->a_idsf[iqu];
     INT32 rnspec;
-    INT32 iqf = ga_iqf_ldac[p_ac->a_idwl2[iqu]];
+    INT32 iqf = ga_iqf_ldac[p_ac->a_idwl1[iqu]];
+    INT32 riqf = ga_iqf_ldac[p_ac->a_idwl2[iqu]];
     INT32 rsf = ga_rsf_ldac[LDAC_MAXIDWL1];
-    INT32 *p_nspec = p_ac->p_acsub->a_spec+isp;
-
-    if (shift > 0){
-        for (i = 0; i < nsps; i++) {
-            /* Q31 <- Q00 * Q31 */
-            rnspec = mul_lsftrnd_ldac(p_rspec[i], iqf, LDAC_Q_DEQUANT2);
-            /* Q31 <- Q31 * Q31 */
-            p_nspec[i] += mul_rsftrnd_ldac(rnspec, rsf, shift);
-        }
+    INT32 *p_nspec = p_ac->p_acsub->a_spec+ga_isp_ldac[iqu];
+
+    if (p_ac->gain != LDAC_GAIN_UNITY) {
+        /* Q31 <- Q31 * Q30 */
+        iqf = mul_rsftrnd_ldac(iqf, p_ac->gain, LDAC_Q_GAIN);
+        riqf = mul_rsftrnd_ldac(riqf, p_ac->gain, LDAC_Q_GAIN);
     }
-    else{
-        for (i = 0; i < nsps; i++) {
-            /* Q31 <- Q00 * Q31 */
-            rnspec = mul_lsftrnd_ldac(p_rspec[i], iqf, LDAC_Q_DEQUANT2);
-            /* Q31 <- Q31 * Q31 */
-            p_nspec[i] += mul_lsftrnd_ldac(rnspec, rsf, shift);
-        }
+
+    for (i = 0; i < nsps; i++) {
+        /* Q31 <- Q00 * Q31 */
+        rnspec = mul_lsftrnd_ldac(p_rspec[i], riqf, LDAC_Q_DEQUANT2);
+        /* Q31 <- Q00 * Q31 + Q31 * Q31 */
+        p_nspec[i] = mul_sftrnd_ldac(p_qspec[i], iqf, shift)
+                + mul_sftrnd_ldac(rnspec, rsf, rshift);
     }
 
     return;
 }
 
 /***************************************************************************************************
-    Dequantize Residual Spectrum
+    Clear Spectrum
+***************************************************************************************************/
+DECLFUNC void clear_spectrum_ldac(
+AC *p_ac,
+int isp)
+{
+    clear_data_ldac(p_ac->p_acsub->a_spec+isp, (LDAC_MAXLSU-isp)*sizeof(INT32));
+
+    return;
+}
+
+/***************************************************************************************************
+    Hold Spectrum for Concealment
 ***************************************************************************************************/
-DECLFUNC void dequant_residual_ldac(
+DECLFUNC void hold_spectrum_ldac(
 AC *p_ac)
 {
-    int iqu;
-    int nqus = p_ac->p_ab->nqus;
-    int *p_idwl2 = p_ac->a_idwl2;
+    copy_data_ldac(p_ac->p_acsub->a_spec, p_ac->p_acsub->a_cspec, LDAC_MAXLSU*sizeof(INT32));
+
+    return;
+}
 
-    for (iqu = 0; iqu < nqus; iqu++) {
-        if (p_idwl2[iqu] > 0) {
-            dequant_residual_core_ldac(p_ac, iqu);
+/***************************************************************************************************
+    Conceal Spectrum
+***************************************************************************************************/
+DECLFUNC void conceal_spectrum_ldac(
+AC *p_ac,
+int nsps,
+UINT32 *p_seed)
+{
+    int i;
+    UINT32 seed = *p_seed;
+    INT32 *p_cspec = p_ac->p_acsub->a_cspec;
+    INT32 *p_nspec = p_ac->p_acsub->a_spec;
+
+    /* Repeat the held spectrum with decay and random signs */
+    for (i = 0; i < nsps; i++) {
+        p_cspec[i] = mul_rsftrnd_ldac(p_cspec[i], LDAC_CONCEAL_DECAY, 31);
+        seed = seed * 1664525 + 1013904223;
+        if (seed & 0x80000000) {
+            p_nspec[i] = -p_cspec[i];
+        }
+        else {
+            p_nspec[i] = p_cspec[i];
         }
     }
 
+    *p_seed = seed;
+
     return;
 }
 
 /***************************************************************************************************
-    Clear Spectrum
+    Mix Spectrum
 ***************************************************************************************************/
-DECLFUNC void clear_spectrum_ldac(
+DECLFUNC void mix_spectrum_ldac(
 AC *p_ac,
-int nsps)
+int imix)
 {
-    clear_data_ldac(p_ac->p_acsub->a_spec, nsps*sizeof(INT32));
+    int i;
+    INT64 val;
+    INT32 *p_mspec = p_ac->p_acsub->a_mspec;
+    INT32 *p_nspec = p_ac->p_acsub->a_spec;
+
+    if (imix == 0) {
+        copy_data_ldac(p_nspec, p_mspec, LDAC_MAXLSU*sizeof(INT32));
+        return;
+    }
+
+    for (i = 0; i < LDAC_MAXLSU; i++) {
+        val = (INT64)p_mspec[i] + p_nspec[i];
+        if (val > LDAC_MAX_32BIT) {
+            val = LDAC_MAX_32BIT;
+        }
+        else if (val < LDAC_MIN_32BIT) {
+            val = LDAC_MIN_32BIT;
+        }
+        p_mspec[i] = (INT32)val;
+    }
 
     return;
 }
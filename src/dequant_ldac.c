@@ -8,20 +8,25 @@
 
 #ifndef _ENCODE_ONLY
 
+#define LDAC_CONCEAL_DECAY _scalar(0.70710678)
+
 /***************************************************************************************************
-    Subfunction: Dequantize Spectrum Core
+    Dequantize Spectrum
 ***************************************************************************************************/
-__inline static void dequant_spectrum_core_ldac(
+DECLFUNC void dequant_spectrum_ldac(
 AC *p_ac,
-int iqu)
+int iqu,
+int *p_qspec)
 {
     int i;
-    int isp = ga_isp_ldac[iqu];
     int nsps = ga_nsps_ldac[iqu];
-    int *p_qspec = p_ac->a_qspec+isp;
-    SCALAR *p_nspec = p_ac->p_acsub->a_spec+isp;
+    SCALAR *p_nspec = p_ac->p_acsub->a_spec+ga_isp_ldac[iqu];
     SCALAR iqf = ga_iqf_ldac[p_ac->a_idwl1[iqu]] * ga_sf_ldac[p_ac->a_idsf[iqu]];
 
+    if (p_ac->gain != LDAC_GAIN_UNITY) {
+        iqf *= p_ac->gain * (_scalar(1.0) / LDAC_GAIN_UNITY);
+    }
+
     for (i = 0; i < nsps; i++) {
         p_nspec[i] = p_qspec[i] * iqf;
     }
@@ -30,70 +35,105 @@ int iqu)
 }
 
 /***************************************************************************************************
-    Dequantize Spectrum
+    Dequantize Spectrum and Residual Spectrum
 ***************************************************************************************************/
-DECLFUNC void dequant_spectrum_ldac(
-AC *p_ac)
+DECLFUNC void dequant_spectrum_residual_ldac(
+AC *p_ac,
+int iqu,
+int *p_qspec,
+int *p_rspec)
 {
-    int iqu;
-    int nqus = p_ac->p_ab->nqus;
+    int i;
+    int nsps = ga_nsps_ldac[iqu];
+    SCALAR *p_nspec = p_ac->p_acsub->a_spec+ga_isp_ldac[iqu];
+    SCALAR iqf = ga_iqf_ldac[p_ac->a_idwl1[iqu]] * ga_sf_ldac[p_ac->a_idsf[iqu]];
+    SCALAR irqsf = ga_iqf_ldac[p_ac->a_idwl2[iqu]] * ga_rsf_ldac[LDAC_MAXIDWL1]
+            * ga_sf_ldac[p_ac->a_idsf[iqu]];
+
+    if (p_ac->gain != LDAC_GAIN_UNITY) {
+        iqf *= p_ac->gain * (_scalar(1.0) / LDAC_GAIN_UNITY);
+        irqsf *= p_ac->gain * (_scalar(1.0) / LDAC_GAIN_UNITY);
+    }
 
-    for (iqu = 0; iqu < nqus; iqu++) {
-        dequant_spectrum_core_ldac(p_ac, iqu);
+    for (i = 0; i < nsps; i++) {
+        p_nspec[i] = p_qspec[i] * iqf + p_rspec[i] * irqsf;
     }
 
     return;
 }
 
 /***************************************************************************************************
-    Subfunction: Dequantize Residual Spectrum Core
+    Clear Spectrum
 ***************************************************************************************************/
-static void dequant_residual_core_ldac(
+DECLFUNC void clear_spectrum_ldac(
 AC *p_ac,
-int iqu)
+int isp)
 {
-    int i;
-    int isp = ga_isp_ldac[iqu];
-    int nsps = ga_nsps_ldac[iqu];
-    int *p_rspec = p_ac->a_rspec+isp;
-    SCALAR *p_nspec = p_ac->p_acsub->a_spec+isp;
-    SCALAR irqsf = ga_iqf_ldac[p_ac->a_idwl2[iqu]] * ga_rsf_ldac[LDAC_MAXIDWL1]
-            * ga_sf_ldac[p_ac->a_idsf[iqu]];
-
-    for (i = 0; i < nsps; i++) {
-        p_nspec[i] += p_rspec[i] * irqsf;
-    }
+    clear_data_ldac(p_ac->p_acsub->a_spec+isp, (LDAC_MAXLSU-isp)*sizeof(SCALAR));
 
     return;
 }
 
 /***************************************************************************************************
-    Dequantize Residual Spectrum
+    Hold Spectrum for Concealment
 ***************************************************************************************************/
-DECLFUNC void dequant_residual_ldac(
+DECLFUNC void hold_spectrum_ldac(
 AC *p_ac)
 {
-    int iqu;
-    int nqus = p_ac->p_ab->nqus;
-    int *p_idwl2 = p_ac->a_idwl2;
+    copy_data_ldac(p_ac->p_acsub->a_spec, p_ac->p_acsub->a_cspec, LDAC_MAXLSU*sizeof(SCALAR));
+
+    return;
+}
+
+/***************************************************************************************************
+    Conceal Spectrum
+***************************************************************************************************/
+DECLFUNC void conceal_spectrum_ldac(
+AC *p_ac,
+int nsps,
+UINT32 *p_seed)
+{
+    int i;
+    UINT32 seed = *p_seed;
+    SCALAR *p_cspec = p_ac->p_acsub->a_cspec;
+    SCALAR *p_nspec = p_ac->p_acsub->a_spec;
 
-    for (iqu = 0; iqu < nqus; iqu++) {
-        if (p_idwl2[iqu] > 0) {
-            dequant_residual_core_ldac(p_ac, iqu);
+    /* Repeat the held spectrum with decay and random signs */
+    for (i = 0; i < nsps; i++) {
+        p_cspec[i] = p_cspec[i] * LDAC_CONCEAL_DECAY;
+        seed = seed * 1664525 + 1013904223;
+        if (seed & 0x80000000) {
+            p_nspec[i] = -p_cspec[i];
+        }
+        else {
+            p_nspec[i] = p_cspec[i];
         }
     }
 
+    *p_seed = seed;
+
     return;
 }
 
 /***************************************************************************************************
-    Clear Spectrum
+    Mix Spectrum
 ***************************************************************************************************/
-DECLFUNC void clear_spectrum_ldac(
+DECLFUNC void mix_spectrum_ldac(
 AC *p_ac,
-int nsps)
+int imix)
 {
-    clear_data_ldac(p_ac->p_acsub->a_spec, nsps*sizeof(SCALAR));
+    int i;
+    SCALAR *p_mspec = p_ac->p_acsub->a_mspec;
+    SCALAR *p_nspec = p_ac->p_acsub->a_spec;
+
+    if (imix == 0) {
+        copy_data_ldac(p_nspec, p_mspec, LDAC_MAXLSU*sizeof(SCALAR));
+        return;
+    }
+
+    for (i = 0; i < LDAC_MAXLSU; i++) {
+        p_mspec[i] += p_nspec[i];
+    }
 
     return;
 }
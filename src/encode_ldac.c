@@ -77,6 +77,7 @@ SFINFO *p_sfinfo)
         p_ab->blk_type = blk_type = gaa_block_setting_ldac[chconfig_id][ibk+2];
         p_ab->blk_nchs = blk_nchs = get_block_nchs_ldac(blk_type);
         p_ab->p_smplrate_id = &p_cfg->smplrate_id;
+        p_ab->p_frame_status = &p_cfg->frame_status;
         p_ab->p_error_code = &p_sfinfo->error_code;
 
         /* Set AC Information */
@@ -85,6 +86,9 @@ SFINFO *p_sfinfo)
             p_ab->ap_ac[ich]->p_ab = p_ab;
             p_ab->ap_ac[ich]->ich = ich;
             p_ab->ap_ac[ich]->frmana_cnt = 0;
+            p_ab->ap_ac[ich]->zero_cross = 0;
+            p_ab->ap_ac[ich]->low_energy = 0;
+            p_ab->ap_ac[ich]->centroid = 0;
         }
 
         p_ab++;
@@ -121,6 +125,7 @@ SFINFO *p_sfinfo)
             nbits_ab = (nbits_ac / LDAC_BYTESIZE) * LDAC_BYTESIZE;
         }
         p_ab->nbits_ab = nbits_ab;
+        p_ab->prev_nbands = 0;
 
         p_ab++;
     }
@@ -172,18 +177,20 @@ AB *p_ab)
         p_ac = p_ab->ap_ac[ich];
 
         norm_spectrum_ldac(p_ac);
+        p_ac->sfc_ncached = 0;
     }
 
     if (!alloc_bits_ldac(p_ab)) {
         return LDAC_FALSE;
     }
 
-    for (ich = 0; ich < nchs; ich++) {
-        p_ac = p_ab->ap_ac[ich];
+    /* In fused packing mode, the spectrum is quantized by pack_spectrum_ldac() */
+    if (p_ab->pack_mode == LDAC_PACKMODE_REFERENCE) {
+        for (ich = 0; ich < nchs; ich++) {
+            p_ac = p_ab->ap_ac[ich];
 
-        quant_spectrum_ldac(p_ac);
-
-        quant_residual_ldac(p_ac);
+            quant_spectrum_ldac(p_ac);
+        }
     }
 
     return LDAC_TRUE;
@@ -200,7 +207,10 @@ int grad_qu_l,
 int grad_qu_h,
 int grad_os_l,
 int grad_os_h,
-int abc_status)
+int abc_status,
+int warm_start,
+int complexity,
+int pack_mode)
 {
     AB *p_ab = p_sfinfo->p_ab;
     int ibk;
@@ -215,6 +225,9 @@ int abc_status)
         p_ab->grad_os_l = grad_os_l;
         p_ab->grad_os_h = grad_os_h;
         p_ab->abc_status = abc_status;
+        p_ab->warm_start = warm_start;
+        p_ab->complexity = complexity;
+        p_ab->pack_mode = pack_mode;
 
         if (!encode_audio_block_ldac(p_ab)) {
             return LDAC_ERR_NON_FATAL_ENCODE;
@@ -51,7 +51,9 @@ DECLFUNC INT32 sftrnd_ldac(INT32, int);
 #define mul_rsftrnd_ldac(x, y, n) (INT32)((((INT64)(x) * (INT64)(y)) + ((INT64)1 << ((n)-1))) >> (n))
 
 DECLFUNC int get_bit_length_ldac(INT32);
+#ifndef _ENCODE_ONLY
 DECLFUNC INT32 get_absmax_ldac(INT32 *, int);
+#endif /* _ENCODE_ONLY */
 
 #endif /* _FIXP_LDAC_H */
 
@@ -54,6 +54,7 @@ INT32 val)
     return len;
 }
 
+#ifndef _ENCODE_ONLY
 /*******************************************************************************
     Get Maximum Absolute Value
 *******************************************************************************/
@@ -74,4 +75,5 @@ int num)
 
     return abmax;
 }
+#endif /* _ENCODE_ONLY */
 
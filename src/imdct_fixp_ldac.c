@@ -25,15 +25,26 @@ int nlnn)
     INT32 a_work[LDAC_MAXLSU];
     INT32 a_work2[LDAC_MAXLSU];
     INT32 g0, g1, g2, g3;
+    INT32 absmax;
 
-    i = nlnn - LDAC_1FSLNN;
+    i = nlnn - LDAC_MINLNN;
     p_w = gaa_bwin_ldac[i];
     p_c = gaa_wcos_ldac[i];
     p_s = gaa_wsin_ldac[i];
     p_p = gaa_perm_ldac[i];
 
+    /* Zero Spectrum: Output Only the Overlapped Part */
+    absmax = get_absmax_ldac(p_y, nsmpl);
+    if (absmax == 0) {
+        for (i = 0; i < nsmpl; i++) {
+            p_x[i] = p_x[nsmpl+i];
+            p_x[nsmpl+i] = 0;
+        }
+        return;
+    }
+
     /* Block Floating */
-    shift = LDAC_C_BLKFLT - get_bit_length_ldac(get_absmax_ldac(p_y, nsmpl)) - 1;
+    shift = LDAC_C_BLKFLT - get_bit_length_ldac(absmax) - 1;
     if (shift <= 0) {
         shift = 0;
         for (i = 0; i < nsmpl; i++) {
@@ -26,12 +26,29 @@ int nlnn)
     SCALAR a, b, c, d;
     SCALAR cc, cs;
 
-    i = nlnn - LDAC_1FSLNN;
+    i = nlnn - LDAC_MINLNN;
     p_w = gaa_bwin_ldac[i];
     p_c = gaa_wcos_ldac[i];
     p_s = gaa_wsin_ldac[i];
     p_p = gaa_rev_perm_ldac[i];
 
+    /* Zero Spectrum: Output Only the Overlapped Part */
+    for (i = 0; i < nsmpl; i++) {
+        if (p_y[i] != 0) {
+            break;
+        }
+    }
+    if (i == nsmpl) {
+        for (i = 0; i < nsmpl>>1; i++) {
+            p_x[i] = -p_x[nsmpl+i] * p_w[nsmpl-1-i];
+            p_x[nsmpl/2+i] = -p_x[nsmpl+nsmpl/2+i] * p_w[nsmpl/2-1-i];
+
+            p_x[nsmpl+i] = 0;
+            p_x[nsmpl+nsmpl/2+i] = 0;
+        }
+        return;
+    }
+
     /* Butterfly 1st Stage & Reorder */
     coef = 0;
     loop1 = nsmpl / 4;
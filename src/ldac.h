@@ -61,14 +61,19 @@
 #define LDAC_NFRAME            2
 #define LDAC_NSFTSTEP          5
 /** Frame Samples (log base 2 of) **/
-#define LDAC_NUMLNN            2
+#define LDAC_NUMLNN            4
 #define LDAC_MAXLNN            8
+#define LDAC_MINLNN            5
 #define LDAC_2FSLNN            8
 #define LDAC_1FSLNN            7
+#define LDAC_HFSLNN            6
+#define LDAC_QFSLNN            5
 /** Frame Samples **/
 #define LDAC_MAXLSU (1<<LDAC_MAXLNN)
 #define LDAC_2FSLSU (1<<LDAC_2FSLNN)
 #define LDAC_1FSLSU (1<<LDAC_1FSLNN)
+#define LDAC_HFSLSU (1<<LDAC_HFSLNN)
+#define LDAC_QFSLSU (1<<LDAC_QFSLNN)
 /** Band **/
 #define LDAC_MAXNBANDS        16
 #define LDAC_2FSNBANDS        16
@@ -84,6 +89,13 @@
 #define LDAC_NSP_LOWENERGY    12
 #define LDAC_TH_ZCROSNUM      90
 #define LDAC_MAXCNT_FRMANA    10
+/** Packet Loss Concealment **/
+#define LDAC_MAXNCONCEAL       8
+#define LDAC_CONCEALSEED 0x4c444143
+/** Decoder Gain **/
+#define LDAC_Q_GAIN           30
+#define LDAC_GAIN_UNITY  (1<<LDAC_Q_GAIN)
+#define LDAC_GAINSTEP    (LDAC_GAIN_UNITY/8)
 
 /* Stream Syntax */
 #define LDAC_BLKID_MONO        0
@@ -118,11 +130,15 @@
 #define LDAC_MAXSFCBLEN_1      5
 #define LDAC_MINSFCBLEN_2      2
 #define LDAC_MAXSFCBLEN_2      5
+#define LDAC_SFCMDECBITS      10
+#define LDAC_SFCMDECNCODES     4
 /** Spectrum/Residual Data **/
 #define LDAC_NIDWL            16
 #define LDAC_MINIDWL1          1
 #define LDAC_MAXIDWL1         15
 #define LDAC_MAXIDWL2         15
+#define LDAC_NIDWLS           31
+#define LDAC_NIDSP             4
 #define LDAC_2DIMSPECBITS      3
 #define LDAC_N2DIMSPECENCTBL  16
 #define LDAC_N2DIMSPECDECTBL   8
@@ -154,6 +170,7 @@ typedef struct _config_info_ldac CFG;
 typedef struct _audio_block_ldac AB;
 typedef struct _audio_channel_ldac AC;
 typedef struct _audio_channel_sub_ldac ACSUB;
+typedef struct _sfc_info_ldac SFCINF;
 
 /* Configuration Information Structure */
 struct _config_info_ldac {
@@ -170,23 +187,40 @@ struct _config_info_ldac {
 struct _audio_channel_sub_ldac {
     SCALAR a_time[LDAC_MAXLSU*LDAC_NFRAME];
     SCALAR a_spec[LDAC_MAXLSU];
+    SCALAR a_cspec[LDAC_MAXLSU];
+    SCALAR a_mspec[LDAC_MAXLSU];
 };
 #else /* _32BIT_FIXED_POINT */
 struct _audio_channel_sub_ldac {
     INT32 a_time[LDAC_MAXLSU*LDAC_NFRAME];
     INT32 a_spec[LDAC_MAXLSU];
+    INT32 a_cspec[LDAC_MAXLSU];
+    INT32 a_mspec[LDAC_MAXLSU];
 };
 #endif /* _32BIT_FIXED_POINT */
 
+/* Scale Factor Coding Information Structure */
+struct _sfc_info_ldac {
+    int nbits;
+    int bitlen;
+    int offset;
+    int weight;
+};
+
 /* Audio Channel (AC) Structure */
 struct _audio_channel_ldac {
     int ich;
     int frmana_cnt;
+    int zero_cross;
+    int low_energy;
+    int centroid;
     int ext_size;
     int sfc_mode;
     int sfc_bitlen;
     int sfc_offset;
     int sfc_weight;
+    int sfc_ncached;
+    SFCINF aa_sfcinf[LDAC_NSFCMODE][LDAC_MAXNQUS+1];
     int a_idsf[LDAC_MAXNQUS];
     int a_idwl1[LDAC_MAXNQUS];
     int a_idwl2[LDAC_MAXNQUS];
@@ -194,6 +228,9 @@ struct _audio_channel_ldac {
     int a_tmp[LDAC_MAXNQUS];
     int a_qspec[LDAC_MAXLSU];
     int a_rspec[LDAC_MAXLSU];
+    int gain;
+    int skip_residual;
+    int nqus_limit;
     AB *p_ab;
     ACSUB *p_acsub;
 };
@@ -221,7 +258,18 @@ struct _audio_block_ldac {
     int nbits_spec;
     int nbits_avail;
     int nbits_used;
+    int complexity;
+    int pack_mode;
+    int warm_start;
+    int prev_nbands;
+    int prev_grad_qu_l;
+    int prev_grad_os_l;
+    int prev_grad_os_h;
+    int prev_nadjqus;
+    int prev_nbits_spec;
+    int prev_frame_status;
     int *p_smplrate_id;
+    int *p_frame_status;
     int *p_error_code;
     AC  *ap_ac[2];
 };
@@ -245,6 +293,17 @@ typedef struct _handle_ldac_struct {
     int grad_os_l;
     int grad_os_h;
     int abc_status;
+    int warm_start;
+    int complexity;
+    int pack_mode;
+    int ana_cnt;
+    int nconceal;
+    UINT32 conceal_seed;
+    int a_gain[LDAC_MAXNCH];
+    int a_gain_target[LDAC_MAXNCH];
+    int dec_quality;
+    int dec_nqus;
+    int nqus_nlnn;
     int error_code;
     SFINFO sfinfo;
 } HANDLE_LDAC_STRUCT;
@@ -256,6 +315,15 @@ typedef struct {
 } HC;
 
 #ifndef _DECODE_ONLY
+/* Bit Writer Structure */
+typedef struct _bit_writer_ldac BITWR;
+struct _bit_writer_ldac {
+    UINT64 acc;
+    int nacc;
+    int loc;
+    STREAM *p_pos;
+};
+
 /* Huffman Encoding Structure */
 typedef struct _hcenc_ldac HCENC;
 struct _hcenc_ldac {
@@ -267,6 +335,16 @@ struct _hcenc_ldac {
 #endif /* _DECODE_ONLY */
 
 #ifndef _ENCODE_ONLY
+/* Bit Reader Structure */
+typedef struct _bit_reader_ldac BITRD;
+struct _bit_reader_ldac {
+    UINT64 acc;
+    int nacc;
+    int loc;
+    STREAM *p_pos;
+    STREAM *p_end;
+};
+
 /* Huffman Decoding Structure */
 typedef struct _hcdec_ldac HCDEC;
 struct _hcdec_ldac {
@@ -276,6 +354,7 @@ struct _hcdec_ldac {
     unsigned char mask;
     unsigned char maxlen;
     const unsigned char *p_dec;
+    const UINT32 *p_mdec;
 };
 #endif /* _ENCODE_ONLY */
 
@@ -21,6 +21,9 @@ LDACBT_API HANDLE_LDAC_BT ldacBT_get_handle( void )
     HANDLE_LDAC_BT hLdacBT;
     hLdacBT = (HANDLE_LDAC_BT)malloc( sizeof(STRUCT_LDACBT_HANDLE) );
     if( hLdacBT == NULL ){ return NULL; }
+#ifndef _ENCODE_ONLY
+    hLdacBT->p_jb = NULL;
+#endif
 
     /* Get ldaclib Handler */
     if( (hLdacBT->hLDAC = ldaclib_get_handle()) == NULL ){
@@ -53,6 +56,13 @@ LDACBT_API void ldacBT_free_handle( HANDLE_LDAC_BT hLdacBT )
         ldaclib_free_handle( hLdacBT->hLDAC );
         hLdacBT->hLDAC = NULL;
     }
+#ifndef _ENCODE_ONLY
+    /* free jitter buffer */
+    if( hLdacBT->p_jb != NULL ){
+        free( hLdacBT->p_jb );
+        hLdacBT->p_jb = NULL;
+    }
+#endif
     /* free ldacbt handle */
     free( hLdacBT );
 }
@@ -294,6 +304,16 @@ LDACBT_API int ldacBT_init_handle_encode( HANDLE_LDAC_BT hLdacBT, int mtu, int e
         hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
     }
 
+    /* reset encoder complexity level, packing mode, warm start, governor and feature callback */
+    ldaclib_set_encode_complexity(hLdacBT->hLDAC, LDACBT_COMPLEXITY_DEFAULT);
+    ldaclib_set_encode_pack_mode(hLdacBT->hLDAC, LDACBT_PACKMODE_FUSED);
+    ldaclib_set_encode_warm_start(hLdacBT->hLDAC, 0);
+    hLdacBT->complexity = LDACBT_COMPLEXITY_DEFAULT;
+    hLdacBT->gov_clock = NULL;
+    hLdacBT->gov_ctx = NULL;
+    hLdacBT->feature_func = NULL;
+    hLdacBT->feature_ctx = NULL;
+
     /* reset target eqmid as current setting */
     hLdacBT->tgt_eqmid = hLdacBT->eqmid;
     hLdacBT->tgt_nfrm_in_pkt = hLdacBT->tx.nfrm_in_pkt;
@@ -364,6 +384,122 @@ LDACBT_API int  ldacBT_alter_eqmid_priority( HANDLE_LDAC_BT hLdacBT, int priorit
     return LDACBT_S_OK;
 }
 
+/* Set encoder complexity level */
+LDACBT_API int ldacBT_set_complexity( HANDLE_LDAC_BT hLdacBT, int level )
+{
+    LDAC_RESULT result;
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_ENCODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+
+    result = ldaclib_set_encode_complexity( hLdacBT->hLDAC, level );
+    if( LDAC_FAILED(result) ){
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+    hLdacBT->complexity = level;
+    hLdacBT->gov_hold = 0;
+    hLdacBT->gov_raise = 0;
+    return LDACBT_S_OK;
+}
+
+/* Get current encoder complexity level */
+LDACBT_API int ldacBT_get_complexity( HANDLE_LDAC_BT hLdacBT )
+{
+    int level;
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_ENCODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+
+    if( LDAC_FAILED(ldaclib_get_encode_complexity( hLdacBT->hLDAC, &level )) ){
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+    return level;
+}
+
+/* Set deadline governor of encoder complexity level */
+LDACBT_API int ldacBT_set_deadline_governor( HANDLE_LDAC_BT hLdacBT, LDACBT_CLOCK_FUNC clock_func,
+                                             void *p_ctx, int load )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_ENCODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+
+    if( clock_func == NULL ){
+        /* disable governor and restore the configured level */
+        hLdacBT->gov_clock = NULL;
+        hLdacBT->gov_ctx = NULL;
+        ldaclib_set_encode_complexity( hLdacBT->hLDAC, hLdacBT->complexity );
+        return LDACBT_S_OK;
+    }
+    if( (load < 1) || (load > 100) ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+
+    hLdacBT->gov_clock = clock_func;
+    hLdacBT->gov_ctx = p_ctx;
+    hLdacBT->gov_load = load;
+    hLdacBT->gov_avg = 0;
+    hLdacBT->gov_hold = LDACBT_GOV_HOLD_FRAMES;
+    hLdacBT->gov_raise = 0;
+    return LDACBT_S_OK;
+}
+
+/* Set callback for signal analysis features */
+LDACBT_API int ldacBT_set_feature_callback( HANDLE_LDAC_BT hLdacBT, LDACBT_FEATURE_FUNC feature_func,
+                                            void *p_ctx )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_ENCODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+
+    hLdacBT->feature_func = feature_func;
+    hLdacBT->feature_ctx = (feature_func != NULL) ? p_ctx : NULL;
+    return LDACBT_S_OK;
+}
+
+/* Set encoder packing mode */
+LDACBT_API int ldacBT_set_pack_mode( HANDLE_LDAC_BT hLdacBT, int mode )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_ENCODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+
+    if( LDAC_FAILED(ldaclib_set_encode_pack_mode( hLdacBT->hLDAC, mode )) ){
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+    return LDACBT_S_OK;
+}
+
+/* Set warm start of encoder bit allocation */
+LDACBT_API int ldacBT_set_warm_start( HANDLE_LDAC_BT hLdacBT, int enable )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_ENCODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+
+    if( LDAC_FAILED(ldaclib_set_encode_warm_start( hLdacBT->hLDAC, enable )) ){
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+    return LDACBT_S_OK;
+}
+
 /* LDAC encode proccess */
 LDACBT_API int ldacBT_encode( HANDLE_LDAC_BT hLdacBT, void *p_pcm, int *pcm_used,
                           unsigned char *p_stream, int *stream_sz, int *frame_num )
@@ -547,6 +683,7 @@ LDACBT_API int ldacBT_encode( HANDLE_LDAC_BT hLdacBT, void *p_pcm, int *pcm_used
     /* Encode Frame */
     if( ppcmring->nsmpl > 0 ){
         char *p_pcm_ring_r;
+        unsigned int clk_start = 0;
         int nsmpl_to_clr;
         nsmpl_to_clr = hLdacBT->frm_samples - ppcmring->nsmpl;
         if( nsmpl_to_clr > 0 ){
@@ -568,9 +705,19 @@ LDACBT_API int ldacBT_encode( HANDLE_LDAC_BT hLdacBT, void *p_pcm, int *pcm_used
         }
         p_pcm_ring_r = ppcmring->buf + ppcmring->rp;
         ldacBT_prepare_pcm_encode( p_pcm_ring_r, hLdacBT->pp_pcm, hLdacBT->frm_samples, ch, fmt );
+        if( hLdacBT->gov_clock != NULL ){
+            clk_start = hLdacBT->gov_clock( hLdacBT->gov_ctx );
+        }
         result = ldaclib_encode(hLdacBT->hLDAC, hLdacBT->pp_pcm, (LDAC_SMPL_FMT_T)fmt,
                          p_ldac_transport_frame+LDACBT_FRMHDRBYTES, &frmlen_wrote);
+        if( hLdacBT->gov_clock != NULL ){
+            ldacBT_update_complexity_governor( hLdacBT,
+                    (int)(hLdacBT->gov_clock( hLdacBT->gov_ctx ) - clk_start) );
+        }
         if( !LDAC_FAILED(result) ){
+            if( hLdacBT->feature_func != NULL ){
+                ldacBT_notify_frame_features( hLdacBT );
+            }
             ppcmring->rp += hLdacBT->frm_samples * wl * ch;
             ppcmring->nsmpl -= hLdacBT->frm_samples;
             if( ppcmring->rp >= LDACBT_ENC_PCM_BUF_SZ ){ ppcmring->rp = 0; }
@@ -723,6 +870,7 @@ LDACBT_API int ldacBT_init_handle_decode( HANDLE_LDAC_BT hLdacBT, int cm, int sf
         hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE; /* fatal */
         return LDACBT_E_FAIL;
     }
+    hLdacBT->frm_samples = LDACBT_SHIFT_FRM_SAMPLES( hLdacBT->frm_samples, nshift );
     return LDACBT_S_OK;
 }
 
@@ -731,9 +879,93 @@ LDACBT_API int ldacBT_init_handle_decode( HANDLE_LDAC_BT hLdacBT, int cm, int sf
 /* LDAC decode proccess */
 LDACBT_API int ldacBT_decode( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs, unsigned char *p_pcm,
                               LDACBT_SMPL_FMT_T fmt, int bs_bytes, int *used_bytes, int *wrote_bytes )
+{
+    int updated;
+
+    /* check arguments */
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( p_pcm == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+
+    /* Decode Frame into the work buffer */
+    if( ldacBT_decode_frame( hLdacBT, p_bs, NULL, fmt, bs_bytes, used_bytes, wrote_bytes,
+                             NULL, NULL, NULL, &updated ) != LDACBT_S_OK ){
+        return LDACBT_E_FAIL;
+    }
+
+    /* copy to output buffer */
+    *wrote_bytes = ldacBT_interleave_pcm( p_pcm, (const char**)hLdacBT->pp_pcm,
+                                          hLdacBT->frm_samples, hLdacBT->pcm.ch, fmt );
+
+    return updated ? LDACBT_E_FAIL : LDACBT_S_OK;
+}
+#endif /* _ENCODE_ONLY */
+#ifndef _ENCODE_ONLY
+/* Set output gain of decoder */
+LDACBT_API int ldacBT_set_decode_gain( HANDLE_LDAC_BT hLdacBT, int ch, int gain )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->hLDAC == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( LDAC_FAILED(ldaclib_set_decode_gain( hLdacBT->hLDAC, ch, gain )) ){
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+    return LDACBT_S_OK;
+}
+
+/* Set quality of decoder */
+LDACBT_API int ldacBT_set_decode_quality( HANDLE_LDAC_BT hLdacBT, int quality, int nqus )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->hLDAC == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( LDAC_FAILED(ldaclib_set_decode_quality( hLdacBT->hLDAC, quality, nqus )) ){
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+    return LDACBT_S_OK;
+}
+
+/* LDAC decode proccess with planar output */
+LDACBT_API int ldacBT_decode_planar( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs,
+                                     unsigned char *ap_pcm[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+                                     int *used_bytes, int *wrote_bytes )
+{
+    int updated;
+
+    /* check arguments */
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( ap_pcm == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+
+    /* Decode Frame into the buffers of the caller */
+    if( ldacBT_decode_frame( hLdacBT, p_bs, (char **)ap_pcm, fmt, bs_bytes, used_bytes, wrote_bytes,
+                             NULL, NULL, NULL, &updated ) != LDACBT_S_OK ){
+        return LDACBT_E_FAIL;
+    }
+    *wrote_bytes = hLdacBT->frm_samples * ldacBT_get_pcm_wl( fmt );
+
+    return updated ? LDACBT_E_FAIL : LDACBT_S_OK;
+}
+#endif /* _ENCODE_ONLY */
+#ifndef _ENCODE_ONLY
+/* LDAC decode proccess mixing frames of several streams */
+LDACBT_API int ldacBT_decode_mix( HANDLE_LDAC_BT hLdacBT, unsigned char *ap_bs[], int a_bs_bytes[],
+                                  int n_streams, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                  int a_used_bytes[], int *wrote_bytes )
 {
     LDAC_RESULT result;
-    int status, sfid, cm, cci, frmlen, frm_status;
+    int status, updated, istrm, nmix, sfid, cci, frmlen, frm_status;
+    unsigned char *p_bs;
 
     /* check arguments */
     if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
@@ -741,7 +973,148 @@ LDACBT_API int ldacBT_decode( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs, unsig
         hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
         return LDACBT_E_FAIL;
     }
-    if( ( p_bs == NULL ) ||
+    if( ( ap_bs == NULL ) ||
+        ( a_bs_bytes == NULL ) ||
+        ( p_pcm == NULL ) ||
+        ( a_used_bytes == NULL ) ||
+        ( wrote_bytes == NULL ) ||
+        ( n_streams < 1 ) || ( n_streams > LDACBT_MAX_NMIX )
+        ) {
+            hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+            return LDACBT_E_FAIL;
+    }
+    for( istrm = 0; istrm < n_streams; istrm++ ){
+        if( ap_bs[istrm] == NULL ){
+            hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+            return LDACBT_E_FAIL;
+        }
+        if( a_bs_bytes[istrm] < (LDACBT_FRMHDRBYTES+2) ){
+            hLdacBT->error_code_api = LDACBT_ERR_INPUT_BUFFER_SIZE;
+            return LDACBT_E_FAIL;
+        }
+        a_used_bytes[istrm] = 0;
+    }
+    if( (hLdacBT->error_code_api = ldacBT_assert_sample_format( fmt )) != LDACBT_ERR_NONE ){
+        return LDACBT_E_FAIL;
+    }
+
+    *wrote_bytes = 0;
+    status = LDACBT_S_OK;
+
+    /* Set up decoder from the Frame Header of the first stream */
+    if( ldacBT_setup_decode_frame( hLdacBT, ap_bs[0], &updated ) != LDACBT_S_OK ){
+        return LDACBT_E_FAIL;
+    }
+    if( updated ){
+        status = LDACBT_E_FAIL;
+    }
+
+    nmix = 0;
+    for( istrm = 0; istrm < n_streams; istrm++ ){
+        p_bs = ap_bs[istrm];
+        if( istrm > 0 ){
+            /* The other streams must share the configuration of the first one */
+            result = ldaclib_get_frame_header( hLdacBT->hLDAC, p_bs, &sfid, &cci, &frmlen, &frm_status);
+            if( LDAC_FAILED(result) ){
+                hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+                return LDACBT_E_FAIL;
+            }
+            if( sfid != hLdacBT->sfid ){
+                hLdacBT->error_code_api = LDACBT_ERR_CHECK_SAMPLING_FREQ;
+                return LDACBT_E_FAIL;
+            }
+            if( cci != hLdacBT->cci ){
+                hLdacBT->error_code_api = LDACBT_ERR_CHECK_CHANNEL_CONFIG;
+                return LDACBT_E_FAIL;
+            }
+            result = ldaclib_set_frame_info( hLdacBT->hLDAC, frmlen, frm_status );
+            if( LDAC_FAILED(result) ){
+                hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+                return LDACBT_E_FAIL;
+            }
+        }
+
+        /* Decode Frame up to the spectrum, and accumulate it */
+        result = ldaclib_decode_mix_frame( hLdacBT->hLDAC, p_bs+LDACBT_FRMHDRBYTES,
+                                           a_bs_bytes[istrm]-LDACBT_FRMHDRBYTES,
+                                           &a_used_bytes[istrm], istrm, &nmix );
+        if( LDAC_FAILED(result) ){
+            hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+            return LDACBT_E_FAIL;
+        }
+        a_used_bytes[istrm] += LDACBT_FRMHDRBYTES;
+    }
+
+    /* Synthesize the mixed spectra */
+    result = ldaclib_decode_mix_output( hLdacBT->hLDAC, hLdacBT->pp_pcm, (LDAC_SMPL_FMT_T)fmt, nmix );
+    if( LDAC_FAILED(result) ){
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+
+    /* update bitrate */
+    hLdacBT->bitrate = a_used_bytes[0] * hLdacBT->pcm.sf
+                       / LDACBT_SHIFT_FRM_SAMPLES( hLdacBT->frm_samples, -hLdacBT->nshift ) * 8 / 1000;
+    /* copy to output buffer */
+    *wrote_bytes = ldacBT_interleave_pcm( p_pcm, (const char**)hLdacBT->pp_pcm,
+                                          hLdacBT->frm_samples, hLdacBT->pcm.ch, fmt );
+
+    return status;
+}
+
+/* LDAC decode proccess up to the spectrum */
+LDACBT_API int ldacBT_decode_spectrum( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs,
+                                       unsigned char *ap_spec[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+                                       int *used_bytes, int *wrote_bytes,
+                                       int *ap_idsf[], int *ap_idwl[], int *p_nqus )
+{
+    int updated, ich;
+    int a_nqus[LDAC_PRCNCH];
+
+    /* check arguments */
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( ap_spec == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+    if( (fmt != LDACBT_SMPL_FMT_S32) && (fmt != LDACBT_SMPL_FMT_F32) ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_SMPL_FORMAT;
+        return LDACBT_E_FAIL;
+    }
+
+    /* Decode Frame without IMDCT */
+    if( ldacBT_decode_frame( hLdacBT, p_bs, (char **)ap_spec, fmt, bs_bytes, used_bytes, wrote_bytes,
+                             ap_idsf, ap_idwl, a_nqus, &updated ) != LDACBT_S_OK ){
+        return LDACBT_E_FAIL;
+    }
+    *wrote_bytes = hLdacBT->frm_samples * ldacBT_get_pcm_wl( fmt );
+    if( p_nqus != NULL ){
+        for( ich = 0; ich < hLdacBT->pcm.ch; ich++ ){
+            p_nqus[ich] = a_nqus[ich];
+        }
+    }
+
+    return updated ? LDACBT_E_FAIL : LDACBT_S_OK;
+}
+#endif /* _ENCODE_ONLY */
+#ifndef _ENCODE_ONLY
+/* LDAC decode proccess for a whole media payload */
+LDACBT_API int ldacBT_decode_packet( HANDLE_LDAC_BT hLdacBT, unsigned char *p_payload, unsigned char *p_pcm,
+                                     LDACBT_SMPL_FMT_T fmt, int payload_bytes, int pcm_bytes,
+                                     int *used_bytes, int *wrote_bytes )
+{
+    LDAC_RESULT result;
+    int status, updated, nfrm, ifrm, sfid, cci, frmlen, frm_status;
+    int frm_used, frm_pcm_bytes, frm_bytes;
+    unsigned char *p_bs;
+
+    /* check arguments */
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_DECODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( ( p_payload == NULL ) ||
         ( p_pcm== NULL ) ||
         ( used_bytes == NULL ) ||
         ( wrote_bytes == NULL )
@@ -749,96 +1122,482 @@ LDACBT_API int ldacBT_decode( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs, unsig
             hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
             return LDACBT_E_FAIL;
     }
-    if( bs_bytes < (LDACBT_FRMHDRBYTES+2) ){
+    if( payload_bytes < (1+LDACBT_FRMHDRBYTES+2) ){
         hLdacBT->error_code_api = LDACBT_ERR_INPUT_BUFFER_SIZE;
         return LDACBT_E_FAIL;
     }
     if( (hLdacBT->error_code_api = ldacBT_assert_sample_format( fmt )) != LDACBT_ERR_NONE ){
         return LDACBT_E_FAIL;
     }
+    nfrm = p_payload[0] & LDACBT_PKT_NFRM_MASK;
+    if( nfrm == 0 ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
 
-    *used_bytes = 0;
+    *used_bytes = 1;
     *wrote_bytes = 0;
     status = LDACBT_S_OK;
+    p_bs = p_payload + 1;
+    frm_bytes = 0;
 
-    /* Get Frame Header Data */
-    result = ldaclib_get_frame_header( hLdacBT->hLDAC, p_bs, &sfid, &cci, &frmlen, &frm_status);
-    if ( !LDAC_SUCCEEDED(result)) {
-        /* search syncword here or out-of-api. */
-        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+    /* Set up decoder from the first Frame Header */
+    if( ldacBT_setup_decode_frame( hLdacBT, p_bs, &updated ) != LDACBT_S_OK ){
         return LDACBT_E_FAIL;
     }
-    if( (hLdacBT->error_code_api = ldacBT_assert_cci( cci )) != LDACBT_ERR_NONE ){
+    if( updated ){
+        status = LDACBT_E_FAIL;
+    }
+    frm_pcm_bytes = hLdacBT->frm_samples * hLdacBT->pcm.ch * ldacBT_get_pcm_wl( fmt );
+    if( pcm_bytes < nfrm * frm_pcm_bytes ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
         return LDACBT_E_FAIL;
     }
-    cm = ldacBT_cci_to_cm(cci);
 
-    if( hLdacBT->flg_decode_inited ){
-        /* Check Frame Header Data */
-        result = ldaclib_check_frame_header( hLdacBT->hLDAC, sfid, cci);
-        if (LDAC_FAILED(result)) { /* re-initialization required */
-            ldaclib_get_sampling_rate( sfid, &hLdacBT->pcm.sf );
-            result = ldacBT_init_handle_decode( hLdacBT, cm, hLdacBT->pcm.sf, hLdacBT->nshift, 0, 0 );
-            if ( result == LDACBT_S_OK ) {
-                hLdacBT->error_code_api = LDACBT_ERR_DEC_CONFIG_UPDATED;
-                status = LDACBT_E_FAIL;
+    for( ifrm = 0; ifrm < nfrm; ifrm++ ){
+        if( payload_bytes - *used_bytes < LDACBT_FRMHDRBYTES+2 ){
+            hLdacBT->error_code_api = LDACBT_ERR_INPUT_BUFFER_SIZE;
+            return LDACBT_E_FAIL;
+        }
+        if( ifrm > 0 ){
+            /* The following frames of a payload share the configuration of the first one */
+            result = ldaclib_get_frame_header( hLdacBT->hLDAC, p_bs, &sfid, &cci, &frmlen, &frm_status);
+            if( LDAC_FAILED(result) ){
+                hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+                return LDACBT_E_FAIL;
+            }
+            if( sfid != hLdacBT->sfid ){
+                hLdacBT->error_code_api = LDACBT_ERR_CHECK_SAMPLING_FREQ;
+                return LDACBT_E_FAIL;
             }
-            else {
+            if( cci != hLdacBT->cci ){
+                hLdacBT->error_code_api = LDACBT_ERR_CHECK_CHANNEL_CONFIG;
                 return LDACBT_E_FAIL;
             }
+            result = ldaclib_set_frame_info( hLdacBT->hLDAC, frmlen, frm_status );
+            if( LDAC_FAILED(result) ){
+                hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+                return LDACBT_E_FAIL;
+            }
+            hLdacBT->frmlen = frmlen;
+            hLdacBT->frm_status = frm_status;
         }
+
+        /* Decode Frame */
+        frm_used = 0;
+        result = ldaclib_decode( hLdacBT->hLDAC, p_bs+LDACBT_FRMHDRBYTES, hLdacBT->pp_pcm,
+                                 payload_bytes-*used_bytes-LDACBT_FRMHDRBYTES, &frm_used,
+                                 (LDAC_SMPL_FMT_T)fmt );
+        if (LDAC_FAILED(result)) {
+            hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+            return LDACBT_E_FAIL;
+        }
+        frm_used += LDACBT_FRMHDRBYTES;
+        *used_bytes += frm_used;
+        frm_bytes += frm_used;
+        p_bs += frm_used;
+
+        /* copy to output buffer */
+        *wrote_bytes += ldacBT_interleave_pcm( p_pcm + *wrote_bytes, (const char**)hLdacBT->pp_pcm,
+                                               hLdacBT->frm_samples, hLdacBT->pcm.ch, fmt );
     }
 
-    /* Set Frame Header Information */
-    result = ldaclib_set_config_info( hLdacBT->hLDAC, sfid, cci, frmlen, frm_status);
-    if (LDAC_FAILED(result)) {
-        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE; /* fatal */
+    /* update bitrate */
+    hLdacBT->bitrate = frm_bytes * hLdacBT->pcm.sf
+                       / (nfrm * LDACBT_SHIFT_FRM_SAMPLES( hLdacBT->frm_samples, -hLdacBT->nshift ))
+                       * 8 / 1000;
+
+    return status;
+}
+#endif /* _ENCODE_ONLY */
+#ifndef _ENCODE_ONLY
+/* LDAC packet loss concealment proccess */
+LDACBT_API int ldacBT_decode_conceal( HANDLE_LDAC_BT hLdacBT, unsigned char *p_pcm,
+                                      LDACBT_SMPL_FMT_T fmt, int n_frames, int pcm_bytes,
+                                      int *wrote_bytes )
+{
+    LDAC_RESULT result;
+    int ifrm;
+
+    /* check arguments */
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( (hLdacBT->proc_mode != LDACBT_PROCMODE_DECODE) || (! hLdacBT->flg_decode_inited) ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( ( p_pcm == NULL ) ||
+        ( wrote_bytes == NULL ) ||
+        ( n_frames <= 0 )
+        ) {
+            hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+            return LDACBT_E_FAIL;
+    }
+    if( (hLdacBT->error_code_api = ldacBT_assert_sample_format( fmt )) != LDACBT_ERR_NONE ){
+        return LDACBT_E_FAIL;
+    }
+    if( pcm_bytes < n_frames * hLdacBT->frm_samples * hLdacBT->pcm.ch * ldacBT_get_pcm_wl( fmt ) ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
         return LDACBT_E_FAIL;
     }
-    hLdacBT->sfid = sfid;
-    hLdacBT->frmlen = frmlen;
-    hLdacBT->cm = cm;
-    hLdacBT->cci = cci;
-    hLdacBT->frm_status = frm_status;
 
-    /*frame_size = LDACBT_FRMHDRBYTES + frmlen;*/
-    if( LDAC_SUCCEEDED(result) && (! hLdacBT->flg_decode_inited) ){
-        /* Initialize for Decoding */
-        result = ldaclib_init_decode( hLdacBT->hLDAC, hLdacBT->nshift );
-        if( LDAC_SUCCEEDED(result)){
-            hLdacBT->flg_decode_inited = 1;
-        }else{
+    *wrote_bytes = 0;
+
+    for( ifrm = 0; ifrm < n_frames; ifrm++ ){
+        /* Conceal Frame */
+        result = ldaclib_decode_conceal( hLdacBT->hLDAC, hLdacBT->pp_pcm, (LDAC_SMPL_FMT_T)fmt );
+        if (LDAC_FAILED(result)) {
             hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
             return LDACBT_E_FAIL;
         }
-        result = ldaclib_get_frame_samples( hLdacBT->sfid, &hLdacBT->frm_samples);
-        if (LDAC_FAILED(result)) {
-            hLdacBT->error_code_api = LDACBT_ERR_ILL_SAMPLING_FREQ;
+
+        /* copy to output buffer */
+        *wrote_bytes += ldacBT_interleave_pcm( p_pcm + *wrote_bytes, (const char**)hLdacBT->pp_pcm,
+                                               hLdacBT->frm_samples, hLdacBT->pcm.ch, fmt );
+    }
+
+    return LDACBT_S_OK;
+}
+#endif /* _ENCODE_ONLY */
+#ifndef _ENCODE_ONLY
+/* LDAC decode proccess for an arbitrary chunk of byte stream */
+LDACBT_API int ldacBT_decode_stream( HANDLE_LDAC_BT hLdacBT, unsigned char *p_data, unsigned char *p_pcm,
+                                     LDACBT_SMPL_FMT_T fmt, int data_bytes, int pcm_bytes,
+                                     int *used_bytes, int *wrote_bytes )
+{
+    int result, status, resync, action;
+    int used, rp, flg_sync, ncopy, frm_bytes, frm_pcm_bytes, frm_used, frm_wrote;
+    unsigned char *buf, *p_sync;
+
+    /* check arguments */
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_DECODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( ( (p_data == NULL) && (data_bytes > 0) ) ||
+        ( p_pcm == NULL ) ||
+        ( used_bytes == NULL ) ||
+        ( wrote_bytes == NULL ) ||
+        ( data_bytes < 0 )
+        ) {
+            hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+            return LDACBT_E_FAIL;
+    }
+    if( (hLdacBT->error_code_api = ldacBT_assert_sample_format( fmt )) != LDACBT_ERR_NONE ){
+        return LDACBT_E_FAIL;
+    }
+
+    *used_bytes = 0;
+    *wrote_bytes = 0;
+    status = LDACBT_S_OK;
+    resync = 0;
+
+    /* The buffer state is held locally, since re-initialization on a configuration change
+     * clears it. */
+    buf = hLdacBT->dec_strm_buf.buf;
+    used = hLdacBT->dec_strm_buf.used;
+    flg_sync = hLdacBT->dec_strm_buf.flg_sync;
+    rp = 0;
+
+    while( 1 ){
+        /* Refill the buffer when less than half of it is left */
+        if( (*used_bytes < data_bytes) && (used - rp < LDACBT_DEC_STREAM_BUF_SZ/2) ){
+            if( rp > 0 ){
+                memmove( buf, buf+rp, used-rp );
+                used -= rp;
+                rp = 0;
+            }
+            ncopy = LDACBT_DEC_STREAM_BUF_SZ - used;
+            if( ncopy > data_bytes - *used_bytes ){
+                ncopy = data_bytes - *used_bytes;
+            }
+            copy_data_ldac( p_data + *used_bytes, buf+used, ncopy );
+            used += ncopy;
+            *used_bytes += ncopy;
+        }
+
+        /* Search syncword */
+        p_sync = (unsigned char *)memchr( buf+rp, LDACBT_SYNCWORD, used-rp );
+        if( p_sync == NULL ){
+            p_sync = buf+used;
+        }
+        if( p_sync != buf+rp ){
+            resync = 1;
+            flg_sync = 0;
+            rp = (int)(p_sync - buf);
+        }
+
+        /* Check Frame Header */
+        action = LDACBT_STRM_WAIT;
+        if( used - rp >= LDACBT_FRMHDRBYTES ){
+            if( ldacBT_check_stream_frame( hLdacBT, buf+rp, fmt, &frm_bytes, &frm_pcm_bytes ) < 0 ){
+                action = LDACBT_STRM_SKIP;
+            }
+            else if( flg_sync ){
+                if( used - rp >= frm_bytes ){
+                    action = LDACBT_STRM_DECODE;
+                }
+            }
+            else if( used - rp >= frm_bytes + 2 ){
+                /* Out of sync, the next frame header must follow to accept this one */
+                if( (buf[rp+frm_bytes] != LDACBT_SYNCWORD) ||
+                    ((buf[rp+frm_bytes+1] ^ buf[rp+1]) & 0xF8) ){
+                    action = LDACBT_STRM_SKIP;
+                }
+                else{
+                    action = LDACBT_STRM_DECODE;
+                }
+            }
+        }
+
+        if( action == LDACBT_STRM_WAIT ){
+            if( *used_bytes >= data_bytes ){
+                break;
+            }
+        }
+        else if( action == LDACBT_STRM_SKIP ){
+            resync = 1;
+            flg_sync = 0;
+            rp++;
+        }
+        else{
+            if( pcm_bytes - *wrote_bytes < frm_pcm_bytes ){
+                break;
+            }
+            /* Decode Frame */
+            clear_data_ldac( buf+used, 2 );
+            result = ldacBT_decode( hLdacBT, buf+rp, p_pcm + *wrote_bytes, fmt, frm_bytes,
+                                    &frm_used, &frm_wrote );
+            if( (result != LDACBT_S_OK) && LDACBT_FATAL(ldacBT_get_error_code( hLdacBT )) ){
+                /* broken frame, search the next syncword */
+                resync = 1;
+                flg_sync = 0;
+                rp++;
+            }
+            else{
+                if( result != LDACBT_S_OK ){
+                    status = LDACBT_E_FAIL;
+                }
+                rp += frm_bytes;
+                *wrote_bytes += frm_wrote;
+                flg_sync = 1;
+            }
+        }
+    }
+
+    /* Keep the remaining bytes for the next call */
+    if( rp > 0 ){
+        memmove( buf, buf+rp, used-rp );
+        used -= rp;
+    }
+    hLdacBT->dec_strm_buf.used = used;
+    hLdacBT->dec_strm_buf.flg_sync = flg_sync;
+
+    if( resync ){
+        hLdacBT->error_code_api = LDACBT_ERR_DEC_RESYNC;
+        return LDACBT_E_FAIL;
+    }
+    return status;
+}
+#endif /* _ENCODE_ONLY */
+#ifndef _ENCODE_ONLY
+/* Reset jitter buffer */
+LDACBT_API int ldacBT_jb_reset( HANDLE_LDAC_BT hLdacBT, int min_depth, int max_depth )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( (min_depth < 1) || (max_depth < min_depth) || (max_depth > LDACBT_JB_MAX_DEPTH) ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+    if( hLdacBT->p_jb == NULL ){
+        hLdacBT->p_jb = (LDACBT_JITTER_BUF *)malloc( sizeof(LDACBT_JITTER_BUF) );
+        if( hLdacBT->p_jb == NULL ){
+            hLdacBT->error_code_api = LDACBT_ERR_ALLOC_MEMORY;
             return LDACBT_E_FAIL;
         }
     }
+    ldacBT_jb_clear( hLdacBT->p_jb, min_depth, max_depth );
+    return LDACBT_S_OK;
+}
+
+/* Put RTP packet into jitter buffer */
+LDACBT_API int ldacBT_jb_put( HANDLE_LDAC_BT hLdacBT, unsigned char *p_rtp, int rtp_bytes,
+                              unsigned int arrival_us )
+{
+    LDACBT_JITTER_BUF *p_jb;
+    LDACBT_JB_SLOT *p_slot;
+    unsigned short seq;
+    unsigned int ts;
+    int hdr_bytes, payload_bytes, diff;
 
-    if( ! hLdacBT->flg_decode_inited ){
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->p_jb == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( p_rtp == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+    payload_bytes = ldacBT_parse_rtp_header( p_rtp, rtp_bytes, &seq, &ts, &hdr_bytes );
+    if( payload_bytes < 0 ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+    if( (payload_bytes < 1+LDACBT_FRMHDRBYTES) || (payload_bytes > LDACBT_JB_SLOT_SZ) ){
+        hLdacBT->error_code_api = LDACBT_ERR_INPUT_BUFFER_SIZE;
+        return LDACBT_E_FAIL;
+    }
+    if( (p_rtp[hdr_bytes] & LDACBT_PKT_NFRM_MASK) == 0 ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
         return LDACBT_E_FAIL;
     }
 
-    /* Decode Frame */
-    result = ldaclib_decode( hLdacBT->hLDAC, p_bs+LDACBT_FRMHDRBYTES, hLdacBT->pp_pcm,
-                             bs_bytes-LDACBT_FRMHDRBYTES, used_bytes, (LDAC_SMPL_FMT_T)fmt );
-    if( *used_bytes != 0 ){    *used_bytes += LDACBT_FRMHDRBYTES; }
+    p_jb = hLdacBT->p_jb;
+    ldacBT_jb_update_jitter( hLdacBT, p_rtp+hdr_bytes, ts, arrival_us );
 
-    if (LDAC_FAILED(result)) {
-        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+    if( ! p_jb->flg_started ){
+        p_jb->next_seq = seq;
+        p_jb->flg_started = 1;
+    }
+    diff = (short)(seq - p_jb->next_seq);
+    if( (diff < 0) && (! p_jb->flg_playing) && (diff > -LDACBT_JB_NSLOT) ){
+        /* an earlier packet arrived before the playout started */
+        ldacBT_jb_move_start( p_jb, seq );
+        diff = 0;
+    }
+    if( diff < 0 ){
+        ++p_jb->stats.late;
+        return LDACBT_S_OK;
+    }
+    /* make room by dropping the oldest packets */
+    while( diff >= LDACBT_JB_NSLOT ){
+        p_slot = &p_jb->a_slot[p_jb->next_seq & (LDACBT_JB_NSLOT-1)];
+        if( p_slot->bytes > 0 ){
+            p_slot->bytes = 0;
+            --p_jb->stats.depth;
+            ++p_jb->stats.dropped;
+        }
+        ++p_jb->next_seq;
+        --diff;
+    }
+
+    p_slot = &p_jb->a_slot[seq & (LDACBT_JB_NSLOT-1)];
+    if( p_slot->bytes > 0 ){
+        ++p_jb->stats.duplicate;
+        return LDACBT_S_OK;
+    }
+    copy_data_ldac( p_rtp+hdr_bytes, p_slot->buf, payload_bytes );
+    clear_data_ldac( p_slot->buf+payload_bytes, 2 );
+    p_slot->bytes = payload_bytes;
+    p_slot->seq = seq;
+    ++p_jb->stats.depth;
+    ++p_jb->stats.received;
+
+    return LDACBT_S_OK;
+}
+
+/* Play out next packet of jitter buffer */
+LDACBT_API int ldacBT_jb_pull( HANDLE_LDAC_BT hLdacBT, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                               int pcm_bytes, int *wrote_bytes )
+{
+    LDACBT_JITTER_BUF *p_jb;
+    LDACBT_JB_SLOT *p_slot;
+    int result, target, used_bytes, nfrm, frm_pcm_bytes, conceal_bytes;
+
+    /* check arguments */
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( (hLdacBT->proc_mode != LDACBT_PROCMODE_DECODE) || (! hLdacBT->flg_decode_inited) ||
+        (hLdacBT->p_jb == NULL) ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( ( p_pcm == NULL ) ||
+        ( wrote_bytes == NULL )
+        ) {
+            hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+            return LDACBT_E_FAIL;
+    }
+    if( (hLdacBT->error_code_api = ldacBT_assert_sample_format( fmt )) != LDACBT_ERR_NONE ){
         return LDACBT_E_FAIL;
     }
 
-    /* update bitrate */
-    hLdacBT->bitrate = *used_bytes * hLdacBT->pcm.sf / hLdacBT->frm_samples * 8 / 1000;
-    /* copy to output buffer */
-    *wrote_bytes = ldacBT_interleave_pcm( p_pcm, (const char**)hLdacBT->pp_pcm,
-                                          hLdacBT->frm_samples, hLdacBT->pcm.ch, fmt );
+    *wrote_bytes = 0;
+    p_jb = hLdacBT->p_jb;
+    target = ldacBT_jb_get_target( p_jb );
+
+    if( ! p_jb->flg_playing ){
+        if( (p_jb->stats.depth == 0) || (p_jb->stats.depth < target) ){
+            return LDACBT_S_OK;
+        }
+        p_jb->flg_playing = 1;
+    }
+
+    /* reduce the latency */
+    p_slot = &p_jb->a_slot[p_jb->next_seq & (LDACBT_JB_NSLOT-1)];
+    if( (p_jb->stats.depth > target + LDACBT_JB_DEPTH_MARGIN) && (p_slot->bytes > 0) ){
+        p_slot->bytes = 0;
+        --p_jb->stats.depth;
+        ++p_jb->stats.dropped;
+        ++p_jb->next_seq;
+        p_slot = &p_jb->a_slot[p_jb->next_seq & (LDACBT_JB_NSLOT-1)];
+    }
+
+    if( p_slot->bytes > 0 ){
+        nfrm = p_slot->buf[0] & LDACBT_PKT_NFRM_MASK;
+        result = ldacBT_decode_packet( hLdacBT, p_slot->buf, p_pcm, fmt, p_slot->bytes, pcm_bytes,
+                                       &used_bytes, wrote_bytes );
+        p_jb->nfrm_last = nfrm;
+        p_slot->bytes = 0;
+        --p_jb->stats.depth;
+
+        frm_pcm_bytes = hLdacBT->frm_samples * hLdacBT->pcm.ch * ldacBT_get_pcm_wl( fmt );
+        if( (result != LDACBT_S_OK) && (*wrote_bytes < nfrm * frm_pcm_bytes) ){
+            /* a corrupt packet is concealed as a lost one */
+            ++p_jb->stats.lost;
+            result = ldacBT_decode_conceal( hLdacBT, p_pcm + *wrote_bytes, fmt,
+                                            nfrm - *wrote_bytes / frm_pcm_bytes,
+                                            pcm_bytes - *wrote_bytes, &conceal_bytes );
+            if( result == LDACBT_S_OK ){
+                *wrote_bytes += conceal_bytes;
+            }
+        }
+    }
+    else{
+        if( p_jb->stats.depth == 0 ){
+            /* fill up to the target again */
+            ++p_jb->stats.underrun;
+            p_jb->flg_playing = 0;
+        }
+        else{
+            ++p_jb->stats.lost;
+        }
+        result = LDACBT_S_OK;
+        if( p_jb->nfrm_last > 0 ){
+            result = ldacBT_decode_conceal( hLdacBT, p_pcm, fmt, p_jb->nfrm_last, pcm_bytes,
+                                            wrote_bytes );
+        }
+    }
+    ++p_jb->next_seq;
 
+    return result;
+}
 
-    return status;
+/* Get statistics of jitter buffer */
+LDACBT_API int ldacBT_jb_get_stats( HANDLE_LDAC_BT hLdacBT, LDACBT_JB_STATS *p_stats )
+{
+    if( hLdacBT == NULL ){ return LDACBT_E_FAIL; }
+    if( hLdacBT->p_jb == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( p_stats == NULL ){
+        hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+        return LDACBT_E_FAIL;
+    }
+    *p_stats = hLdacBT->p_jb->stats;
+    p_stats->target = ldacBT_jb_get_target( hLdacBT->p_jb );
+    p_stats->jitter = hLdacBT->p_jb->jitter_q >> LDACBT_JB_JITTER_SHIFT;
+    return LDACBT_S_OK;
 }
 #endif /* _ENCODE_ONLY */
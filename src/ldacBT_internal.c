@@ -98,6 +98,9 @@ DECLFUNC void ldacBT_param_clear(HANDLE_LDAC_BT hLdacBT)
 
 #ifndef _ENCODE_ONLY
     hLdacBT->flg_decode_inited = 0;
+    /* ldacBT_decode_stream() keeps its own copy of this over re-initialization */
+    hLdacBT->dec_strm_buf.used = 0;
+    hLdacBT->dec_strm_buf.flg_sync = 0;
 #endif
 #ifndef _DECODE_ONLY
     clear_data_ldac( hLdacBT->ldac_trns_frm_buf.buf, sizeof(hLdacBT->ldac_trns_frm_buf.buf));
@@ -108,6 +111,17 @@ DECLFUNC void ldacBT_param_clear(HANDLE_LDAC_BT hLdacBT)
     hLdacBT->pcmring.wp = 0;
     hLdacBT->pcmring.rp = 0;
     hLdacBT->pcmring.nsmpl = 0;
+
+    hLdacBT->complexity = LDACBT_COMPLEXITY_DEFAULT;
+    hLdacBT->gov_clock = NULL;
+    hLdacBT->gov_ctx = NULL;
+    hLdacBT->gov_load = 0;
+    hLdacBT->gov_avg = 0;
+    hLdacBT->gov_hold = 0;
+    hLdacBT->gov_raise = 0;
+    hLdacBT->feature_func = NULL;
+    hLdacBT->feature_ctx = NULL;
+    clear_data_ldac( &hLdacBT->features, sizeof(hLdacBT->features));
 #endif
 /* work buffer for I/O */
     for( ich = 0; ich < LDAC_PRCNCH; ich++ ){
@@ -304,6 +318,21 @@ DECLFUNC void ldacBT_prepare_pcm_encode( void *pbuff, char **ap_pcm, int nsmpl,
 #endif    /* _DECODE_ONLY */
 
 #ifndef _ENCODE_ONLY
+/* Get word length in bytes of the output pcm format */
+DECLFUNC int ldacBT_get_pcm_wl( LDACBT_SMPL_FMT_T fmt )
+{
+    switch(fmt){
+      case LDACBT_SMPL_FMT_S16:
+        return 2;
+      case LDACBT_SMPL_FMT_S24:
+        return 3;
+      case LDACBT_SMPL_FMT_S32:
+      case LDACBT_SMPL_FMT_F32:
+      default:
+        return 4;
+    }
+}
+
 /* Interleave decode pcm data for output */
 DECLFUNC int ldacBT_interleave_pcm( unsigned char *p_pcm, const char **pp_pcm, int nsmpl, int nch,
                                     LDACBT_SMPL_FMT_T fmt )
@@ -458,6 +487,64 @@ ldac_setup_AGAIN:
 ldac_setup_END:
     return status;
 }
+
+/* Update the encoder complexity level from the measured encode time of one frame. */
+DECLFUNC void ldacBT_update_complexity_governor( HANDLE_LDAC_BT hLdacBT, int elapsed )
+{
+    int budget, level;
+
+    /* allowed encode time for one frame = frame period * load */
+    budget = hLdacBT->frm_samples * 10000 / (hLdacBT->pcm.sf / 100) * hLdacBT->gov_load / 100;
+
+    hLdacBT->gov_avg += (elapsed - hLdacBT->gov_avg) >> LDACBT_GOV_AVG_SHIFT;
+    if( hLdacBT->gov_hold < LDACBT_GOV_HOLD_FRAMES ){
+        hLdacBT->gov_hold++;
+    }
+
+    if( LDAC_FAILED(ldaclib_get_encode_complexity( hLdacBT->hLDAC, &level )) ){
+        return;
+    }
+
+    if( hLdacBT->gov_avg > budget ){
+        /* deadline at risk: lower the level */
+        hLdacBT->gov_raise = 0;
+        if( (level > LDACBT_COMPLEXITY_FAST) && (hLdacBT->gov_hold >= LDACBT_GOV_HOLD_FRAMES) ){
+            ldaclib_set_encode_complexity( hLdacBT->hLDAC, level-1 );
+            hLdacBT->gov_hold = 0;
+        }
+    }
+    else if( hLdacBT->gov_avg < budget / 2 ){
+        /* enough headroom: restore the level step by step */
+        if( level < hLdacBT->complexity ){
+            if( ++hLdacBT->gov_raise >= LDACBT_GOV_RAISE_FRAMES ){
+                ldaclib_set_encode_complexity( hLdacBT->hLDAC, level+1 );
+                hLdacBT->gov_raise = 0;
+                hLdacBT->gov_hold = 0;
+            }
+        }
+    }
+    else{
+        hLdacBT->gov_raise = 0;
+    }
+}
+
+/* Pass the signal analysis features of the encoded frame to the callback. */
+DECLFUNC void ldacBT_notify_frame_features( HANDLE_LDAC_BT hLdacBT )
+{
+    int ich;
+    LDACBT_FRAME_FEATURES *pft;
+
+    pft = &hLdacBT->features;
+    pft->nch = hLdacBT->pcm.ch;
+    for( ich = 0; ich < pft->nch; ich++ ){
+        if( LDAC_FAILED(ldaclib_get_encode_features( hLdacBT->hLDAC, ich, &pft->frame_status,
+                &pft->a_low_energy[ich], &pft->a_centroid[ich], &pft->a_zero_cross[ich],
+                &pft->a_nqus[ich], pft->aa_idsf[ich] )) ){
+            return;
+        }
+    }
+    hLdacBT->feature_func( hLdacBT->feature_ctx, pft );
+}
 #endif    /* _DECODE_ONLY */
 
 /* Get channel_config_index from channel_mode.
@@ -623,3 +710,301 @@ DECLFUNC int ldacBT_get_eqmid_from_frmlen( int frmlen, int nch, int flgFrmHdr, i
 }
 #endif    /* _DECODE_ONLY */
 
+#ifndef _ENCODE_ONLY
+/* Set up the decoder from the frame header of "ldac_transport_frame".
+ * The handle is re-initialized when the header no longer matches the current configuration.
+ * In that case *p_updated is set to 1 and decoding may continue with the new configuration.
+ */
+DECLFUNC int ldacBT_setup_decode_frame( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs, int *p_updated )
+{
+    LDAC_RESULT result;
+    int sfid, cm, cci, frmlen, frm_status;
+
+    *p_updated = 0;
+
+    /* Get Frame Header Data */
+    result = ldaclib_get_frame_header( hLdacBT->hLDAC, p_bs, &sfid, &cci, &frmlen, &frm_status);
+    if ( !LDAC_SUCCEEDED(result)) {
+        /* search syncword here or out-of-api. */
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+    if( (hLdacBT->error_code_api = ldacBT_assert_cci( cci )) != LDACBT_ERR_NONE ){
+        return LDACBT_E_FAIL;
+    }
+    cm = ldacBT_cci_to_cm(cci);
+
+    if( hLdacBT->flg_decode_inited ){
+        /* Check Frame Header Data */
+        result = ldaclib_check_frame_header( hLdacBT->hLDAC, sfid, cci);
+        if (LDAC_FAILED(result)) { /* re-initialization required */
+            ldaclib_get_sampling_rate( sfid, &hLdacBT->pcm.sf );
+            result = ldacBT_init_handle_decode( hLdacBT, cm, hLdacBT->pcm.sf, hLdacBT->nshift, 0, 0 );
+            if ( result != LDACBT_S_OK ) {
+                return LDACBT_E_FAIL;
+            }
+            *p_updated = 1;
+        }
+    }
+
+    /* Set Frame Header Information */
+    result = ldaclib_set_config_info( hLdacBT->hLDAC, sfid, cci, frmlen, frm_status);
+    if (LDAC_FAILED(result)) {
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE; /* fatal */
+        return LDACBT_E_FAIL;
+    }
+    hLdacBT->sfid = sfid;
+    hLdacBT->frmlen = frmlen;
+    hLdacBT->cm = cm;
+    hLdacBT->cci = cci;
+    hLdacBT->frm_status = frm_status;
+
+    /*frame_size = LDACBT_FRMHDRBYTES + frmlen;*/
+    if( ! hLdacBT->flg_decode_inited ){
+        /* Initialize for Decoding */
+        result = ldaclib_init_decode( hLdacBT->hLDAC, hLdacBT->nshift );
+        if( LDAC_SUCCEEDED(result)){
+            hLdacBT->flg_decode_inited = 1;
+        }else{
+            hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+            return LDACBT_E_FAIL;
+        }
+        result = ldaclib_get_frame_samples( hLdacBT->sfid, &hLdacBT->frm_samples);
+        if (LDAC_FAILED(result)) {
+            hLdacBT->error_code_api = LDACBT_ERR_ILL_SAMPLING_FREQ;
+            return LDACBT_E_FAIL;
+        }
+        hLdacBT->frm_samples = LDACBT_SHIFT_FRM_SAMPLES( hLdacBT->frm_samples, hLdacBT->nshift );
+    }
+
+    if( *p_updated ){
+        hLdacBT->error_code_api = LDACBT_ERR_DEC_CONFIG_UPDATED;
+    }
+    return LDACBT_S_OK;
+}
+#endif /* _ENCODE_ONLY */
+
+#ifndef _ENCODE_ONLY
+/* Decode a frame for ldacBT_decode(), ldacBT_decode_planar() and ldacBT_decode_spectrum().
+ * The frame is decoded into "ap_out", or into the work buffer of the handle if "ap_out" is NULL.
+ * With "p_nqus", the frame is decoded up to the spectrum. The arguments are checked before the
+ * decoder is set up from the frame header, so that an invalid call leaves the handle unchanged.
+ */
+DECLFUNC int ldacBT_decode_frame( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs, char *ap_out[],
+                                  LDACBT_SMPL_FMT_T fmt, int bs_bytes, int *used_bytes,
+                                  int *wrote_bytes, int *ap_idsf[], int *ap_idwl[], int *p_nqus,
+                                  int *p_updated )
+{
+    LDAC_RESULT result;
+    int ich, nch, sfid, cci, frmlen, frm_status;
+
+    /* check arguments */
+    if( hLdacBT->proc_mode != LDACBT_PROCMODE_DECODE ){
+        hLdacBT->error_code_api = LDACBT_ERR_HANDLE_NOT_INIT;
+        return LDACBT_E_FAIL;
+    }
+    if( ( p_bs == NULL ) ||
+        ( used_bytes == NULL ) ||
+        ( wrote_bytes == NULL )
+        ) {
+            hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+            return LDACBT_E_FAIL;
+    }
+    if( bs_bytes < (LDACBT_FRMHDRBYTES+2) ){
+        hLdacBT->error_code_api = LDACBT_ERR_INPUT_BUFFER_SIZE;
+        return LDACBT_E_FAIL;
+    }
+    if( (hLdacBT->error_code_api = ldacBT_assert_sample_format( fmt )) != LDACBT_ERR_NONE ){
+        return LDACBT_E_FAIL;
+    }
+    /* check the buffers of the channels in the frame */
+    if( ( ap_out != NULL ) &&
+        LDAC_SUCCEEDED(ldaclib_get_frame_header( hLdacBT->hLDAC, p_bs, &sfid, &cci, &frmlen,
+                                                 &frm_status )) &&
+        LDAC_SUCCEEDED(ldaclib_get_channel( cci, &nch )) ){
+        for( ich = 0; ich < nch; ich++ ){
+            if( ( ap_out[ich] == NULL ) ||
+                ( ( ap_idsf != NULL ) && ( ap_idsf[ich] == NULL ) ) ||
+                ( ( ap_idwl != NULL ) && ( ap_idwl[ich] == NULL ) )
+                ){
+                hLdacBT->error_code_api = LDACBT_ERR_ILL_PARAM;
+                return LDACBT_E_FAIL;
+            }
+        }
+    }
+
+    *used_bytes = 0;
+    *wrote_bytes = 0;
+
+    /* Set up decoder from Frame Header */
+    if( ldacBT_setup_decode_frame( hLdacBT, p_bs, p_updated ) != LDACBT_S_OK ){
+        return LDACBT_E_FAIL;
+    }
+    if( ap_out == NULL ){
+        ap_out = hLdacBT->pp_pcm;
+    }
+
+    /* Decode Frame */
+    if( p_nqus != NULL ){
+        result = ldaclib_decode_spectrum( hLdacBT->hLDAC, p_bs+LDACBT_FRMHDRBYTES, ap_out,
+                                          ap_idsf, ap_idwl, bs_bytes-LDACBT_FRMHDRBYTES, used_bytes,
+                                          p_nqus, (LDAC_SMPL_FMT_T)fmt );
+    }
+    else{
+        result = ldaclib_decode( hLdacBT->hLDAC, p_bs+LDACBT_FRMHDRBYTES, ap_out,
+                                 bs_bytes-LDACBT_FRMHDRBYTES, used_bytes, (LDAC_SMPL_FMT_T)fmt );
+    }
+    if( *used_bytes != 0 ){    *used_bytes += LDACBT_FRMHDRBYTES; }
+
+    if (LDAC_FAILED(result)) {
+        hLdacBT->error_code_api = LDACBT_GET_LDACLIB_ERROR_CODE;
+        return LDACBT_E_FAIL;
+    }
+
+    /* update bitrate */
+    hLdacBT->bitrate = *used_bytes * hLdacBT->pcm.sf
+                       / LDACBT_SHIFT_FRM_SAMPLES( hLdacBT->frm_samples, -hLdacBT->nshift ) * 8 / 1000;
+
+    return LDACBT_S_OK;
+}
+#endif /* _ENCODE_ONLY */
+
+#ifndef _ENCODE_ONLY
+/* Check a candidate frame header found in the byte stream.
+ * Returns the size of the frame and of its decoded pcm, or -1 if it cannot be a frame header.
+ */
+DECLFUNC int ldacBT_check_stream_frame( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs,
+                                        LDACBT_SMPL_FMT_T fmt, int *p_frm_bytes, int *p_pcm_bytes )
+{
+    LDAC_RESULT result;
+    int sfid, cci, frmlen, frm_status, frm_samples, nch;
+
+    result = ldaclib_get_frame_header( hLdacBT->hLDAC, p_bs, &sfid, &cci, &frmlen, &frm_status);
+    if( LDAC_FAILED(result) ){
+        ldaclib_clear_error_code( hLdacBT->hLDAC );
+        return -1;
+    }
+    if( ldacBT_assert_cci( cci ) != LDACBT_ERR_NONE ){
+        return -1;
+    }
+    if( LDAC_FAILED(ldaclib_get_frame_samples( sfid, &frm_samples )) ){
+        return -1;
+    }
+    if( LDAC_FAILED(ldaclib_get_channel( cci, &nch )) ){
+        return -1;
+    }
+    *p_frm_bytes = LDACBT_FRMHDRBYTES + frmlen;
+    *p_pcm_bytes = LDACBT_SHIFT_FRM_SAMPLES( frm_samples, hLdacBT->nshift ) * nch
+                   * ldacBT_get_pcm_wl( fmt );
+    return 0;
+}
+#endif /* _ENCODE_ONLY */
+
+#ifndef _ENCODE_ONLY
+/* Clear the jitter buffer */
+DECLFUNC void ldacBT_jb_clear( LDACBT_JITTER_BUF *p_jb, int min_depth, int max_depth )
+{
+    int i;
+    for( i = 0; i < LDACBT_JB_NSLOT; i++ ){
+        p_jb->a_slot[i].bytes = 0;
+    }
+    p_jb->min_depth = min_depth;
+    p_jb->max_depth = max_depth;
+    p_jb->flg_started = 0;
+    p_jb->flg_playing = 0;
+    p_jb->next_seq = 0;
+    p_jb->nfrm_last = 0;
+    p_jb->flg_arrival = 0;
+    p_jb->last_arrival = 0;
+    p_jb->last_ts = 0;
+    p_jb->jitter_q = 0;
+    p_jb->pkt_us = 0;
+    clear_data_ldac( &p_jb->stats, sizeof(p_jb->stats) );
+}
+
+/* Move the start of the jitter buffer back to an earlier sequence number.
+ * The packets that no longer fit in the slots are dropped. */
+DECLFUNC void ldacBT_jb_move_start( LDACBT_JITTER_BUF *p_jb, unsigned short seq )
+{
+    int i;
+    LDACBT_JB_SLOT *p_slot;
+    for( i = 0; i < LDACBT_JB_NSLOT; i++ ){
+        p_slot = &p_jb->a_slot[i];
+        if( (p_slot->bytes > 0) && ((unsigned short)(p_slot->seq - seq) >= LDACBT_JB_NSLOT) ){
+            p_slot->bytes = 0;
+            --p_jb->stats.depth;
+            ++p_jb->stats.dropped;
+        }
+    }
+    p_jb->next_seq = seq;
+}
+
+/* Parse RTP header. Returns -1 if it is not a valid RTP header. */
+DECLFUNC int ldacBT_parse_rtp_header( unsigned char *p_rtp, int rtp_bytes, unsigned short *p_seq,
+                                      unsigned int *p_ts, int *p_hdr_bytes )
+{
+    int hdr_bytes;
+    if( rtp_bytes < LDACBT_RTP_HEADER_SIZE ){ return -1; }
+    if( (p_rtp[0] >> 6) != 2 ){ return -1; } /* version */
+    hdr_bytes = LDACBT_RTP_HEADER_SIZE + 4 * (p_rtp[0] & 0x0F); /* CSRC */
+    if( p_rtp[0] & 0x10 ){ /* header extension */
+        if( rtp_bytes < hdr_bytes + 4 ){ return -1; }
+        hdr_bytes += 4 + 4 * ((p_rtp[hdr_bytes+2] << 8) | p_rtp[hdr_bytes+3]);
+    }
+    if( p_rtp[0] & 0x20 ){ /* padding */
+        rtp_bytes -= p_rtp[rtp_bytes-1];
+    }
+    if( rtp_bytes < hdr_bytes ){ return -1; }
+    *p_seq = (unsigned short)((p_rtp[2] << 8) | p_rtp[3]);
+    *p_ts = ((unsigned int)p_rtp[4] << 24) | ((unsigned int)p_rtp[5] << 16)
+            | ((unsigned int)p_rtp[6] << 8) | (unsigned int)p_rtp[7];
+    *p_hdr_bytes = hdr_bytes;
+    return rtp_bytes - hdr_bytes;
+}
+
+/* Update the inter-arrival jitter (RFC 3550) and the packet duration */
+DECLFUNC void ldacBT_jb_update_jitter( HANDLE_LDAC_BT hLdacBT, unsigned char *p_payload,
+                                       unsigned int ts, unsigned int arrival_us )
+{
+    LDACBT_JITTER_BUF *p_jb = hLdacBT->p_jb;
+    int sfid, cci, frmlen, frm_status, sf, frm_samples, d;
+
+    if( LDAC_FAILED(ldaclib_get_frame_header( hLdacBT->hLDAC, p_payload+1, &sfid, &cci, &frmlen,
+                                              &frm_status )) ){
+        ldaclib_clear_error_code( hLdacBT->hLDAC );
+        return;
+    }
+    if( LDAC_FAILED(ldaclib_get_sampling_rate( sfid, &sf )) ||
+        LDAC_FAILED(ldaclib_get_frame_samples( sfid, &frm_samples )) ){
+        return;
+    }
+    p_jb->pkt_us = (int)((INT64)(p_payload[0] & LDACBT_PKT_NFRM_MASK) * frm_samples * 1000000 / sf);
+
+    if( p_jb->flg_arrival ){
+        /* difference of the transit time to the previous packet */
+        d = (int)(arrival_us - p_jb->last_arrival)
+            - (int)((INT64)(int)(ts - p_jb->last_ts) * 1000000 / sf);
+        if( d < 0 ){ d = -d; }
+        p_jb->jitter_q += d - ((p_jb->jitter_q + (1 << (LDACBT_JB_JITTER_SHIFT-1)))
+                               >> LDACBT_JB_JITTER_SHIFT);
+    }
+    p_jb->flg_arrival = 1;
+    p_jb->last_arrival = arrival_us;
+    p_jb->last_ts = ts;
+}
+
+/* Get the target depth of the jitter buffer */
+DECLFUNC int ldacBT_jb_get_target( LDACBT_JITTER_BUF *p_jb )
+{
+    int target, jitter;
+    target = p_jb->min_depth;
+    if( p_jb->pkt_us > 0 ){
+        jitter = p_jb->jitter_q >> LDACBT_JB_JITTER_SHIFT;
+        target += (LDACBT_JB_JITTER_MULT * jitter + p_jb->pkt_us - 1) / p_jb->pkt_us;
+    }
+    if( target > p_jb->max_depth ){
+        target = p_jb->max_depth;
+    }
+    return target;
+}
+#endif /* _ENCODE_ONLY */
@@ -44,6 +44,14 @@ extern "C" {
 #define LDACBT_PCM_WLEN_MAX 4
 /* The size of LDACBT_TRANSPORT_FRM_BUF's buffer. Unit:Byte  */
 #define LDACBT_ENC_STREAM_BUF_SZ 1024
+/* The syncword at the top of "ldac_transport_frame". */
+#define LDACBT_SYNCWORD 0xAA
+/* The size of LDACBT_DEC_STREAM_BUF's buffer. Unit:Byte */
+#define LDACBT_DEC_STREAM_BUF_SZ (2*LDACBT_MAX_NBYTES)
+/* The number of packet slots of the jitter buffer. (power of 2) */
+#define LDACBT_JB_NSLOT 32
+/* The size of the media payload a slot of the jitter buffer can hold. Unit:Byte */
+#define LDACBT_JB_SLOT_SZ LDACBT_MAX_NBYTES
 /* The size of rtp header and so on. Unit:Byte */
 /*  = sizeof(struct rtp_header) + sizeof(struct rtp_payload) + 1 (scms-t). */
 #define LDACBT_TX_HEADER_SIZE 18
@@ -57,6 +65,29 @@ extern "C" {
 #define LDACBT_ALTER_OP__STANDBY 2
 #define LDACBT_ALTER_OP__FLASH 9
 
+/* The actions of the byte stream decoder */
+#define LDACBT_STRM_WAIT   0
+#define LDACBT_STRM_SKIP   1
+#define LDACBT_STRM_DECODE 2
+
+/* The parameters for the jitter buffer */
+/* The size of fixed part of rtp header. Unit:Byte */
+#define LDACBT_RTP_HEADER_SIZE 12
+/* Weight of the newest jitter in the estimate, as per RFC 3550. (1/2^n) */
+#define LDACBT_JB_JITTER_SHIFT 4
+/* The target depth covers this many times the jitter in addition to the minimum depth. */
+#define LDACBT_JB_JITTER_MULT 2
+/* The number of packets over the target depth before dropping one. */
+#define LDACBT_JB_DEPTH_MARGIN 2
+
+/* The parameters for the encoder complexity governor */
+/* Weight of the newest encode time in the moving average. (1/2^n) */
+#define LDACBT_GOV_AVG_SHIFT 2
+/* The number of frames to wait after a level change before lowering again. */
+#define LDACBT_GOV_HOLD_FRAMES 4
+/* The number of frames with enough headroom before raising the level. */
+#define LDACBT_GOV_RAISE_FRAMES 64
+
 /* other */
 #ifndef LDACBT_S_OK
 #define LDACBT_S_OK (0)
@@ -75,6 +106,9 @@ extern "C" {
 #endif
 #define LDACBT_GET_LDACLIB_ERROR_CODE   9999
 
+/* Frame samples shifted by the nlnn shift of the decoder */
+#define LDACBT_SHIFT_FRM_SAMPLES(n, nshift) (((nshift) < 0) ? ((n) >> -(nshift)) : ((n) << (nshift)))
+
 /* The index for A2DP packets */
 enum {
     ___DH1,    ___DH3,    ___DH5, /* basic rate */
@@ -143,6 +177,41 @@ typedef struct _ldacbt_pcm_ring_buf {
 } LDACBT_PCM_RING_BUF;
 #endif
 
+#ifndef _ENCODE_ONLY
+/* The structure of the input buffer for the byte stream decoding. */
+typedef struct _ldacbt_dec_stream_buf {
+    unsigned char buf[LDACBT_DEC_STREAM_BUF_SZ+2];
+    int used;
+    int flg_sync; /* the buffer starts at a confirmed frame boundary */
+} LDACBT_DEC_STREAM_BUF;
+#endif
+
+#ifndef _ENCODE_ONLY
+/* The structure of a packet slot of the jitter buffer. */
+typedef struct _ldacbt_jb_slot {
+    unsigned char buf[LDACBT_JB_SLOT_SZ+2]; /* media payload */
+    int bytes;                              /* 0 for an empty slot */
+    unsigned short seq;
+} LDACBT_JB_SLOT;
+
+/* The structure of the jitter buffer. */
+typedef struct _ldacbt_jitter_buf {
+    LDACBT_JB_SLOT a_slot[LDACBT_JB_NSLOT];
+    int min_depth;
+    int max_depth;
+    int flg_started;        /* next_seq is valid */
+    int flg_playing;        /* filled up to the target */
+    unsigned short next_seq;
+    int nfrm_last;          /* number of frames in the last packet played out */
+    int flg_arrival;        /* the arrival of the previous packet is valid */
+    unsigned int last_arrival;
+    unsigned int last_ts;
+    int jitter_q;           /* jitter in Q(LDACBT_JB_JITTER_SHIFT). Unit:us */
+    int pkt_us;             /* duration of a packet. Unit:us */
+    LDACBT_JB_STATS stats;
+} LDACBT_JITTER_BUF;
+#endif
+
 /* The LDACBT handle. */
 typedef struct _st_ldacbt_handle {
     HANDLE_LDAC hLDAC;
@@ -178,12 +247,28 @@ typedef struct _st_ldacbt_handle {
     int transport;   /* Transport Stream ( with frame header) */
 #ifndef _ENCODE_ONLY
     int flg_decode_inited;
+    /* buffer for the byte stream decoding */
+    LDACBT_DEC_STREAM_BUF dec_strm_buf;
+    /* sink side jitter buffer, allocated by ldacBT_jb_reset() */
+    LDACBT_JITTER_BUF *p_jb;
 #endif
 #ifndef _DECODE_ONLY
     /* buffer for "ldac_transport_frame" sequence */
     LDACBT_TRANSPORT_FRM_BUF ldac_trns_frm_buf;
     /* buffer for input pcm */
     LDACBT_PCM_RING_BUF pcmring;
+    /* encoder complexity governor */
+    int complexity;         /* configured complexity level (upper limit of the governor) */
+    LDACBT_CLOCK_FUNC gov_clock;
+    void *gov_ctx;
+    int gov_load;           /* allowed encode time in percent of frame period */
+    int gov_avg;            /* moving average of encode time. Unit:us */
+    int gov_hold;           /* frames since the last level change */
+    int gov_raise;          /* consecutive frames with headroom */
+    /* signal analysis feature export */
+    LDACBT_FEATURE_FUNC feature_func;
+    void *feature_ctx;
+    LDACBT_FRAME_FEATURES features;
 #endif
 
 /* work buffer for LDACLIB I/O */
@@ -217,10 +302,27 @@ DECLFUNC int  ldacBT_cci_to_cm( int cci );
 DECLFUNC int  ldacBT_get_altered_eqmid ( HANDLE_LDAC_BT hLdacBT, int priority );
 DECLFUNC int  ldacBT_get_eqmid_from_frmlen( int frmlen, int nch, int flgFrmHdr, int pktType );
 DECLFUNC int  ldacBT_update_frmlen(HANDLE_LDAC_BT hLdacBT, int frmlen);
+DECLFUNC void ldacBT_update_complexity_governor( HANDLE_LDAC_BT hLdacBT, int elapsed );
+DECLFUNC void ldacBT_notify_frame_features( HANDLE_LDAC_BT hLdacBT );
 #endif    /* _DECODE_ONLY */
 #ifndef _ENCODE_ONLY
+DECLFUNC int  ldacBT_get_pcm_wl( LDACBT_SMPL_FMT_T fmt );
 DECLFUNC int  ldacBT_interleave_pcm( unsigned char *p_pcm, const char **pp_pcm, int nsmpl, int nch,
                                      LDACBT_SMPL_FMT_T fmt );
+DECLFUNC int  ldacBT_setup_decode_frame( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs, int *p_updated );
+DECLFUNC int  ldacBT_decode_frame( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs, char *ap_out[],
+                                   LDACBT_SMPL_FMT_T fmt, int bs_bytes, int *used_bytes,
+                                   int *wrote_bytes, int *ap_idsf[], int *ap_idwl[], int *p_nqus,
+                                   int *p_updated );
+DECLFUNC int  ldacBT_check_stream_frame( HANDLE_LDAC_BT hLdacBT, unsigned char *p_bs,
+                                         LDACBT_SMPL_FMT_T fmt, int *p_frm_bytes, int *p_pcm_bytes );
+DECLFUNC void ldacBT_jb_clear( LDACBT_JITTER_BUF *p_jb, int min_depth, int max_depth );
+DECLFUNC void ldacBT_jb_move_start( LDACBT_JITTER_BUF *p_jb, unsigned short seq );
+DECLFUNC int  ldacBT_parse_rtp_header( unsigned char *p_rtp, int rtp_bytes, unsigned short *p_seq,
+                                       unsigned int *p_ts, int *p_hdr_bytes );
+DECLFUNC void ldacBT_jb_update_jitter( HANDLE_LDAC_BT hLdacBT, unsigned char *p_payload,
+                                       unsigned int ts, unsigned int arrival_us );
+DECLFUNC int  ldacBT_jb_get_target( LDACBT_JITTER_BUF *p_jb );
 #endif /* _ENCODE_ONLY */
 #ifndef    _DECODE_ONLY
 DECLFUNC P_LDACBT_EQMID_PROPERTY ldacBT_get_eqmid_conv_tbl ( int ldac_bt_mode );
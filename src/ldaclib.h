@@ -6,6 +6,7 @@
 
 #ifndef _LDACLIB_H
 #define _LDACLIB_H
+#include "ldacBT.h"
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -46,6 +47,20 @@ typedef enum {
     LDAC_SMPL_FMT_MAX = 0x7fffffff
 } LDAC_SMPL_FMT_T;
 
+#define LDAC_COMPLEXITY_FAST       0
+#define LDAC_COMPLEXITY_DEFAULT    1
+#define LDAC_COMPLEXITY_EXHAUSTIVE 2
+#define LDAC_NCOMPLEXITY           3
+
+#define LDAC_PACKMODE_REFERENCE    0
+#define LDAC_PACKMODE_FUSED        1
+
+#define LDAC_MAXDECGAIN       LDACBT_DEC_GAIN_UNITY
+
+#define LDAC_DECQUALITY_HIGH       0
+#define LDAC_DECQUALITY_LOW        1
+#define LDAC_NDECQUALITY           2
+
 /***************************************************************************************************
     Function Declarations
 ***************************************************************************************************/
@@ -74,6 +89,7 @@ DECLSPEC LDAC_RESULT ldaclib_set_frame_header(HANDLE_LDAC, unsigned char *, int,
 #ifndef _ENCODE_ONLY
 DECLSPEC LDAC_RESULT ldaclib_get_frame_header(HANDLE_LDAC, unsigned char *, int *, int *, int *, int *);
 DECLSPEC LDAC_RESULT ldaclib_check_frame_header(HANDLE_LDAC, int, int);
+DECLSPEC LDAC_RESULT ldaclib_set_frame_info(HANDLE_LDAC, int, int);
 #endif /* _ENCODE_ONLY */
 
 #ifndef _DECODE_ONLY
@@ -82,10 +98,15 @@ DECLSPEC LDAC_RESULT ldaclib_get_encode_setting(int, int, int *, int *, int *, i
 DECLSPEC LDAC_RESULT ldaclib_set_encode_frame_length(HANDLE_LDAC, int);
 DECLSPEC LDAC_RESULT ldaclib_get_encode_frame_length(HANDLE_LDAC, int *);
 DECLSPEC LDAC_RESULT ldaclib_set_encode_info(HANDLE_LDAC, int, int, int, int, int, int, int);
+DECLSPEC LDAC_RESULT ldaclib_set_encode_warm_start(HANDLE_LDAC, int);
+DECLSPEC LDAC_RESULT ldaclib_set_encode_complexity(HANDLE_LDAC, int);
+DECLSPEC LDAC_RESULT ldaclib_get_encode_complexity(HANDLE_LDAC, int *);
+DECLSPEC LDAC_RESULT ldaclib_set_encode_pack_mode(HANDLE_LDAC, int);
 DECLSPEC LDAC_RESULT ldaclib_init_encode(HANDLE_LDAC);
 DECLSPEC LDAC_RESULT ldaclib_free_encode(HANDLE_LDAC);
 DECLSPEC LDAC_RESULT ldaclib_encode(HANDLE_LDAC, char *[], LDAC_SMPL_FMT_T, unsigned char *, int *);
 DECLSPEC LDAC_RESULT ldaclib_flush_encode(HANDLE_LDAC, LDAC_SMPL_FMT_T, unsigned char *, int *);
+DECLSPEC LDAC_RESULT ldaclib_get_encode_features(HANDLE_LDAC, int, int *, int *, int *, int *, int *, int *);
 #endif /* _DECODE_ONLY */
 
 #ifndef _ENCODE_ONLY
@@ -93,6 +114,12 @@ DECLSPEC LDAC_RESULT ldaclib_flush_encode(HANDLE_LDAC, LDAC_SMPL_FMT_T, unsigned
 DECLSPEC LDAC_RESULT ldaclib_init_decode(HANDLE_LDAC, int);
 DECLSPEC LDAC_RESULT ldaclib_free_decode(HANDLE_LDAC);
 DECLSPEC LDAC_RESULT ldaclib_decode(HANDLE_LDAC, unsigned char *, char *[], int, int *, LDAC_SMPL_FMT_T);
+DECLSPEC LDAC_RESULT ldaclib_decode_conceal(HANDLE_LDAC, char *[], LDAC_SMPL_FMT_T);
+DECLSPEC LDAC_RESULT ldaclib_set_decode_gain(HANDLE_LDAC, int, int);
+DECLSPEC LDAC_RESULT ldaclib_set_decode_quality(HANDLE_LDAC, int, int);
+DECLSPEC LDAC_RESULT ldaclib_decode_mix_frame(HANDLE_LDAC, unsigned char *, int, int *, int, int *);
+DECLSPEC LDAC_RESULT ldaclib_decode_mix_output(HANDLE_LDAC, char *[], LDAC_SMPL_FMT_T, int);
+DECLSPEC LDAC_RESULT ldaclib_decode_spectrum(HANDLE_LDAC, unsigned char *, char *[], int *[], int *[], int, int *, int *, LDAC_SMPL_FMT_T);
 #endif /* _ENCODE_ONLY */
 
 /* Error Code Dispatch */
@@ -157,6 +184,8 @@ DECLSPEC LDAC_RESULT ldaclib_clear_internal_error_code(HANDLE_LDAC);
 #define LDAC_ERR_ENC_ILL_GRADPAR_D        555
 #define LDAC_ERR_ENC_ILL_NBANDS           556
 #define LDAC_ERR_PACK_BLOCK_FAILED        557
+#define LDAC_ERR_ENC_ILL_COMPLEXITY       558
+#define LDAC_ERR_ENC_ILL_PACKMODE         559
 
 #define LDAC_ERR_DEC_INIT_ALLOC           570
 #define LDAC_ERR_INPUT_BUFFER_SIZE        571
@@ -165,6 +194,8 @@ DECLSPEC LDAC_RESULT ldaclib_clear_internal_error_code(HANDLE_LDAC);
 #define LDAC_ERR_UNPACK_FRAME_ALIGN       574
 #define LDAC_ERR_FRAME_LENGTH_OVER        575
 #define LDAC_ERR_FRAME_ALIGN_OVER         576
+#define LDAC_ERR_DEC_ILL_GAIN             577
+#define LDAC_ERR_DEC_ILL_QUALITY          578
 
 #define LDAC_ERR_FRAME_LIMIT              998
 #define LDAC_ERR_TIME_EXPIRED             999
@@ -290,6 +290,15 @@ void)
         clear_data_ldac(hData, sizeof(HANDLE_LDAC_STRUCT));
         hData->sfinfo.p_mempos = (char *)NULL;
         hData->error_code = LDAC_ERR_NONE;
+        hData->complexity = LDAC_COMPLEXITY_DEFAULT;
+        hData->pack_mode = LDAC_PACKMODE_FUSED;
+#ifndef _ENCODE_ONLY
+        hData->a_gain[0] = hData->a_gain_target[0] = LDAC_GAIN_UNITY;
+        hData->a_gain[1] = hData->a_gain_target[1] = LDAC_GAIN_UNITY;
+        hData->dec_quality = LDAC_DECQUALITY_HIGH;
+        hData->dec_nqus = LDAC_MAXNQUS;
+        hData->nqus_nlnn = LDAC_MAXNQUS;
+#endif /* _ENCODE_ONLY */
     }
 
     return hData;
@@ -364,6 +373,39 @@ int frame_status)
     return LDAC_S_OK;
 }
 
+#ifndef _ENCODE_ONLY
+/***************************************************************************************************
+    Set Frame Information
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_set_frame_info(
+HANDLE_LDAC hData,
+int frame_length,
+int frame_status)
+{
+    CFG *p_cfg = &hData->sfinfo.cfg;
+
+    if (!ldaclib_assert_frame_length(frame_length)) {
+        hData->error_code = LDAC_ERR_ASSERT_FRAME_LENGTH;
+        return LDAC_E_FAIL;
+    }
+
+    if (!ldaclib_assert_supported_frame_length(frame_length, p_cfg->chconfig_id)) {
+        hData->error_code = LDAC_ERR_ASSERT_SUP_FRAME_LENGTH;
+        return LDAC_E_FAIL;
+    }
+
+    if (!ldaclib_assert_frame_status(frame_status)) {
+        hData->error_code = LDAC_ERR_ASSERT_FRAME_STATUS;
+        return LDAC_E_FAIL;
+    }
+
+    p_cfg->frame_length = frame_length;
+    p_cfg->frame_status = frame_status;
+
+    return LDAC_S_OK;
+}
+
+#endif /* _ENCODE_ONLY */
 /***************************************************************************************************
     Get Configuration Information
 ***************************************************************************************************/
@@ -668,6 +710,71 @@ int abc_status)
     return LDAC_S_OK;
 }
 
+/***************************************************************************************************
+    Set Warm Start of Bit Allocation
+***************************************************************************************************/
+/* Independent of the complexity level; LDAC_COMPLEXITY_FAST warm starts regardless of this switch */
+DECLSPEC LDAC_RESULT ldaclib_set_encode_warm_start(
+HANDLE_LDAC hData,
+int warm_start)
+{
+    hData->warm_start = (warm_start) ? LDAC_TRUE : LDAC_FALSE;
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Set Complexity Level
+***************************************************************************************************/
+/* Interval of Frame Status Analysis in Frames */
+static const int sa_ana_interval_ldac[LDAC_NCOMPLEXITY] = {
+    4, 1, 1,
+};
+
+DECLSPEC LDAC_RESULT ldaclib_set_encode_complexity(
+HANDLE_LDAC hData,
+int complexity)
+{
+    if ((complexity < LDAC_COMPLEXITY_FAST) || (LDAC_COMPLEXITY_EXHAUSTIVE < complexity)) {
+        hData->error_code = LDAC_ERR_ENC_ILL_COMPLEXITY;
+        return LDAC_E_FAIL;
+    }
+
+    hData->complexity = complexity;
+    hData->ana_cnt = 0;
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Get Complexity Level
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_get_encode_complexity(
+HANDLE_LDAC hData,
+int *p_complexity)
+{
+    *p_complexity = hData->complexity;
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Set Packing Mode
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_set_encode_pack_mode(
+HANDLE_LDAC hData,
+int pack_mode)
+{
+    if ((pack_mode != LDAC_PACKMODE_REFERENCE) && (pack_mode != LDAC_PACKMODE_FUSED)) {
+        hData->error_code = LDAC_ERR_ENC_ILL_PACKMODE;
+        return LDAC_E_FAIL;
+    }
+
+    hData->pack_mode = pack_mode;
+
+    return LDAC_S_OK;
+}
+
 /***************************************************************************************************
     Initialize
 ***************************************************************************************************/
@@ -732,11 +839,17 @@ int *p_nbytes_used)
 
     proc_mdct_ldac(p_sfinfo, hData->nlnn);
 
-    p_sfinfo->cfg.frame_status = ana_frame_status_ldac(p_sfinfo, hData->nlnn);
+    if (hData->ana_cnt == 0) {
+        p_sfinfo->cfg.frame_status = ana_frame_status_ldac(p_sfinfo);
+    }
+    if (++hData->ana_cnt >= sa_ana_interval_ldac[hData->complexity]) {
+        hData->ana_cnt = 0;
+    }
 
     error_code = encode_ldac(p_sfinfo, hData->nbands, hData->grad_mode,
             hData->grad_qu_l, hData->grad_qu_h, hData->grad_os_l, hData->grad_os_h,
-            hData->abc_status);
+            hData->abc_status, (hData->warm_start || (hData->complexity == LDAC_COMPLEXITY_FAST)),
+            hData->complexity, hData->pack_mode);
     if (LDAC_ERROR(error_code) && !LDAC_FATAL_ERROR(error_code)) {
         int error_code2;
         error_code2 = pack_null_data_frame_ldac(p_sfinfo, (STREAM *)p_stream, &loc, p_nbytes_used);
@@ -796,6 +909,41 @@ int *p_nbytes_used)
 
     return result;
 }
+
+/***************************************************************************************************
+    Get Signal Analysis Features of Last Encoded Frame
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_get_encode_features(
+HANDLE_LDAC hData,
+int ich,
+int *p_frame_status,
+int *p_low_energy,
+int *p_centroid,
+int *p_zero_cross,
+int *p_nqus,
+int *p_idsf)
+{
+    SFINFO *p_sfinfo = &hData->sfinfo;
+    AC *p_ac;
+    int iqu;
+
+    if ((ich < 0) || (p_sfinfo->cfg.ch <= ich)) {
+        hData->error_code = LDAC_ERR_ASSERT_CHANNEL_CONFIG;
+        return LDAC_E_FAIL;
+    }
+
+    p_ac = p_sfinfo->ap_ac[ich];
+    *p_frame_status = p_sfinfo->cfg.frame_status;
+    *p_low_energy = p_ac->low_energy;
+    *p_centroid = p_ac->centroid;
+    *p_zero_cross = p_ac->zero_cross;
+    *p_nqus = p_ac->p_ab->nqus;
+    for (iqu = 0; iqu < p_ac->p_ab->nqus; iqu++) {
+        p_idsf[iqu] = p_ac->a_idsf[iqu];
+    }
+
+    return LDAC_S_OK;
+}
 #endif /* _DECODE_ONLY */
 
 
@@ -824,6 +972,12 @@ int nlnn_shift)
 
     set_imdct_table_ldac(hData->nlnn);
 
+    /* QUs beyond the IMDCT length are not dequantized */
+    hData->nqus_nlnn = LDAC_MAXNQUS;
+    while (ga_isp_ldac[hData->nqus_nlnn] > npow2_ldac(hData->nlnn)) {
+        hData->nqus_nlnn--;
+    }
+
 
     result = init_decode_ldac(p_sfinfo);
     if (result != LDAC_S_OK) {
@@ -831,6 +985,11 @@ int nlnn_shift)
         return LDAC_E_FAIL;
     }
 
+    hData->nconceal = 0;
+    hData->conceal_seed = LDAC_CONCEALSEED;
+    hData->a_gain[0] = hData->a_gain_target[0];
+    hData->a_gain[1] = hData->a_gain_target[1];
+
     return LDAC_S_OK;
 }
 
@@ -847,6 +1006,69 @@ HANDLE_LDAC hData)
     return LDAC_S_OK;
 }
 
+/***************************************************************************************************
+    Set Decoder Gain
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_set_decode_gain(
+HANDLE_LDAC hData,
+int ich,
+int gain)
+{
+    if ((ich < 0) || (ich >= LDAC_MAXNCH) || (gain < 0) || (gain > LDAC_MAXDECGAIN)) {
+        hData->error_code = LDAC_ERR_DEC_ILL_GAIN;
+        return LDAC_E_FAIL;
+    }
+
+    hData->a_gain_target[ich] = gain << (LDAC_Q_GAIN-15);
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Set Decoder Quality
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_set_decode_quality(
+HANDLE_LDAC hData,
+int quality,
+int nqus)
+{
+    if ((quality < 0) || (quality >= LDAC_NDECQUALITY) || (nqus < 0) || (nqus > LDAC_MAXNQUS)) {
+        hData->error_code = LDAC_ERR_DEC_ILL_QUALITY;
+        return LDAC_E_FAIL;
+    }
+
+    hData->dec_quality = quality;
+    hData->dec_nqus = nqus;
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Subfunction: Ramp Decoder Gain toward Target and Apply Decoder Quality by a Frame
+***************************************************************************************************/
+static void update_decode_gain_ldac(
+HANDLE_LDAC hData)
+{
+    SFINFO *p_sfinfo = &hData->sfinfo;
+    int ich, diff;
+
+    for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+        diff = hData->a_gain_target[ich] - hData->a_gain[ich];
+        if (diff > LDAC_GAINSTEP) {
+            diff = LDAC_GAINSTEP;
+        }
+        else if (diff < -LDAC_GAINSTEP) {
+            diff = -LDAC_GAINSTEP;
+        }
+        hData->a_gain[ich] += diff;
+        p_sfinfo->ap_ac[ich]->gain = hData->a_gain[ich];
+        p_sfinfo->ap_ac[ich]->skip_residual = (hData->dec_quality == LDAC_DECQUALITY_LOW);
+        p_sfinfo->ap_ac[ich]->nqus_limit = min_ldac(hData->dec_nqus, hData->nqus_nlnn);
+    }
+
+    return;
+}
+
 /***************************************************************************************************
     Decode
 ***************************************************************************************************/
@@ -860,6 +1082,7 @@ LDAC_SMPL_FMT_T sample_format)
 {
     SFINFO *p_sfinfo = &hData->sfinfo;
     LDAC_RESULT result = LDAC_S_OK;
+    int ich;
     int loc = 0;
     int error_code;
 
@@ -874,13 +1097,18 @@ LDAC_SMPL_FMT_T sample_format)
         return LDAC_E_FAIL;
     }
 
+    update_decode_gain_ldac(hData);
+
     error_code = unpack_raw_data_frame_ldac(p_sfinfo, (STREAM *)p_stream, &loc, p_nbytes_used);
     if (LDAC_ERROR(error_code)) {
         hData->error_code = error_code;
         return LDAC_E_FAIL;
     }
 
-    decode_ldac(p_sfinfo);
+    for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+        hold_spectrum_ldac(p_sfinfo->ap_ac[ich]);
+    }
+    hData->nconceal = 0;
 
 #ifndef NONPCM_OUTPUT_FOR_SNK_TEST_TOOL
     proc_imdct_ldac(p_sfinfo, hData->nlnn);
@@ -900,6 +1128,200 @@ LDAC_SMPL_FMT_T sample_format)
 
     return result;
 }
+
+/***************************************************************************************************
+    Conceal Lost Frame
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_decode_conceal(
+HANDLE_LDAC hData,
+char *ap_pcm[],
+LDAC_SMPL_FMT_T sample_format)
+{
+    SFINFO *p_sfinfo = &hData->sfinfo;
+    int ich;
+    int nsmpl = npow2_ldac(hData->nlnn);
+
+    if (!ldaclib_assert_sample_format(sample_format)) {
+        hData->error_code = LDAC_ERR_ILL_SMPL_FORMAT;
+        return LDAC_E_FAIL;
+    }
+
+    /* Fade out the last decoded spectra, then mute */
+    for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+        if (hData->nconceal < LDAC_MAXNCONCEAL) {
+            conceal_spectrum_ldac(p_sfinfo->ap_ac[ich], nsmpl, &hData->conceal_seed);
+        }
+        else {
+            clear_spectrum_ldac(p_sfinfo->ap_ac[ich], 0);
+        }
+    }
+    if (hData->nconceal < LDAC_MAXNCONCEAL) {
+        hData->nconceal++;
+    }
+
+    proc_imdct_ldac(p_sfinfo, hData->nlnn);
+
+    set_output_pcm_ldac(p_sfinfo, ap_pcm, sample_format, hData->nlnn);
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Decode Frame to Mix
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_decode_mix_frame(
+HANDLE_LDAC hData,
+unsigned char *p_stream,
+int frame_length,
+int *p_nbytes_used,
+int istrm,
+int *p_nmix)
+{
+    SFINFO *p_sfinfo = &hData->sfinfo;
+    int ich;
+    int loc = 0;
+    int error_code;
+
+    if (frame_length < p_sfinfo->cfg.frame_length) {
+        hData->error_code = LDAC_ERR_INPUT_BUFFER_SIZE;
+        return LDAC_E_FAIL;
+    }
+
+    if (istrm == 0) {
+        update_decode_gain_ldac(hData);
+        *p_nmix = 0;
+    }
+
+    error_code = unpack_raw_data_frame_ldac(p_sfinfo, (STREAM *)p_stream, &loc, p_nbytes_used);
+    if (LDAC_ERROR(error_code)) {
+        hData->error_code = error_code;
+        return LDAC_E_FAIL;
+    }
+
+    error_code = p_sfinfo->error_code;
+    if (LDAC_ERROR(error_code) && !LDAC_FATAL_ERROR(error_code)) {
+        return LDAC_S_FALSE;
+    }
+
+    /* Accumulate into the mixed spectra, the held spectra are kept for concealment */
+    for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+        mix_spectrum_ldac(p_sfinfo->ap_ac[ich], *p_nmix);
+    }
+    ++*p_nmix;
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Output Mixed Frames
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_decode_mix_output(
+HANDLE_LDAC hData,
+char *ap_pcm[],
+LDAC_SMPL_FMT_T sample_format,
+int nmix)
+{
+    SFINFO *p_sfinfo = &hData->sfinfo;
+    AC *p_ac;
+    int ich;
+
+    if (!ldaclib_assert_sample_format(sample_format)) {
+        hData->error_code = LDAC_ERR_ILL_SMPL_FORMAT;
+        return LDAC_E_FAIL;
+    }
+
+    for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+        p_ac = p_sfinfo->ap_ac[ich];
+        if (nmix > 0) {
+            copy_data_ldac(p_ac->p_acsub->a_mspec, p_ac->p_acsub->a_spec, sizeof(p_ac->p_acsub->a_spec));
+        }
+        else {
+            clear_spectrum_ldac(p_ac, 0);
+        }
+        hold_spectrum_ldac(p_ac);
+    }
+    hData->nconceal = 0;
+
+    /* One IMDCT for all the mixed frames */
+    proc_imdct_ldac(p_sfinfo, hData->nlnn);
+
+    set_output_pcm_ldac(p_sfinfo, ap_pcm, sample_format, hData->nlnn);
+
+    return LDAC_S_OK;
+}
+
+/***************************************************************************************************
+    Decode Spectrum
+***************************************************************************************************/
+DECLSPEC LDAC_RESULT ldaclib_decode_spectrum(
+HANDLE_LDAC hData,
+unsigned char *p_stream,
+char *ap_spec[],
+int *ap_idsf[],
+int *ap_idwl[],
+int frame_length,
+int *p_nbytes_used,
+int *p_nqus,
+LDAC_SMPL_FMT_T sample_format)
+{
+    SFINFO *p_sfinfo = &hData->sfinfo;
+    LDAC_RESULT result = LDAC_S_OK;
+    int ich;
+    int loc = 0;
+    int error_code;
+    int nqus;
+
+    if (frame_length < p_sfinfo->cfg.frame_length) {
+        hData->error_code = LDAC_ERR_INPUT_BUFFER_SIZE;
+        return LDAC_E_FAIL;
+    }
+
+#ifndef _32BIT_FIXED_POINT
+    if ((sample_format != LDAC_SMPL_FMT_S32) && (sample_format != LDAC_SMPL_FMT_F32)) {
+#else /* _32BIT_FIXED_POINT */
+    if (sample_format != LDAC_SMPL_FMT_S32) {
+#endif /* _32BIT_FIXED_POINT */
+        hData->error_code = LDAC_ERR_ILL_SMPL_FORMAT;
+        return LDAC_E_FAIL;
+    }
+
+    update_decode_gain_ldac(hData);
+
+    error_code = unpack_raw_data_frame_ldac(p_sfinfo, (STREAM *)p_stream, &loc, p_nbytes_used);
+    if (LDAC_ERROR(error_code)) {
+        hData->error_code = error_code;
+        return LDAC_E_FAIL;
+    }
+
+    for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+        hold_spectrum_ldac(p_sfinfo->ap_ac[ich]);
+    }
+    hData->nconceal = 0;
+
+    error_code = p_sfinfo->error_code;
+    if (LDAC_ERROR(error_code) && !LDAC_FATAL_ERROR(error_code)) {
+        result = LDAC_S_FALSE;
+    }
+
+    for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+        p_nqus[ich] = p_sfinfo->ap_ac[ich]->p_ab->nqus;
+    }
+
+    if (LDAC_SUCCEEDED(result)) {
+        set_output_spectrum_ldac(p_sfinfo, ap_spec, sample_format, hData->nlnn);
+        for (ich = 0; ich < p_sfinfo->cfg.ch; ich++) {
+            nqus = p_nqus[ich];
+            if (ap_idsf != NULL) {
+                copy_data_ldac(p_sfinfo->ap_ac[ich]->a_idsf, ap_idsf[ich], nqus*sizeof(int));
+            }
+            if (ap_idwl != NULL) {
+                copy_data_ldac(p_sfinfo->ap_ac[ich]->a_idwl1, ap_idwl[ich], nqus*sizeof(int));
+            }
+        }
+    }
+
+    return result;
+}
 #endif /* _ENCODE_ONLY */
 
 
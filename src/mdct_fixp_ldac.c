@@ -10,12 +10,13 @@
 /***************************************************************************************************
     Subfunction: Process MDCT Core
 ***************************************************************************************************/
-static void proc_mdct_core_ldac(
+static int proc_mdct_core_ldac(
 INT32 *p_x,
 INT32 *p_y,
 int nlnn)
 {
     INT32 i, j, k;
+    int zero_cross = 0;
     INT32 loop1, loop2;
     INT32 coef, index0, index1, offset;
     int nsmpl = npow2_ldac(nlnn);
@@ -24,15 +25,28 @@ int nlnn)
     const INT32 *p_w, *p_c, *p_s;
     INT32 a_work[LDAC_MAXLSU];
     INT32 g0, g1, g2, g3;
+    INT32 absmax, val, prev;
 
-    i = nlnn - LDAC_1FSLNN;
+    i = nlnn - LDAC_MINLNN;
     p_w = gaa_fwin_ldac[i];
     p_c = gaa_wcos_ldac[i];
     p_s = gaa_wsin_ldac[i];
     p_p = gaa_perm_ldac[i];
 
-    /* Block Floating */
-    shift = LDAC_C_BLKFLT - get_bit_length_ldac(get_absmax_ldac(p_x, nsmpl<<1)) - 1;
+    /* Block Floating and Counting Zero Cross */
+    absmax = abs(p_x[0]);
+    prev = 0;
+    for (i = 0; i < nsmpl<<1; i++) {
+        val = abs(p_x[i]);
+        if (absmax < val) {
+            absmax = val;
+        }
+        if ((prev != 0) && (p_x[i] != 0) && ((prev ^ p_x[i]) < 0)) {
+            zero_cross++;
+        }
+        prev = p_x[i];
+    }
+    shift = LDAC_C_BLKFLT - get_bit_length_ldac(absmax) - 1;
     if (shift < 0) {
         shift = 0;
     }
@@ -114,7 +128,7 @@ int nlnn)
     }
 
 
-    return;
+    return zero_cross;
 }
 
 /***************************************************************************************************
@@ -130,7 +144,7 @@ int nlnn)
 
     for (ich = 0; ich < nchs; ich++) {
         p_ac = p_sfinfo->ap_ac[ich];
-        proc_mdct_core_ldac(p_ac->p_acsub->a_time, p_ac->p_acsub->a_spec, nlnn);
+        p_ac->zero_cross = proc_mdct_core_ldac(p_ac->p_acsub->a_time, p_ac->p_acsub->a_spec, nlnn);
     }
 
     return;
@@ -10,12 +10,13 @@
 /***************************************************************************************************
     Subfunction: Process MDCT Core
 ***************************************************************************************************/
-static void proc_mdct_core_ldac(
+static int proc_mdct_core_ldac(
 SCALAR *p_x,
 SCALAR *p_y,
 int nlnn)
 {
     int i, j, k;
+    int zero_cross = 0;
     int loop1, loop2;
     int coef, index0, index1, offset;
     int nsmpl = npow2_ldac(nlnn);
@@ -25,18 +26,27 @@ int nlnn)
     SCALAR *p_work = a_work;
     SCALAR a, b, c, d, tmp;
     SCALAR cc, cs;
+    SCALAR prev;
 
-    i = nlnn - LDAC_1FSLNN;
+    i = nlnn - LDAC_MINLNN;
     p_w = gaa_fwin_ldac[i];
     p_c = gaa_wcos_ldac[i];
     p_s = gaa_wsin_ldac[i];
     p_p = gaa_perm_ldac[i];
 
-    /* Windowing */
+    /* Windowing and Counting Zero Cross */
+    prev = _scalar(0.0);
     for (i = 0; i < nsmpl>>1; i++) {
         p_work[p_p[i]] = -p_x[3*nsmpl/2-1-i] * p_w[nsmpl/2+i] - p_x[3*nsmpl/2+i] * p_w[nsmpl/2-1-i];
 
         p_work[p_p[nsmpl/2+i]] = p_x[i] * p_w[i] - p_x[nsmpl-1-i] * p_w[nsmpl-1-i];
+
+        /* each sample pair (p_x[m-1], p_x[m]) of the 2 frames is counted once */
+        zero_cross += (prev * p_x[i] < _scalar(0.0));
+        zero_cross += (p_x[nsmpl-2-i] * p_x[nsmpl-1-i] < _scalar(0.0));
+        zero_cross += (p_x[3*nsmpl/2-2-i] * p_x[3*nsmpl/2-1-i] < _scalar(0.0));
+        zero_cross += (p_x[3*nsmpl/2-1+i] * p_x[3*nsmpl/2+i] < _scalar(0.0));
+        prev = p_x[i];
     }
 
     /* Butterfly */
@@ -82,7 +92,7 @@ int nlnn)
         p_y[nsmpl-index0-1] = b * tmp;
     }
 
-    return;
+    return zero_cross;
 }
 
 /***************************************************************************************************
@@ -98,7 +108,7 @@ int nlnn)
 
     for (ich = 0; ich < nchs; ich++) {
         p_ac = p_sfinfo->ap_ac[ich];
-        proc_mdct_core_ldac(p_ac->p_acsub->a_time, p_ac->p_acsub->a_spec, nlnn);
+        p_ac->zero_cross = proc_mdct_core_ldac(p_ac->p_acsub->a_time, p_ac->p_acsub->a_spec, nlnn);
     }
 
     return;
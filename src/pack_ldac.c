@@ -7,34 +7,73 @@
 #include "ldac.h"
 
 #ifndef _DECODE_ONLY
+/***************************************************************************************************
+    Initialize Bit Writer
+***************************************************************************************************/
+#define LDAC_WORDSIZE 32
+
+static void init_bit_writer_ldac(
+BITWR *p_bw,
+STREAM *p_stream,
+int loc)
+{
+    int bpos = loc & LDAC_LOC_MASK;
+
+    p_bw->p_pos = p_stream + (loc >> LDAC_LOC_SHIFT);
+    /* Keep the bits already written to the current byte */
+    p_bw->acc = (bpos > 0) ? (*p_bw->p_pos >> (LDAC_BYTESIZE-bpos)) : 0;
+    p_bw->nacc = bpos;
+    p_bw->loc = loc;
+
+    return;
+}
+
 /***************************************************************************************************
     Pack and Store from MSB
 ***************************************************************************************************/
-static void pack_store_ldac(
+__inline static void pack_store_ldac(
 int idata,
 int nbits,
-STREAM *p_block,
-int *p_loc)
+BITWR *p_bw)
 {
-    STREAM *p_bufptr;
-    register int bpos;
-    register unsigned int tmp;
+    UINT32 tmp;
+
+    p_bw->acc = (p_bw->acc << nbits) | ((UINT32)idata & (((UINT32)1 << nbits) - 1));
+    p_bw->nacc += nbits;
+    p_bw->loc += nbits;
+
+    if (p_bw->nacc >= LDAC_WORDSIZE) {
+        p_bw->nacc -= LDAC_WORDSIZE;
+        tmp = (UINT32)(p_bw->acc >> p_bw->nacc);
+        p_bw->p_pos[0] = (STREAM)(tmp >> 24);
+        p_bw->p_pos[1] = (STREAM)(tmp >> 16);
+        p_bw->p_pos[2] = (STREAM)(tmp >> 8);
+        p_bw->p_pos[3] = (STREAM)tmp;
+        p_bw->p_pos += LDAC_WORDSIZE / LDAC_BYTESIZE;
+    }
 
-    p_bufptr = p_block + (*p_loc >> LDAC_LOC_SHIFT);
-    bpos = *p_loc & LDAC_LOC_MASK;
+    return;
+}
 
-    tmp = (idata << (24-nbits)) & 0xffffff;
-    tmp >>= bpos;
-    *p_bufptr++ |= (tmp>>16);
-    *p_bufptr++ = (tmp>>8) & 0xff;
-    *p_bufptr = tmp & 0xff;
+/***************************************************************************************************
+    Flush Bit Writer
+***************************************************************************************************/
+static void flush_bit_writer_ldac(
+BITWR *p_bw)
+{
+    while (p_bw->nacc >= LDAC_BYTESIZE) {
+        p_bw->nacc -= LDAC_BYTESIZE;
+        *p_bw->p_pos++ = (STREAM)(p_bw->acc >> p_bw->nacc);
+    }
 
-    *p_loc += nbits;
+    /* The last byte is padded with zeros */
+    if (p_bw->nacc > 0) {
+        *p_bw->p_pos = (STREAM)(p_bw->acc << (LDAC_BYTESIZE-p_bw->nacc));
+    }
 
     return;
 }
 
-
 /***************************************************************************************************
     Pack Frame Header
 ***************************************************************************************************/
@@ -45,17 +84,21 @@ int frame_length,
 int frame_status,
 STREAM *p_stream)
 {
-    int loc = 0;
+    BITWR bw;
+
+    init_bit_writer_ldac(&bw, p_stream, 0);
+
+    pack_store_ldac(LDAC_SYNCWORD, LDAC_SYNCWORDBITS, &bw);
 
-    pack_store_ldac(LDAC_SYNCWORD, LDAC_SYNCWORDBITS, p_stream, &loc);
+    pack_store_ldac(smplrate_id, LDAC_SMPLRATEBITS, &bw);
 
-    pack_store_ldac(smplrate_id, LDAC_SMPLRATEBITS, p_stream, &loc);
+    pack_store_ldac(chconfig_id, LDAC_CHCONFIG2BITS, &bw);
 
-    pack_store_ldac(chconfig_id, LDAC_CHCONFIG2BITS, p_stream, &loc);
+    pack_store_ldac(frame_length-1, LDAC_FRAMELEN2BITS, &bw);
 
-    pack_store_ldac(frame_length-1, LDAC_FRAMELEN2BITS, p_stream, &loc);
+    pack_store_ldac(frame_status, LDAC_FRAMESTATBITS, &bw);
 
-    pack_store_ldac(frame_status, LDAC_FRAMESTATBITS, p_stream, &loc);
+    flush_bit_writer_ldac(&bw);
 
     return;
 }
@@ -64,37 +107,37 @@ STREAM *p_stream)
     Pack Frame Alignment
 ***************************************************************************************************/
 static void pack_frame_alignment_ldac(
-STREAM *p_stream,
-int *p_loc,
+BITWR *p_bw,
 int nbytes_frame)
 {
     int i;
     int nbytes_filled;
 
-    nbytes_filled = nbytes_frame - *p_loc / LDAC_BYTESIZE;
+    nbytes_filled = nbytes_frame - p_bw->loc / LDAC_BYTESIZE;
 
     for (i = 0; i < nbytes_filled; i++) {
-        pack_store_ldac(LDAC_FILLCODE, LDAC_BYTESIZE, p_stream, p_loc);
+        pack_store_ldac(LDAC_FILLCODE, LDAC_BYTESIZE, p_bw);
     }
 
+    flush_bit_writer_ldac(p_bw);
+
     return;
 }
 
 /***************************************************************************************************
     Pack Byte Alignment
 ***************************************************************************************************/
-#define pack_block_alignment_ldac(p_stream, p_loc) pack_byte_alignment_ldac((p_stream), (p_loc))
+#define pack_block_alignment_ldac(p_bw) pack_byte_alignment_ldac((p_bw))
 
 static void pack_byte_alignment_ldac(
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     int nbits_padding;
 
-    nbits_padding = ((*p_loc + LDAC_BYTESIZE - 1) / LDAC_BYTESIZE) * LDAC_BYTESIZE - *p_loc;
+    nbits_padding = ((p_bw->loc + LDAC_BYTESIZE - 1) / LDAC_BYTESIZE) * LDAC_BYTESIZE - p_bw->loc;
 
     if (nbits_padding > 0) {
-        pack_store_ldac(0, nbits_padding, p_stream, p_loc);
+        pack_store_ldac(0, nbits_padding, p_bw);
     }
 
     return;
@@ -105,12 +148,11 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_band_info_ldac(
 AB *p_ab,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
-    pack_store_ldac(p_ab->nbands-LDAC_BAND_OFFSET, LDAC_NBANDBITS, p_stream, p_loc);
+    pack_store_ldac(p_ab->nbands-LDAC_BAND_OFFSET, LDAC_NBANDBITS, p_bw);
 
-    pack_store_ldac(LDAC_FALSE, LDAC_FLAGBITS, p_stream, p_loc);
+    pack_store_ldac(LDAC_FALSE, LDAC_FLAGBITS, p_bw);
 
     return;
 }
@@ -120,27 +162,26 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_gradient_ldac(
 AB *p_ab,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
-    pack_store_ldac(p_ab->grad_mode, LDAC_GRADMODEBITS, p_stream, p_loc);
+    pack_store_ldac(p_ab->grad_mode, LDAC_GRADMODEBITS, p_bw);
 
     if (p_ab->grad_mode == LDAC_MODE_0) {
-        pack_store_ldac(p_ab->grad_qu_l, LDAC_GRADQU0BITS, p_stream, p_loc);
+        pack_store_ldac(p_ab->grad_qu_l, LDAC_GRADQU0BITS, p_bw);
 
-        pack_store_ldac(p_ab->grad_qu_h-1, LDAC_GRADQU0BITS, p_stream, p_loc);
+        pack_store_ldac(p_ab->grad_qu_h-1, LDAC_GRADQU0BITS, p_bw);
 
-        pack_store_ldac(p_ab->grad_os_l, LDAC_GRADOSBITS, p_stream, p_loc);
+        pack_store_ldac(p_ab->grad_os_l, LDAC_GRADOSBITS, p_bw);
 
-        pack_store_ldac(p_ab->grad_os_h, LDAC_GRADOSBITS, p_stream, p_loc);
+        pack_store_ldac(p_ab->grad_os_h, LDAC_GRADOSBITS, p_bw);
     }
     else {
-        pack_store_ldac(p_ab->grad_qu_l, LDAC_GRADQU1BITS, p_stream, p_loc);
+        pack_store_ldac(p_ab->grad_qu_l, LDAC_GRADQU1BITS, p_bw);
 
-        pack_store_ldac(p_ab->grad_os_l, LDAC_GRADOSBITS, p_stream, p_loc);
+        pack_store_ldac(p_ab->grad_os_l, LDAC_GRADOSBITS, p_bw);
     }
 
-    pack_store_ldac(p_ab->nadjqus, LDAC_NADJQUBITS, p_stream, p_loc);
+    pack_store_ldac(p_ab->nadjqus, LDAC_NADJQUBITS, p_bw);
 
     return;
 }
@@ -150,8 +191,7 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_scale_factor_0_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     HCENC *p_hcsf;
     int iqu;
@@ -159,22 +199,22 @@ int *p_loc)
     int dif, val0, val1;
     const unsigned char *p_tbl;
 
-    pack_store_ldac(p_ac->sfc_bitlen-LDAC_MINSFCBLEN_0, LDAC_SFCBLENBITS, p_stream, p_loc);
+    pack_store_ldac(p_ac->sfc_bitlen-LDAC_MINSFCBLEN_0, LDAC_SFCBLENBITS, p_bw);
 
-    pack_store_ldac(p_ac->sfc_offset, LDAC_IDSFBITS, p_stream, p_loc);
+    pack_store_ldac(p_ac->sfc_offset, LDAC_IDSFBITS, p_bw);
 
-    pack_store_ldac(p_ac->sfc_weight, LDAC_SFCWTBLBITS, p_stream, p_loc);
+    pack_store_ldac(p_ac->sfc_weight, LDAC_SFCWTBLBITS, p_bw);
 
     p_tbl = gaa_sfcwgt_ldac[p_ac->sfc_weight];
     val0 = p_ac->a_idsf[0] + p_tbl[0];
 
-    pack_store_ldac(val0-p_ac->sfc_offset, p_ac->sfc_bitlen, p_stream, p_loc);
+    pack_store_ldac(val0-p_ac->sfc_offset, p_ac->sfc_bitlen, p_bw);
 
     p_hcsf = ga_hcenc_sf0_ldac + (p_ac->sfc_bitlen-LDAC_MINSFCBLEN_0);
     for (iqu = 1; iqu < nqus; iqu++) {
         val1 = p_ac->a_idsf[iqu] + p_tbl[iqu];
         dif = (val1 - val0) & p_hcsf->mask;
-        pack_store_ldac(hc_word_ldac(p_hcsf->p_tbl+dif), hc_len_ldac(p_hcsf->p_tbl+dif), p_stream, p_loc);
+        pack_store_ldac(hc_word_ldac(p_hcsf->p_tbl+dif), hc_len_ldac(p_hcsf->p_tbl+dif), p_bw);
         val0 = val1;
     }
 
@@ -186,28 +226,27 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_scale_factor_1_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     int iqu;
     int nqus = p_ac->p_ab->nqus;
     const unsigned char *p_tbl;
 
-    pack_store_ldac(p_ac->sfc_bitlen-LDAC_MINSFCBLEN_1, LDAC_SFCBLENBITS, p_stream, p_loc);
+    pack_store_ldac(p_ac->sfc_bitlen-LDAC_MINSFCBLEN_1, LDAC_SFCBLENBITS, p_bw);
 
     if (p_ac->sfc_bitlen > 4) {
         for (iqu = 0; iqu < nqus; iqu++) {
-            pack_store_ldac(p_ac->a_idsf[iqu], LDAC_IDSFBITS, p_stream, p_loc);
+            pack_store_ldac(p_ac->a_idsf[iqu], LDAC_IDSFBITS, p_bw);
         }
     }
     else {
-        pack_store_ldac(p_ac->sfc_offset, LDAC_IDSFBITS, p_stream, p_loc);
+        pack_store_ldac(p_ac->sfc_offset, LDAC_IDSFBITS, p_bw);
 
-        pack_store_ldac(p_ac->sfc_weight, LDAC_SFCWTBLBITS, p_stream, p_loc);
+        pack_store_ldac(p_ac->sfc_weight, LDAC_SFCWTBLBITS, p_bw);
 
         p_tbl = gaa_sfcwgt_ldac[p_ac->sfc_weight];
         for (iqu = 0; iqu < nqus; iqu++) {
-            pack_store_ldac(p_ac->a_idsf[iqu]+p_tbl[iqu]-p_ac->sfc_offset, p_ac->sfc_bitlen, p_stream, p_loc);
+            pack_store_ldac(p_ac->a_idsf[iqu]+p_tbl[iqu]-p_ac->sfc_offset, p_ac->sfc_bitlen, p_bw);
         }
     }
 
@@ -219,20 +258,19 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_scale_factor_2_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     HCENC *p_hcsf;
     int iqu;
     int nqus = p_ac->p_ab->nqus;
     int dif;
 
-    pack_store_ldac(p_ac->sfc_bitlen-LDAC_MINSFCBLEN_2, LDAC_SFCBLENBITS, p_stream, p_loc);
+    pack_store_ldac(p_ac->sfc_bitlen-LDAC_MINSFCBLEN_2, LDAC_SFCBLENBITS, p_bw);
 
     p_hcsf = ga_hcenc_sf1_ldac + (p_ac->sfc_bitlen-LDAC_MINSFCBLEN_2);
     for (iqu = 0; iqu < nqus; iqu++) {
         dif = (p_ac->a_idsf[iqu] - p_ac->p_ab->ap_ac[0]->a_idsf[iqu]) & p_hcsf->mask;
-        pack_store_ldac(hc_word_ldac(p_hcsf->p_tbl+dif), hc_len_ldac(p_hcsf->p_tbl+dif), p_stream, p_loc);
+        pack_store_ldac(hc_word_ldac(p_hcsf->p_tbl+dif), hc_len_ldac(p_hcsf->p_tbl+dif), p_bw);
     }
 
     return;
@@ -243,27 +281,26 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_scale_factor_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     int sfc_mode = p_ac->sfc_mode;
 
-    pack_store_ldac(sfc_mode, LDAC_SFCMODEBITS, p_stream, p_loc);
+    pack_store_ldac(sfc_mode, LDAC_SFCMODEBITS, p_bw);
 
     if (p_ac->ich == 0) {
         if (sfc_mode == LDAC_MODE_0) {
-            pack_scale_factor_0_ldac(p_ac, p_stream, p_loc);
+            pack_scale_factor_0_ldac(p_ac, p_bw);
         }
         else {
-            pack_scale_factor_1_ldac(p_ac, p_stream, p_loc);
+            pack_scale_factor_1_ldac(p_ac, p_bw);
         }
     }
     else {
         if (sfc_mode == LDAC_MODE_0) {
-            pack_scale_factor_0_ldac(p_ac, p_stream, p_loc);
+            pack_scale_factor_0_ldac(p_ac, p_bw);
         }
         else {
-            pack_scale_factor_2_ldac(p_ac, p_stream, p_loc);
+            pack_scale_factor_2_ldac(p_ac, p_bw);
         }
     }
 
@@ -275,42 +312,49 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_spectrum_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     int iqu, isp, i;
-    int lsp, hsp;
     int nqus = p_ac->p_ab->nqus;
+    int pack_mode = p_ac->p_ab->pack_mode;
     int nsps, idwl1, wl, val;
+    int a_qspec[LDAC_MAXNSPS];
+    int *p_qspec;
 
     for (iqu = 0; iqu < nqus; iqu++) {
-        lsp = ga_isp_ldac[iqu];
-        hsp = ga_isp_ldac[iqu+1];
+        isp = ga_isp_ldac[iqu];
         nsps = ga_nsps_ldac[iqu];
         idwl1 = p_ac->a_idwl1[iqu];
         wl = ga_wl_ldac[idwl1];
 
-        if (idwl1 == 1) {
-            isp = lsp;
+        if (pack_mode == LDAC_PACKMODE_FUSED) {
+            /* Only the residual is stored, it is packed after the whole spectrum */
+            p_qspec = a_qspec;
+            quant_spectrum_unit_ldac(p_ac, iqu, p_qspec, p_ac->a_rspec+isp);
+        }
+        else {
+            p_qspec = p_ac->a_qspec+isp;
+        }
 
+        if (idwl1 == 1) {
             if (nsps == 2) {
-                val  = (p_ac->a_qspec[isp  ]+1) << 2;
-                val += (p_ac->a_qspec[isp+1]+1);
-                pack_store_ldac(ga_2dimenc_spec_ldac[val], LDAC_2DIMSPECBITS, p_stream, p_loc);
+                val  = (p_qspec[0]+1) << 2;
+                val += (p_qspec[1]+1);
+                pack_store_ldac(ga_2dimenc_spec_ldac[val], LDAC_2DIMSPECBITS, p_bw);
             }
             else {
-                for (i = 0; i < nsps>>2; i++, isp+=4) {
-                    val  = (p_ac->a_qspec[isp  ]+1) << 6;
-                    val += (p_ac->a_qspec[isp+1]+1) << 4;
-                    val += (p_ac->a_qspec[isp+2]+1) << 2;
-                    val += (p_ac->a_qspec[isp+3]+1);
-                    pack_store_ldac(ga_4dimenc_spec_ldac[val], LDAC_4DIMSPECBITS, p_stream, p_loc);
+                for (i = 0; i < nsps; i+=4) {
+                    val  = (p_qspec[i  ]+1) << 6;
+                    val += (p_qspec[i+1]+1) << 4;
+                    val += (p_qspec[i+2]+1) << 2;
+                    val += (p_qspec[i+3]+1);
+                    pack_store_ldac(ga_4dimenc_spec_ldac[val], LDAC_4DIMSPECBITS, p_bw);
                 }
             }
         }
         else {
-            for (isp = lsp; isp < hsp; isp++) {
-                pack_store_ldac(p_ac->a_qspec[isp], wl, p_stream, p_loc);
+            for (i = 0; i < nsps; i++) {
+                pack_store_ldac(p_qspec[i], wl, p_bw);
             }
         }
     }
@@ -323,8 +367,7 @@ int *p_loc)
 ***************************************************************************************************/
 static void pack_residual_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     int iqu, isp;
     int lsp, hsp;
@@ -340,7 +383,7 @@ int *p_loc)
             wl = ga_wl_ldac[idwl2];
 
             for (isp = lsp; isp < hsp; isp++) {
-                pack_store_ldac(p_ac->a_rspec[isp], wl, p_stream, p_loc);
+                pack_store_ldac(p_ac->a_rspec[isp], wl, p_bw);
             }
         }
     }    
@@ -353,8 +396,7 @@ int *p_loc)
 ***************************************************************************************************/
 static int pack_audio_block_ldac(
 AB *p_ab,
-STREAM *p_stream,
-int *p_loc)
+BITWR *p_bw)
 {
     AC *p_ac;
     int ich;
@@ -367,30 +409,30 @@ int *p_loc)
         a_nbits_spec[ich] = 0;
     }
 
-    loc = *p_loc;
-    pack_band_info_ldac(p_ab, p_stream, p_loc);
-    nbits_band = *p_loc - loc;
+    loc = p_bw->loc;
+    pack_band_info_ldac(p_ab, p_bw);
+    nbits_band = p_bw->loc - loc;
 
-    loc = *p_loc;
-    pack_gradient_ldac(p_ab, p_stream, p_loc);
-    nbits_grad = *p_loc - loc;
+    loc = p_bw->loc;
+    pack_gradient_ldac(p_ab, p_bw);
+    nbits_grad = p_bw->loc - loc;
 
     nbits_used = nbits_band + nbits_grad;
 
     for (ich = 0; ich < nchs; ich++) {
         p_ac = p_ab->ap_ac[ich];
 
-        loc = *p_loc;
-        pack_scale_factor_ldac(p_ac, p_stream, p_loc);
-        a_nbits_scfc[ich] = *p_loc - loc;
+        loc = p_bw->loc;
+        pack_scale_factor_ldac(p_ac, p_bw);
+        a_nbits_scfc[ich] = p_bw->loc - loc;
 
-        loc = *p_loc;
-        pack_spectrum_ldac(p_ac, p_stream, p_loc);
-        a_nbits_spec[ich] = *p_loc - loc;
+        loc = p_bw->loc;
+        pack_spectrum_ldac(p_ac, p_bw);
+        a_nbits_spec[ich] = p_bw->loc - loc;
 
-        loc = *p_loc;
-        pack_residual_ldac(p_ac, p_stream, p_loc);
-        a_nbits_spec[ich] += *p_loc - loc;
+        loc = p_bw->loc;
+        pack_residual_ldac(p_ac, p_bw);
+        a_nbits_spec[ich] += p_bw->loc - loc;
 
         nbits_used += a_nbits_scfc[ich] + a_nbits_spec[ich];
     }
@@ -420,19 +462,24 @@ int *p_nbytes_used)
     AB *p_ab = p_sfinfo->p_ab;
     int ibk;
     int nbks = gaa_block_setting_ldac[p_cfg->chconfig_id][1];
+    BITWR bw;
+    BITWR *p_bw = &bw;
+
+    init_bit_writer_ldac(p_bw, p_stream, *p_loc);
 
     for (ibk = 0; ibk < nbks; ibk++) {
-        if (!pack_audio_block_ldac(p_ab, p_stream, p_loc)) {
+        if (!pack_audio_block_ldac(p_ab, p_bw)) {
             return LDAC_ERR_PACK_BLOCK_FAILED;
         }
 
-        pack_block_alignment_ldac(p_stream, p_loc);
+        pack_block_alignment_ldac(p_bw);
 
         p_ab++;
     }
 
-    pack_frame_alignment_ldac(p_stream, p_loc, p_cfg->frame_length);
+    pack_frame_alignment_ldac(p_bw, p_cfg->frame_length);
 
+    *p_loc = p_bw->loc;
     *p_nbytes_used = *p_loc / LDAC_BYTESIZE;
 
     return LDAC_ERR_NONE;
@@ -460,6 +507,7 @@ int *p_nbytes_used)
     int ibk;
     int nbks = gaa_block_setting_ldac[p_cfg->chconfig_id][1];
     int blk_type, size, offset = 0;
+    BITWR bw;
 
     for (ibk = 0; ibk < nbks; ibk++) {
         blk_type = p_ab->blk_type;
@@ -475,8 +523,10 @@ int *p_nbytes_used)
         return LDAC_ERR_PACK_BLOCK_FAILED;
     }
 
-    pack_frame_alignment_ldac(p_stream, p_loc, p_cfg->frame_length);
+    init_bit_writer_ldac(&bw, p_stream, *p_loc);
+    pack_frame_alignment_ldac(&bw, p_cfg->frame_length);
 
+    *p_loc = bw.loc;
     *p_nbytes_used = *p_loc / LDAC_BYTESIZE;
 
     return LDAC_ERR_NONE;
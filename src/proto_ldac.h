@@ -15,14 +15,13 @@
 DECLFUNC LDAC_RESULT init_encode_ldac(SFINFO *);
 DECLFUNC void calc_initial_bits_ldac(SFINFO *);
 DECLFUNC void free_encode_ldac(SFINFO *);
-DECLFUNC int encode_ldac(SFINFO *, int, int, int, int, int, int, int);
+DECLFUNC int encode_ldac(SFINFO *, int, int, int, int, int, int, int, int, int, int);
 #endif /* _DECODE_ONLY */
 
 #ifndef _ENCODE_ONLY
 /* decode_ldac.c */
 DECLFUNC LDAC_RESULT init_decode_ldac(SFINFO *);
 DECLFUNC void free_decode_ldac(SFINFO *);
-DECLFUNC void decode_ldac(SFINFO *);
 #endif /* _ENCODE_ONLY */
 
 /* setpcm_ldac.c */
@@ -31,6 +30,7 @@ DECLFUNC void set_input_pcm_ldac(SFINFO *, char *[], LDAC_SMPL_FMT_T, int);
 #endif /* _DECODE_ONLY */
 #ifndef _ENCODE_ONLY
 DECLFUNC void set_output_pcm_ldac(SFINFO *, char *[], LDAC_SMPL_FMT_T, int);
+DECLFUNC void set_output_spectrum_ldac(SFINFO *, char *[], LDAC_SMPL_FMT_T, int);
 #endif /* _ENCODE_ONLY */
 
 #ifndef _DECODE_ONLY
@@ -46,7 +46,7 @@ DECLFUNC void proc_imdct_ldac(SFINFO *, int);
 
 #ifndef _DECODE_ONLY
 /* sigana_ldac.c */
-DECLFUNC int ana_frame_status_ldac(SFINFO *, int);
+DECLFUNC int ana_frame_status_ldac(SFINFO *);
 #endif /* _DECODE_ONLY */
 
 #ifndef _DECODE_ONLY
@@ -67,15 +67,18 @@ DECLFUNC void reconst_word_length_ldac(AC *);
 #ifndef _DECODE_ONLY
 /* quant_ldac.c */
 DECLFUNC void norm_spectrum_ldac(AC *);
+DECLFUNC void quant_spectrum_unit_ldac(AC *, int, int *, int *);
 DECLFUNC void quant_spectrum_ldac(AC *);
-DECLFUNC void quant_residual_ldac(AC *);
 #endif /* _DECODE_ONLY */
 
 #ifndef _ENCODE_ONLY
 /* dequant_ldac.c */
-DECLFUNC void dequant_spectrum_ldac(AC *);
-DECLFUNC void dequant_residual_ldac(AC *);
+DECLFUNC void dequant_spectrum_ldac(AC *, int, int *);
+DECLFUNC void dequant_spectrum_residual_ldac(AC *, int, int *, int *);
 DECLFUNC void clear_spectrum_ldac(AC *, int);
+DECLFUNC void hold_spectrum_ldac(AC *);
+DECLFUNC void conceal_spectrum_ldac(AC *, int, UINT32 *);
+DECLFUNC void mix_spectrum_ldac(AC *, int);
 #endif /* _ENCODE_ONLY */
 
 #ifndef _DECODE_ONLY
@@ -42,21 +42,16 @@ INT32 val)
 /***************************************************************************************************
     Normalize Spectrum
 ***************************************************************************************************/
-static INT32 sa_val_ldac[LDAC_MAXNSPS] = { /* Q31 */
-    0xa0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-};
-
 DECLFUNC void norm_spectrum_ldac(
 AC *p_ac)
 {
     int iqu, isp;
     int lsp, hsp;
     int nqus = p_ac->p_ab->nqus;
-    int idsf;
     INT32 maxspec, tmp;
     INT32 *p_spec = p_ac->p_acsub->a_spec;
 
+    /* Only the scale factors are decided here, the spectrum is scaled in quant_spectrum_ldac() */
     for (iqu = 0; iqu < nqus; iqu++) {
         lsp = ga_isp_ldac[iqu];
         hsp = ga_isp_ldac[iqu+1];
@@ -68,107 +63,85 @@ AC *p_ac)
                 maxspec = tmp;
             }
         }
-        idsf = get_scale_factor_id_ldac(maxspec);
-
-        if (idsf > 0) {
-            for (isp = lsp; isp < hsp; isp++) {
-                p_spec[isp] = sftrnd_ldac(p_spec[isp], idsf-LDAC_Q_NORM);
-            }
-        }
-        else {
-            for (isp = lsp; isp < hsp; isp++) {
-                p_spec[isp] = sa_val_ldac[isp-lsp];
-            }
-        }
-
-        p_ac->a_idsf[iqu] = idsf;
-    }
 
-    return;
-}
-
-/***************************************************************************************************
-    Subfunction: Quantize Spectrum Core
-***************************************************************************************************/
-__inline static void quant_spectrum_core_ldac(
-AC *p_ac,
-int iqu)
-{
-    int i;
-    int isp = ga_isp_ldac[iqu];
-    int nsps = ga_nsps_ldac[iqu];
-    int *p_qspec = p_ac->a_qspec+isp;
-    INT32 qf = ga_qf_ldac[p_ac->a_idwl1[iqu]];
-    INT32 *p_nspec = p_ac->p_acsub->a_spec+isp;
-
-    for (i = 0; i < nsps; i++) {
-        /* Q00 <- Q31 * Q16 */
-        p_qspec[i] = mul_rsftrnd_ldac(p_nspec[i], qf, LDAC_Q_QUANT1);
+        p_ac->a_idsf[iqu] = get_scale_factor_id_ldac(maxspec);
     }
 
     return;
 }
 
 /***************************************************************************************************
-    Quantize Spectrum
+    Quantize Spectrum and Residual Spectrum of One Quantization Unit
 ***************************************************************************************************/
-DECLFUNC void quant_spectrum_ldac(
-AC *p_ac)
-{
-    int iqu;
-    int nqus = p_ac->p_ab->nqus;
-
-    for (iqu = 0; iqu < nqus; iqu++) {
-        quant_spectrum_core_ldac(p_ac, iqu);
-    }
-
-    return;
-}
+static INT32 sa_val_ldac[LDAC_MAXNSPS] = { /* Q31 */
+    0xa0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
 
-/***************************************************************************************************
-    Subfunction: Quantize Residual Spectrum Core
-***************************************************************************************************/
-__inline static void quant_residual_core_ldac(
+DECLFUNC void quant_spectrum_unit_ldac(
 AC *p_ac,
-int iqu)
+int iqu,
+int *p_qspec,
+int *p_rspec)
 {
     int i;
     int isp = ga_isp_ldac[iqu];
     int nsps = ga_nsps_ldac[iqu];
-    int *p_qspec = p_ac->a_qspec+isp;
-    int *p_rspec = p_ac->a_rspec+isp;
+    int idsf = p_ac->a_idsf[iqu];
+    INT32 a_nspec[LDAC_MAXNSPS];
     INT32 ldqspec, rnspec;
+    INT32 qf = ga_qf_ldac[p_ac->a_idwl1[iqu]];
     INT32 iqf = ga_iqf_ldac[LDAC_MAXIDWL1];
     INT32 rqf = ga_qf_ldac[p_ac->a_idwl2[iqu]];
     INT32 irsf = ga_irsf_ldac[LDAC_MAXIDWL1];
-    INT32 *p_nspec = p_ac->p_acsub->a_spec+isp;
-
-    for (i = 0; i < nsps; i++) {
-        /* Q31 <- Q00 * Q31 */
-        ldqspec = mul_lsftrnd_ldac(p_qspec[i], iqf, LDAC_Q_QUANT2);
-        /* Q31 <- (Q31 - Q31) * Q15 */
-        rnspec = mul_rsftrnd_ldac(p_nspec[i]-ldqspec, irsf, LDAC_Q_QUANT3);
-        /* Q00 <- Q31 * Q16 */
-        p_rspec[i] = mul_rsftrnd_ldac(rnspec, rqf, LDAC_Q_QUANT4);
+    INT32 *p_spec = p_ac->p_acsub->a_spec+isp;
+    INT32 *p_nspec = a_nspec;
+
+    /* Normalize on the fly, the normalized spectrum is not stored */
+    if (idsf > 0) {
+        for (i = 0; i < nsps; i++) {
+            /* Q31 <- Q15 << (31-idsf) */
+            a_nspec[i] = sftrnd_ldac(p_spec[i], idsf-LDAC_Q_NORM);
+        }
+    }
+    else {
+        p_nspec = sa_val_ldac;
+    }
+
+    if (p_ac->a_idwl2[iqu] > 0) {
+        for (i = 0; i < nsps; i++) {
+            /* Q00 <- Q31 * Q16 */
+            p_qspec[i] = mul_rsftrnd_ldac(p_nspec[i], qf, LDAC_Q_QUANT1);
+            /* Q31 <- Q00 * Q31 */
+            ldqspec = mul_lsftrnd_ldac(p_qspec[i], iqf, LDAC_Q_QUANT2);
+            /* Q31 <- (Q31 - Q31) * Q15 */
+            rnspec = mul_rsftrnd_ldac(p_nspec[i]-ldqspec, irsf, LDAC_Q_QUANT3);
+            /* Q00 <- Q31 * Q16 */
+            p_rspec[i] = mul_rsftrnd_ldac(rnspec, rqf, LDAC_Q_QUANT4);
+        }
+    }
+    else {
+        for (i = 0; i < nsps; i++) {
+            /* Q00 <- Q31 * Q16 */
+            p_qspec[i] = mul_rsftrnd_ldac(p_nspec[i], qf, LDAC_Q_QUANT1);
+        }
     }
 
     return;
 }
 
 /***************************************************************************************************
-    Quantize Residual Spectrum
+    Quantize Spectrum and Residual Spectrum
 ***************************************************************************************************/
-DECLFUNC void quant_residual_ldac(
+DECLFUNC void quant_spectrum_ldac(
 AC *p_ac)
 {
-    int iqu;
+    int iqu, isp;
     int nqus = p_ac->p_ab->nqus;
-    int	*p_idwl2 = p_ac->a_idwl2;
 
     for (iqu = 0; iqu < nqus; iqu++) {
-        if (p_idwl2[iqu] > 0) {
-            quant_residual_core_ldac(p_ac, iqu);
-        }
+        isp = ga_isp_ldac[iqu];
+        quant_spectrum_unit_ldac(p_ac, iqu, p_ac->a_qspec+isp, p_ac->a_rspec+isp);
     }
 
     return;
@@ -32,21 +32,17 @@ SCALAR val)
 /***************************************************************************************************
     Normalize Spectrum
 ***************************************************************************************************/
-static SCALAR sa_val_ldac[LDAC_MAXNSPS] = {
-    -0.75, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
-};
-
 DECLFUNC void norm_spectrum_ldac(
 AC *p_ac)
 {
     int iqu, isp;
     int lsp, hsp;
     int nqus = p_ac->p_ab->nqus;
-    int idsf;
     int *p_idsf = p_ac->a_idsf;
     SCALAR maxspec, tmp;
     SCALAR *p_spec = p_ac->p_acsub->a_spec;
 
+    /* Only the scale factors are decided here, the spectrum is scaled in quant_spectrum_ldac() */
     for (iqu = 0; iqu < nqus; iqu++) {
         lsp = ga_isp_ldac[iqu];
         hsp = ga_isp_ldac[iqu+1];
@@ -58,111 +54,78 @@ AC *p_ac)
                 maxspec = tmp;
             }
         }
-        idsf = get_scale_factor_id_ldac(maxspec);
-
-        if (idsf > 0) {
-            tmp = ga_isf_ldac[idsf];
-            for (isp = lsp; isp < hsp; isp++) {
-                p_spec[isp] *= tmp;
-            }
-        }
-        else {
-            for (isp = lsp; isp < hsp; isp++) {
-                p_spec[isp] = sa_val_ldac[isp-lsp];
-            }
-        }
 
-        p_idsf[iqu] = idsf;
+        p_idsf[iqu] = get_scale_factor_id_ldac(maxspec);
     }
 
     return;
 }
 
 /***************************************************************************************************
-    Subfunction: Quantize Spectrum Core
+    Quantize Spectrum and Residual Spectrum of One Quantization Unit
 ***************************************************************************************************/
-__inline static void quant_spectrum_core_ldac(
+static SCALAR sa_val_ldac[LDAC_MAXNSPS] = {
+    -0.75, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+};
+
+DECLFUNC void quant_spectrum_unit_ldac(
 AC *p_ac,
-int iqu)
+int iqu,
+int *p_qspec,
+int *p_rspec)
 {
     int i;
     int isp = ga_isp_ldac[iqu];
     int nsps = ga_nsps_ldac[iqu];
-    int *p_qspec = p_ac->a_qspec+isp;
+    SCALAR nspec, ldqspec;
+    SCALAR isf = _scalar(1.0);
     SCALAR qf = ga_qf_ldac[p_ac->a_idwl1[iqu]];
-    SCALAR *p_nspec = p_ac->p_acsub->a_spec+isp;
+    SCALAR iqf = ga_iqf_ldac[LDAC_MAXIDWL1];
+    SCALAR rqsf;
+    SCALAR *p_spec = sa_val_ldac;
 
     IEEE754_FI fi;
     const float fc = (float)((1 << 23) + (1 << 22));
 
-    for (i = 0; i < nsps; i++) {
-        fi.f = p_nspec[i] * qf + fc;
-        p_qspec[i] = (short)fi.i;
+    /* Normalize on the fly, the normalized spectrum is not stored */
+    if (p_ac->a_idsf[iqu] > 0) {
+        isf = ga_isf_ldac[p_ac->a_idsf[iqu]];
+        p_spec = p_ac->p_acsub->a_spec+isp;
     }
 
-    return;
-}
-
-/***************************************************************************************************
-    Quantize Spectrum
-***************************************************************************************************/
-DECLFUNC void quant_spectrum_ldac(
-AC *p_ac)
-{
-    int iqu;
-    int nqus = p_ac->p_ab->nqus;
-
-    for (iqu = 0; iqu < nqus; iqu++) {
-        quant_spectrum_core_ldac(p_ac, iqu);
+    if (p_ac->a_idwl2[iqu] > 0) {
+        rqsf = ga_qf_ldac[p_ac->a_idwl2[iqu]] * ga_irsf_ldac[LDAC_MAXIDWL1] * _scalar(0.996093750);
+        for (i = 0; i < nsps; i++) {
+            nspec = p_spec[i] * isf;
+            fi.f = nspec * qf + fc;
+            p_qspec[i] = (short)fi.i;
+            ldqspec = p_qspec[i] * iqf;
+            fi.f = (nspec - ldqspec) * rqsf + fc;
+            p_rspec[i] = (short)fi.i;
+        }
     }
-
-    return;
-}
-
-/***************************************************************************************************
-    Subfunction: Quantize Residual Spectrum Core
-***************************************************************************************************/
-__inline static void quant_residual_core_ldac(
-AC *p_ac,
-int iqu)
-{
-    int i;
-    int isp = ga_isp_ldac[iqu];
-    int nsps = ga_nsps_ldac[iqu];
-    int *p_qspec = p_ac->a_qspec+isp;
-    int *p_rspec = p_ac->a_rspec+isp;
-    SCALAR ldqspec;
-    SCALAR iqf = ga_iqf_ldac[LDAC_MAXIDWL1];
-    SCALAR rqsf = ga_qf_ldac[p_ac->a_idwl2[iqu]] * ga_irsf_ldac[LDAC_MAXIDWL1]
-            * _scalar(0.996093750);
-    SCALAR *p_nspec = p_ac->p_acsub->a_spec+isp;
-
-    IEEE754_FI fi;
-    const float fc = (float)((1 << 23) + (1 << 22));
-
-    for (i = 0; i < nsps; i++) {
-        ldqspec = p_qspec[i] * iqf;
-        fi.f = (p_nspec[i] - ldqspec) * rqsf + fc;
-        p_rspec[i] = (short)fi.i;
+    else {
+        for (i = 0; i < nsps; i++) {
+            fi.f = p_spec[i] * isf * qf + fc;
+            p_qspec[i] = (short)fi.i;
+        }
     }
 
     return;
 }
 
 /***************************************************************************************************
-    Quantize Residual Spectrum
+    Quantize Spectrum and Residual Spectrum
 ***************************************************************************************************/
-DECLFUNC void quant_residual_ldac(
+DECLFUNC void quant_spectrum_ldac(
 AC *p_ac)
 {
-    int iqu;
+    int iqu, isp;
     int nqus = p_ac->p_ab->nqus;
-    int *p_idwl2 = p_ac->a_idwl2;
 
     for (iqu = 0; iqu < nqus; iqu++) {
-        if (p_idwl2[iqu] > 0) {
-            quant_residual_core_ldac(p_ac, iqu);
-        }
+        isp = ga_isp_ldac[iqu];
+        quant_spectrum_unit_ldac(p_ac, iqu, p_ac->a_qspec+isp, p_ac->a_rspec+isp);
     }
 
     return;
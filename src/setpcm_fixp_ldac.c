@@ -244,5 +244,28 @@ int nlnn)
 
     return;
 }
+
+/***************************************************************************************************
+    Set Output Spectrum
+***************************************************************************************************/
+DECLFUNC void set_output_spectrum_ldac(
+SFINFO *p_sfinfo,
+char *pp_spec[],
+LDAC_SMPL_FMT_T format,
+int nlnn)
+{
+    int ich;
+    int nchs = p_sfinfo->cfg.ch;
+    int nsmpl = npow2_ldac(nlnn);
+
+    if (format == LDAC_SMPL_FMT_S32) {
+        /* Q30 of the full scale */
+        for (ich = 0; ich < nchs; ich++) {
+            copy_data_ldac(p_sfinfo->ap_ac[ich]->p_acsub->a_spec, pp_spec[ich], nsmpl*sizeof(INT32));
+        }
+    }
+
+    return;
+}
 #endif /* _ENCODE_ONLY */
 
@@ -308,5 +308,53 @@ int nlnn)
 
     return;
 }
+
+/***************************************************************************************************
+    Set Output Spectrum
+***************************************************************************************************/
+DECLFUNC void set_output_spectrum_ldac(
+SFINFO *p_sfinfo,
+char *pp_spec[],
+LDAC_SMPL_FMT_T format,
+int nlnn)
+{
+    int ich, i;
+    int nchs = p_sfinfo->cfg.ch;
+    int nsmpl = npow2_ldac(nlnn);
+    SCALAR *p_spec;
+
+    if (format == LDAC_SMPL_FMT_S32) {
+        /* Q30 of the full scale, as the fixed point decoder holds it */
+        INT64 val2;
+        int *p_l;
+        for (ich = 0; ich < nchs; ich++) {
+            p_spec = p_sfinfo->ap_ac[ich]->p_acsub->a_spec;
+            p_l = (int *)pp_spec[ich];
+            for (i = 0; i < nsmpl; i++) {
+                val2 = (INT64)floor(_scalar(32768.0) * p_spec[i] + _scalar(0.5));
+                if (val2 > (int)0x7fffffff) {
+                    val2 = (int)0x7fffffff;
+                }
+                else if (val2 < (int)0x80000000) {
+                    val2 = (int)0x80000000;
+                }
+                p_l[i] = (int)val2;
+            }
+        }
+    }
+    else if (format == LDAC_SMPL_FMT_F32) {
+        SCALAR scale = _scalar(1.0) / _scalar(32768.0);
+        float *p_f;
+        for (ich = 0; ich < nchs; ich++) {
+            p_spec = p_sfinfo->ap_ac[ich]->p_acsub->a_spec;
+            p_f = (float *)pp_spec[ich];
+            for (i = 0; i < nsmpl; i++) {
+                p_f[i] = (float)(scale * p_spec[i]);
+            }
+        }
+    }
+
+    return;
+}
 #endif /* _ENCODE_ONLY */
 
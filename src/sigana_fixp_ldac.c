@@ -172,19 +172,20 @@ INT16 e)
 }
 
 /***************************************************************************************************
-    Calculate Pseudo Spectrum and Low Band Energy
+    Calculate Pseudo Spectrum Centroid and Low Band Energy
 ***************************************************************************************************/
 static INT32 calc_mdct_pseudo_spectrum_ldac(
 INT32 *p_spec,
-INT32 *p_psd,
-UINT32 nsp)
+UINT32 nsp,
+INT32 *p_centroid)
 {
     UINT32 isp;
     INT16 e;
     INT32 y0, y1, y2;
-    INT32 tmp;
+    INT32 tmp, psd;
     INT64 low_energy;
     INT64 acc1, acc2;
+    INT64 s1, s2;
 
     {
         y1 = p_spec[0];
@@ -195,7 +196,9 @@ UINT32 nsp)
         low_energy = acc1 >> LDAC_Q_ADD_LOWENERGY; /* Q26 <- (Q15 * Q15) >> 4 */
         e = calc_exp_ldac((INT32)(acc1>>32), (UINT32)(acc1&0xffffffff));
         tmp = (INT32)((acc1 << e) >> 32);
-        *p_psd++ = calc_sqrt_ldac(tmp, e);
+        psd = calc_sqrt_ldac(tmp, e);
+        s1 = 0;
+        s2 = (INT64)psd; /* Q15 */
     }
 
     for (isp = 1; isp < LDAC_NSP_LOWENERGY; isp++) {
@@ -208,7 +211,9 @@ UINT32 nsp)
         low_energy += acc1 >> LDAC_Q_ADD_LOWENERGY; /* Q26 <- (Q15 * Q15) >> 4 */
         e = calc_exp_ldac((INT32)(acc1>>32), (UINT32)(acc1&0xffffffff));
         tmp = (INT32)((acc1 << e) >> 32);
-        *p_psd++ = calc_sqrt_ldac(tmp, e);
+        psd = calc_sqrt_ldac(tmp, e);
+        s1 += ((INT64)isp * (INT64)psd); /* Q15 <- Q00 * Q15 */
+        s2 += (INT64)psd; /* Q15 */
     }
 
     for (isp = LDAC_NSP_LOWENERGY; isp < nsp-1; isp++) {
@@ -220,7 +225,9 @@ UINT32 nsp)
         acc1 = acc1 + acc2;
         e = calc_exp_ldac((INT32)(acc1 >> 32), (UINT32)(acc1&0xffffffff));
         tmp = (INT32) ((acc1 << e) >> 32);
-        *p_psd++ = calc_sqrt_ldac(tmp, e);
+        psd = calc_sqrt_ldac(tmp, e);
+        s1 += ((INT64)isp * (INT64)psd); /* Q15 <- Q00 * Q15 */
+        s2 += (INT64)psd; /* Q15 */
     }
 
     {
@@ -229,7 +236,9 @@ UINT32 nsp)
         acc1 = acc1 + acc2;
         e = calc_exp_ldac((INT32)(acc1 >> 32), (UINT32)(acc1&0xffffffff));
         tmp = (INT32)((acc1 << e) >> 32);
-        *p_psd++ = calc_sqrt_ldac(tmp, e);
+        psd = calc_sqrt_ldac(tmp, e);
+        s1 += ((INT64)(nsp-1) * (INT64)psd); /* Q15 <- Q00 * Q15 */
+        s2 += (INT64)psd; /* Q15 */
     }
 
     low_energy >>= LDAC_Q_LOWENERGY; /* Q15 <- Q26 >> 11 */
@@ -237,88 +246,38 @@ UINT32 nsp)
         low_energy = LDAC_MAX_32BIT;
     }
 
-    return (INT32)low_energy;
-}
-
-/***************************************************************************************************
-    Calculate Pseudo Spectrum Centroid
-***************************************************************************************************/
-static INT32 calc_spectral_centroid_ldac(
-INT32 *p_spec,
-UINT32 nsp)
-{
-    UINT32 isp;
-    INT32 centroid = 0;
-    INT64 s1, s2;
-
-    s1 = s2 = 0;
-    for (isp = 0; isp < nsp; isp++) {
-        s1 += ((INT64)isp * (INT64)*p_spec); /* Q15 <- Q00 * Q15 */
-        s2 += (INT64)*p_spec++; /* Q15 */
-    }
-
+    *p_centroid = 0;
     if (s2 != 0) {
-        centroid = (INT32)((s1<<15) / s2); /* Q15 <- (Q15<<15) / Q15 */
+        *p_centroid = (INT32)((s1<<15) / s2); /* Q15 <- (Q15<<15) / Q15 */
     }
 
-    return centroid;
-}
-
-/***************************************************************************************************
-    Calculate Number of Zero Cross
-***************************************************************************************************/
-static UINT32 calc_zero_cross_number_ldac(
-INT32 *p_time,
-UINT32 n)
-{
-    UINT32 i;
-    UINT32 zero_cross = 0;
-    INT32 prev, tmp;
-
-    prev = 0;
-    for (i = 0; i < n; i++) {
-        if ((prev == 0) || (*p_time == 0)) {
-            tmp = 0;
-        }
-        else {
-            tmp = prev ^ (*p_time);
-        }
-
-        if (tmp < 0) {
-            zero_cross++;
-        }
-        prev = *p_time++;
-    }
-
-    return zero_cross;
+    return (INT32)low_energy;
 }
 
 /***************************************************************************************************
     Analyze Frame Status
 ***************************************************************************************************/
 DECLSPEC int ana_frame_status_ldac(
-SFINFO *p_sfinfo,
-int nlnn)
+SFINFO *p_sfinfo)
 {
     AC *p_ac;
     int ich;
     int nchs = p_sfinfo->cfg.ch;
-    int nsmpl = npow2_ldac(nlnn+1);
     int cnt;
     int a_status[LDAC_PRCNCH];
     UINT32 zero_cross;
     INT32 low_energy, centroid;
-    INT32 a_psd_spec[LDAC_NSP_PSEUDOANA];
-
 
     for (ich = 0; ich < nchs; ich++) {
         p_ac = p_sfinfo->ap_ac[ich];
 
-        low_energy = calc_mdct_pseudo_spectrum_ldac(p_ac->p_acsub->a_spec, a_psd_spec, LDAC_NSP_PSEUDOANA);
+        low_energy = calc_mdct_pseudo_spectrum_ldac(p_ac->p_acsub->a_spec, LDAC_NSP_PSEUDOANA, &centroid);
 
-        centroid = calc_spectral_centroid_ldac(a_psd_spec, LDAC_NSP_PSEUDOANA);
+        /* counted in proc_mdct_ldac() */
+        zero_cross = (UINT32)p_ac->zero_cross;
 
-        zero_cross = calc_zero_cross_number_ldac(p_ac->p_acsub->a_time, nsmpl);
+        p_ac->low_energy = low_energy;
+        p_ac->centroid = centroid;
 
         a_status[ich] = LDAC_FRMSTAT_LEV_0;
         if (low_energy < LDAC_TH_LOWENERGY_L) {
@@ -15,24 +15,30 @@
 #define LDAC_TH_CENTROID    _scalar(45.0)
 #define LDAC_TH_ZERODIV     _scalar(1.0e-6)
 
+#define LDAC_Q15_FEATURE    _scalar(32768.0)
+#define LDAC_MAX_FEATURE    _scalar(65536.0)
+
 /***************************************************************************************************
-    Calculate Pseudo Spectrum and Low Band Energy
+    Calculate Pseudo Spectrum Centroid and Low Band Energy
 ***************************************************************************************************/
 static SCALAR calc_mdct_pseudo_spectrum_ldac(
 SCALAR *p_spec,
-SCALAR *p_psd,
-int n)
+int n,
+SCALAR *p_centroid)
 {
     int isp;
-    SCALAR low_energy, tmp;
+    SCALAR low_energy, tmp, psd;
     SCALAR y0, y1, y2;
+    SCALAR s1, s2;
 
     {
         y1 = p_spec[0];
         y2 = p_spec[1];
         tmp = y1 * y1 + y2 * y2;
         low_energy = tmp;
-        p_psd[0] = sqrt(tmp);
+        psd = sqrt(tmp);
+        s1 = _scalar(0.0);
+        s2 = psd;
     }
 
     for (isp = 1; isp < LDAC_NSP_LOWENERGY; isp++) {
@@ -41,7 +47,9 @@ int n)
         y2 = p_spec[isp+1];
         tmp = y1 * y1 + (y0-y2) * (y0-y2);
         low_energy += tmp;
-        p_psd[isp] = sqrt(tmp);
+        psd = sqrt(tmp);
+        s1 += (SCALAR)isp * psd;
+        s2 += psd;
     }
 
     for (isp = LDAC_NSP_LOWENERGY; isp < n-1; isp++) {
@@ -49,90 +57,57 @@ int n)
         y1 = y2;
         y2 = p_spec[isp+1];
         tmp = y1 * y1 + (y0-y2) * (y0-y2);
-        p_psd[isp] = sqrt(tmp);
+        psd = sqrt(tmp);
+        s1 += (SCALAR)isp * psd;
+        s2 += psd;
     }
 
     {
         tmp = y1 * y1 + y2 * y2;
-        p_psd[n-1] = sqrt(tmp);
-    }
-
-    return low_energy;
-}
-
-/***************************************************************************************************
-    Calculate Pseudo Spectrum Centroid
-***************************************************************************************************/
-static SCALAR calc_spectral_centroid_ldac(
-SCALAR *p_spec,
-int nsp)
-{
-    int isp;
-    SCALAR centroid;
-    SCALAR s1, s2;
-
-    s1 = s2 = _scalar(0.0);
-    for (isp = 0; isp < nsp; isp++) {
-        s1 += (SCALAR)isp * *p_spec;
-        s2 += *p_spec++;
+        psd = sqrt(tmp);
+        s1 += (SCALAR)(n-1) * psd;
+        s2 += psd;
     }
 
     if (s2 < LDAC_TH_ZERODIV) {
-        centroid = _scalar(0.0);
+        *p_centroid = _scalar(0.0);
     }
     else {
-        centroid = s1 / s2;
+        *p_centroid = s1 / s2;
     }
 
-    return centroid;
-}
-
-/***************************************************************************************************
-    Calculate Number of Zero Cross
-***************************************************************************************************/
-static int calc_zero_cross_number_ldac(
-SCALAR *p_time,
-int n)
-{
-    int i;
-    int zero_cross = 0;
-    SCALAR prev;
-
-    prev = _scalar(0.0);
-    for (i = 0; i < n; i++) {
-        if (prev * *p_time < _scalar(0.0)) {
-            zero_cross++;
-        }
-        prev = *p_time++;
-    }
-
-    return zero_cross;
+    return low_energy;
 }
 
 /***************************************************************************************************
     Analyze Frame Status
 ***************************************************************************************************/
 DECLSPEC int ana_frame_status_ldac(
-SFINFO *p_sfinfo,
-int nlnn)
+SFINFO *p_sfinfo)
 {
     AC *p_ac;
     int ich;
     int nchs = p_sfinfo->cfg.ch;
-    int nsmpl = npow2_ldac(nlnn+1);
     int cnt, zero_cross;
     int a_status[LDAC_PRCNCH];
     SCALAR low_energy, centroid;
-    SCALAR a_psd_spec[LDAC_NSP_PSEUDOANA];
 
     for (ich = 0; ich < nchs; ich++) {
         p_ac = p_sfinfo->ap_ac[ich];
 
-        low_energy = calc_mdct_pseudo_spectrum_ldac(p_ac->p_acsub->a_spec, a_psd_spec, LDAC_NSP_PSEUDOANA);
+        low_energy = calc_mdct_pseudo_spectrum_ldac(p_ac->p_acsub->a_spec, LDAC_NSP_PSEUDOANA, &centroid);
 
-        centroid = calc_spectral_centroid_ldac(a_psd_spec, LDAC_NSP_PSEUDOANA);
+        /* counted in proc_mdct_ldac() */
+        zero_cross = p_ac->zero_cross;
 
-        zero_cross = calc_zero_cross_number_ldac(p_ac->p_acsub->a_time, nsmpl);
+        /* keep features in Q15 as the fixed point version */
+        if (low_energy < LDAC_MAX_FEATURE) {
+            p_ac->low_energy = (int)(low_energy * LDAC_Q15_FEATURE);
+        }
+        else {
+            p_ac->low_energy = 0x7fffffff;
+        }
+        p_ac->centroid = (int)(centroid * LDAC_Q15_FEATURE);
 
         a_status[ich] = LDAC_FRMSTAT_LEV_0;
         if (low_energy < LDAC_TH_LOWENERGY_L) { 
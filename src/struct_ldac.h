@@ -35,6 +35,7 @@ typedef short          INT16;
 typedef int            INT32;
 typedef unsigned int  UINT32;
 typedef long long      INT64;
+typedef unsigned long long UINT64;
 
 typedef float         SCALAR;
 #define _scalar(x) x##f
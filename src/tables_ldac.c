@@ -26,10 +26,10 @@ DECLFUNC const unsigned char ga_max_nbands_ldac[LDAC_NSUPSMPLRATEID] = {
 };
 
 DECLFUNC const char gaa_nlnn_shift_ldac[LDAC_NSUPSMPLRATEID][LDAC_NSFTSTEP] = {
-    {-1, -1,  0,  0, -1},
-    {-1, -1,  0,  0, -1},
-    {-1,  0,  0, -1, -1},
-    {-1,  0,  0, -1, -1},
+    { 0,  0,  0,  0, -1},
+    { 0,  0,  0,  0, -1},
+    { 0,  0,  0, -1, -1},
+    { 0,  0,  0, -1, -1},
 };
 
 /***************************************************************************************************
@@ -127,11 +127,16 @@ DECLFUNC const unsigned char ga_wl_ldac[LDAC_NIDWL] = {
 };
 
 #ifndef _DECODE_ONLY
-DECLFUNC const short gaa_ndim_wls_ldac[4][LDAC_NIDWL] = {
-    {0,  3,  6,  8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32},
-    {0,  7, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64},
-    {0, 14, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96,104,112,120,128},
-    {0, 28, 48, 64, 80, 96,112,128,144,160,176,192,208,224,240,256},
+/* Bits for Spectrum and Residual of a QU, indexed by idsp*LDAC_NIDWLS+idwl1+idwl2 */
+DECLFUNC const int ga_nbits_wls_ldac[LDAC_NIDSP*LDAC_NIDWLS] = {
+      0,  3,  6,  8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32,
+     36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64,
+      0,  7, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64,
+     72, 76, 80, 84, 88, 92, 96,100,104,108,112,116,120,124,128,
+      0, 14, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96,104,112,120,128,
+    144,152,160,168,176,184,192,200,208,216,224,232,240,248,256,
+      0, 28, 48, 64, 80, 96,112,128,144,160,176,192,208,224,240,256,
+    288,304,320,336,352,368,384,400,416,432,448,464,480,496,512,
 };
 
 DECLFUNC const int ga_2dimenc_spec_ldac[LDAC_N2DIMSPECENCTBL] = {
@@ -626,6 +631,1058 @@ static const unsigned char sa_hc_sf1_blen5_dec_ldac[256] = {
     31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
     31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
 };
+
+/*******************************************************************************
+    Multi-Symbol Huffman Decoding Tables for Scale Factor Data
+    (bit 0-3: number of bits, bit 4-7: number of codes, bit 8-31: 6-bit codes)
+*******************************************************************************/
+static const UINT32 sa_hc_sf0_blen3_mdec_ldac[1024] = {
+    0x00000048, 0x00000048, 0x00000048, 0x00000048, 0x04000048, 0x04000048, 0x04000048, 0x04000048,
+    0x1c000048, 0x1c000048, 0x1c000048, 0x1c000048, 0x18000049, 0x18000049, 0x0800004a, 0x00000036,
+    0x00100048, 0x00100048, 0x00100048, 0x00100048, 0x04100048, 0x04100048, 0x04100048, 0x04100048,
+    0x1c100048, 0x1c100048, 0x1c100048, 0x1c100048, 0x18100049, 0x18100049, 0x0810004a, 0x00100036,
+    0x00700048, 0x00700048, 0x00700048, 0x00700048, 0x04700048, 0x04700048, 0x04700048, 0x04700048,
+    0x1c700048, 0x1c700048, 0x1c700048, 0x1c700048, 0x18700049, 0x18700049, 0x0870004a, 0x00700036,
+    0x00600049, 0x00600049, 0x04600049, 0x04600049, 0x1c600049, 0x1c600049, 0x1860004a, 0x00600037,
+    0x0020004a, 0x0420004a, 0x1c20004a, 0x00200038, 0x00500039, 0x00500039, 0x0030003a, 0x0040003a,
+    0x00004048, 0x00004048, 0x00004048, 0x00004048, 0x04004048, 0x04004048, 0x04004048, 0x04004048,
+    0x1c004048, 0x1c004048, 0x1c004048, 0x1c004048, 0x18004049, 0x18004049, 0x0800404a, 0x00004036,
+    0x00104048, 0x00104048, 0x00104048, 0x00104048, 0x04104048, 0x04104048, 0x04104048, 0x04104048,
+    0x1c104048, 0x1c104048, 0x1c104048, 0x1c104048, 0x18104049, 0x18104049, 0x0810404a, 0x00104036,
+    0x00704048, 0x00704048, 0x00704048, 0x00704048, 0x04704048, 0x04704048, 0x04704048, 0x04704048,
+    0x1c704048, 0x1c704048, 0x1c704048, 0x1c704048, 0x18704049, 0x18704049, 0x0870404a, 0x00704036,
+    0x00604049, 0x00604049, 0x04604049, 0x04604049, 0x1c604049, 0x1c604049, 0x1860404a, 0x00604037,
+    0x0020404a, 0x0420404a, 0x1c20404a, 0x00204038, 0x00504039, 0x00504039, 0x0030403a, 0x0040403a,
+    0x0001c048, 0x0001c048, 0x0001c048, 0x0001c048, 0x0401c048, 0x0401c048, 0x0401c048, 0x0401c048,
+    0x1c01c048, 0x1c01c048, 0x1c01c048, 0x1c01c048, 0x1801c049, 0x1801c049, 0x0801c04a, 0x0001c036,
+    0x0011c048, 0x0011c048, 0x0011c048, 0x0011c048, 0x0411c048, 0x0411c048, 0x0411c048, 0x0411c048,
+    0x1c11c048, 0x1c11c048, 0x1c11c048, 0x1c11c048, 0x1811c049, 0x1811c049, 0x0811c04a, 0x0011c036,
+    0x0071c048, 0x0071c048, 0x0071c048, 0x0071c048, 0x0471c048, 0x0471c048, 0x0471c048, 0x0471c048,
+    0x1c71c048, 0x1c71c048, 0x1c71c048, 0x1c71c048, 0x1871c049, 0x1871c049, 0x0871c04a, 0x0071c036,
+    0x0061c049, 0x0061c049, 0x0461c049, 0x0461c049, 0x1c61c049, 0x1c61c049, 0x1861c04a, 0x0061c037,
+    0x0021c04a, 0x0421c04a, 0x1c21c04a, 0x0021c038, 0x0051c039, 0x0051c039, 0x0031c03a, 0x0041c03a,
+    0x00018049, 0x00018049, 0x04018049, 0x04018049, 0x1c018049, 0x1c018049, 0x1801804a, 0x00018037,
+    0x00118049, 0x00118049, 0x04118049, 0x04118049, 0x1c118049, 0x1c118049, 0x1811804a, 0x00118037,
+    0x00718049, 0x00718049, 0x04718049, 0x04718049, 0x1c718049, 0x1c718049, 0x1871804a, 0x00718037,
+    0x0061804a, 0x0461804a, 0x1c61804a, 0x00618038, 0x00218039, 0x00218039, 0x0051803a, 0x00018025,
+    0x0000804a, 0x0400804a, 0x1c00804a, 0x00008038, 0x0010804a, 0x0410804a, 0x1c10804a, 0x00108038,
+    0x0070804a, 0x0470804a, 0x1c70804a, 0x00708038, 0x00608039, 0x00608039, 0x0020803a, 0x00008026,
+    0x00014039, 0x00014039, 0x00114039, 0x00114039, 0x00714039, 0x00714039, 0x0061403a, 0x00014027,
+    0x0000c03a, 0x0010c03a, 0x0070c03a, 0x0000c028, 0x0001003a, 0x0011003a, 0x0071003a, 0x00010028,
+    0x00000148, 0x00000148, 0x00000148, 0x00000148, 0x04000148, 0x04000148, 0x04000148, 0x04000148,
+    0x1c000148, 0x1c000148, 0x1c000148, 0x1c000148, 0x18000149, 0x18000149, 0x0800014a, 0x00000136,
+    0x00100148, 0x00100148, 0x00100148, 0x00100148, 0x04100148, 0x04100148, 0x04100148, 0x04100148,
+    0x1c100148, 0x1c100148, 0x1c100148, 0x1c100148, 0x18100149, 0x18100149, 0x0810014a, 0x00100136,
+    0x00700148, 0x00700148, 0x00700148, 0x00700148, 0x04700148, 0x04700148, 0x04700148, 0x04700148,
+    0x1c700148, 0x1c700148, 0x1c700148, 0x1c700148, 0x18700149, 0x18700149, 0x0870014a, 0x00700136,
+    0x00600149, 0x00600149, 0x04600149, 0x04600149, 0x1c600149, 0x1c600149, 0x1860014a, 0x00600137,
+    0x0020014a, 0x0420014a, 0x1c20014a, 0x00200138, 0x00500139, 0x00500139, 0x0030013a, 0x0040013a,
+    0x00004148, 0x00004148, 0x00004148, 0x00004148, 0x04004148, 0x04004148, 0x04004148, 0x04004148,
+    0x1c004148, 0x1c004148, 0x1c004148, 0x1c004148, 0x18004149, 0x18004149, 0x0800414a, 0x00004136,
+    0x00104148, 0x00104148, 0x00104148, 0x00104148, 0x04104148, 0x04104148, 0x04104148, 0x04104148,
+    0x1c104148, 0x1c104148, 0x1c104148, 0x1c104148, 0x18104149, 0x18104149, 0x0810414a, 0x00104136,
+    0x00704148, 0x00704148, 0x00704148, 0x00704148, 0x04704148, 0x04704148, 0x04704148, 0x04704148,
+    0x1c704148, 0x1c704148, 0x1c704148, 0x1c704148, 0x18704149, 0x18704149, 0x0870414a, 0x00704136,
+    0x00604149, 0x00604149, 0x04604149, 0x04604149, 0x1c604149, 0x1c604149, 0x1860414a, 0x00604137,
+    0x0020414a, 0x0420414a, 0x1c20414a, 0x00204138, 0x00504139, 0x00504139, 0x0030413a, 0x0040413a,
+    0x0001c148, 0x0001c148, 0x0001c148, 0x0001c148, 0x0401c148, 0x0401c148, 0x0401c148, 0x0401c148,
+    0x1c01c148, 0x1c01c148, 0x1c01c148, 0x1c01c148, 0x1801c149, 0x1801c149, 0x0801c14a, 0x0001c136,
+    0x0011c148, 0x0011c148, 0x0011c148, 0x0011c148, 0x0411c148, 0x0411c148, 0x0411c148, 0x0411c148,
+    0x1c11c148, 0x1c11c148, 0x1c11c148, 0x1c11c148, 0x1811c149, 0x1811c149, 0x0811c14a, 0x0011c136,
+    0x0071c148, 0x0071c148, 0x0071c148, 0x0071c148, 0x0471c148, 0x0471c148, 0x0471c148, 0x0471c148,
+    0x1c71c148, 0x1c71c148, 0x1c71c148, 0x1c71c148, 0x1871c149, 0x1871c149, 0x0871c14a, 0x0071c136,
+    0x0061c149, 0x0061c149, 0x0461c149, 0x0461c149, 0x1c61c149, 0x1c61c149, 0x1861c14a, 0x0061c137,
+    0x0021c14a, 0x0421c14a, 0x1c21c14a, 0x0021c138, 0x0051c139, 0x0051c139, 0x0031c13a, 0x0041c13a,
+    0x00018149, 0x00018149, 0x04018149, 0x04018149, 0x1c018149, 0x1c018149, 0x1801814a, 0x00018137,
+    0x00118149, 0x00118149, 0x04118149, 0x04118149, 0x1c118149, 0x1c118149, 0x1811814a, 0x00118137,
+    0x00718149, 0x00718149, 0x04718149, 0x04718149, 0x1c718149, 0x1c718149, 0x1871814a, 0x00718137,
+    0x0061814a, 0x0461814a, 0x1c61814a, 0x00618138, 0x00218139, 0x00218139, 0x0051813a, 0x00018125,
+    0x0000814a, 0x0400814a, 0x1c00814a, 0x00008138, 0x0010814a, 0x0410814a, 0x1c10814a, 0x00108138,
+    0x0070814a, 0x0470814a, 0x1c70814a, 0x00708138, 0x00608139, 0x00608139, 0x0020813a, 0x00008126,
+    0x00014139, 0x00014139, 0x00114139, 0x00114139, 0x00714139, 0x00714139, 0x0061413a, 0x00014127,
+    0x0000c13a, 0x0010c13a, 0x0070c13a, 0x0000c128, 0x0001013a, 0x0011013a, 0x0071013a, 0x00010128,
+    0x00000748, 0x00000748, 0x00000748, 0x00000748, 0x04000748, 0x04000748, 0x04000748, 0x04000748,
+    0x1c000748, 0x1c000748, 0x1c000748, 0x1c000748, 0x18000749, 0x18000749, 0x0800074a, 0x00000736,
+    0x00100748, 0x00100748, 0x00100748, 0x00100748, 0x04100748, 0x04100748, 0x04100748, 0x04100748,
+    0x1c100748, 0x1c100748, 0x1c100748, 0x1c100748, 0x18100749, 0x18100749, 0x0810074a, 0x00100736,
+    0x00700748, 0x00700748, 0x00700748, 0x00700748, 0x04700748, 0x04700748, 0x04700748, 0x04700748,
+    0x1c700748, 0x1c700748, 0x1c700748, 0x1c700748, 0x18700749, 0x18700749, 0x0870074a, 0x00700736,
+    0x00600749, 0x00600749, 0x04600749, 0x04600749, 0x1c600749, 0x1c600749, 0x1860074a, 0x00600737,
+    0x0020074a, 0x0420074a, 0x1c20074a, 0x00200738, 0x00500739, 0x00500739, 0x0030073a, 0x0040073a,
+    0x00004748, 0x00004748, 0x00004748, 0x00004748, 0x04004748, 0x04004748, 0x04004748, 0x04004748,
+    0x1c004748, 0x1c004748, 0x1c004748, 0x1c004748, 0x18004749, 0x18004749, 0x0800474a, 0x00004736,
+    0x00104748, 0x00104748, 0x00104748, 0x00104748, 0x04104748, 0x04104748, 0x04104748, 0x04104748,
+    0x1c104748, 0x1c104748, 0x1c104748, 0x1c104748, 0x18104749, 0x18104749, 0x0810474a, 0x00104736,
+    0x00704748, 0x00704748, 0x00704748, 0x00704748, 0x04704748, 0x04704748, 0x04704748, 0x04704748,
+    0x1c704748, 0x1c704748, 0x1c704748, 0x1c704748, 0x18704749, 0x18704749, 0x0870474a, 0x00704736,
+    0x00604749, 0x00604749, 0x04604749, 0x04604749, 0x1c604749, 0x1c604749, 0x1860474a, 0x00604737,
+    0x0020474a, 0x0420474a, 0x1c20474a, 0x00204738, 0x00504739, 0x00504739, 0x0030473a, 0x0040473a,
+    0x0001c748, 0x0001c748, 0x0001c748, 0x0001c748, 0x0401c748, 0x0401c748, 0x0401c748, 0x0401c748,
+    0x1c01c748, 0x1c01c748, 0x1c01c748, 0x1c01c748, 0x1801c749, 0x1801c749, 0x0801c74a, 0x0001c736,
+    0x0011c748, 0x0011c748, 0x0011c748, 0x0011c748, 0x0411c748, 0x0411c748, 0x0411c748, 0x0411c748,
+    0x1c11c748, 0x1c11c748, 0x1c11c748, 0x1c11c748, 0x1811c749, 0x1811c749, 0x0811c74a, 0x0011c736,
+    0x0071c748, 0x0071c748, 0x0071c748, 0x0071c748, 0x0471c748, 0x0471c748, 0x0471c748, 0x0471c748,
+    0x1c71c748, 0x1c71c748, 0x1c71c748, 0x1c71c748, 0x1871c749, 0x1871c749, 0x0871c74a, 0x0071c736,
+    0x0061c749, 0x0061c749, 0x0461c749, 0x0461c749, 0x1c61c749, 0x1c61c749, 0x1861c74a, 0x0061c737,
+    0x0021c74a, 0x0421c74a, 0x1c21c74a, 0x0021c738, 0x0051c739, 0x0051c739, 0x0031c73a, 0x0041c73a,
+    0x00018749, 0x00018749, 0x04018749, 0x04018749, 0x1c018749, 0x1c018749, 0x1801874a, 0x00018737,
+    0x00118749, 0x00118749, 0x04118749, 0x04118749, 0x1c118749, 0x1c118749, 0x1811874a, 0x00118737,
+    0x00718749, 0x00718749, 0x04718749, 0x04718749, 0x1c718749, 0x1c718749, 0x1871874a, 0x00718737,
+    0x0061874a, 0x0461874a, 0x1c61874a, 0x00618738, 0x00218739, 0x00218739, 0x0051873a, 0x00018725,
+    0x0000874a, 0x0400874a, 0x1c00874a, 0x00008738, 0x0010874a, 0x0410874a, 0x1c10874a, 0x00108738,
+    0x0070874a, 0x0470874a, 0x1c70874a, 0x00708738, 0x00608739, 0x00608739, 0x0020873a, 0x00008726,
+    0x00014739, 0x00014739, 0x00114739, 0x00114739, 0x00714739, 0x00714739, 0x0061473a, 0x00014727,
+    0x0000c73a, 0x0010c73a, 0x0070c73a, 0x0000c728, 0x0001073a, 0x0011073a, 0x0071073a, 0x00010728,
+    0x00000649, 0x00000649, 0x04000649, 0x04000649, 0x1c000649, 0x1c000649, 0x1800064a, 0x00000637,
+    0x00100649, 0x00100649, 0x04100649, 0x04100649, 0x1c100649, 0x1c100649, 0x1810064a, 0x00100637,
+    0x00700649, 0x00700649, 0x04700649, 0x04700649, 0x1c700649, 0x1c700649, 0x1870064a, 0x00700637,
+    0x0060064a, 0x0460064a, 0x1c60064a, 0x00600638, 0x00200639, 0x00200639, 0x0050063a, 0x00000625,
+    0x00004649, 0x00004649, 0x04004649, 0x04004649, 0x1c004649, 0x1c004649, 0x1800464a, 0x00004637,
+    0x00104649, 0x00104649, 0x04104649, 0x04104649, 0x1c104649, 0x1c104649, 0x1810464a, 0x00104637,
+    0x00704649, 0x00704649, 0x04704649, 0x04704649, 0x1c704649, 0x1c704649, 0x1870464a, 0x00704637,
+    0x0060464a, 0x0460464a, 0x1c60464a, 0x00604638, 0x00204639, 0x00204639, 0x0050463a, 0x00004625,
+    0x0001c649, 0x0001c649, 0x0401c649, 0x0401c649, 0x1c01c649, 0x1c01c649, 0x1801c64a, 0x0001c637,
+    0x0011c649, 0x0011c649, 0x0411c649, 0x0411c649, 0x1c11c649, 0x1c11c649, 0x1811c64a, 0x0011c637,
+    0x0071c649, 0x0071c649, 0x0471c649, 0x0471c649, 0x1c71c649, 0x1c71c649, 0x1871c64a, 0x0071c637,
+    0x0061c64a, 0x0461c64a, 0x1c61c64a, 0x0061c638, 0x0021c639, 0x0021c639, 0x0051c63a, 0x0001c625,
+    0x0001864a, 0x0401864a, 0x1c01864a, 0x00018638, 0x0011864a, 0x0411864a, 0x1c11864a, 0x00118638,
+    0x0071864a, 0x0471864a, 0x1c71864a, 0x00718638, 0x00618639, 0x00618639, 0x0021863a, 0x00018626,
+    0x00008639, 0x00008639, 0x00108639, 0x00108639, 0x00708639, 0x00708639, 0x0060863a, 0x00008627,
+    0x0001463a, 0x0011463a, 0x0071463a, 0x00014628, 0x0000c629, 0x0000c629, 0x00010629, 0x00010629,
+    0x0000024a, 0x0400024a, 0x1c00024a, 0x00000238, 0x0010024a, 0x0410024a, 0x1c10024a, 0x00100238,
+    0x0070024a, 0x0470024a, 0x1c70024a, 0x00700238, 0x00600239, 0x00600239, 0x0020023a, 0x00000226,
+    0x0000424a, 0x0400424a, 0x1c00424a, 0x00004238, 0x0010424a, 0x0410424a, 0x1c10424a, 0x00104238,
+    0x0070424a, 0x0470424a, 0x1c70424a, 0x00704238, 0x00604239, 0x00604239, 0x0020423a, 0x00004226,
+    0x0001c24a, 0x0401c24a, 0x1c01c24a, 0x0001c238, 0x0011c24a, 0x0411c24a, 0x1c11c24a, 0x0011c238,
+    0x0071c24a, 0x0471c24a, 0x1c71c24a, 0x0071c238, 0x0061c239, 0x0061c239, 0x0021c23a, 0x0001c226,
+    0x00018239, 0x00018239, 0x00118239, 0x00118239, 0x00718239, 0x00718239, 0x0061823a, 0x00018227,
+    0x0000823a, 0x0010823a, 0x0070823a, 0x00008228, 0x00014229, 0x00014229, 0x0000c22a, 0x0001022a,
+    0x00000539, 0x00000539, 0x00100539, 0x00100539, 0x00700539, 0x00700539, 0x0060053a, 0x00000527,
+    0x00004539, 0x00004539, 0x00104539, 0x00104539, 0x00704539, 0x00704539, 0x0060453a, 0x00004527,
+    0x0001c539, 0x0001c539, 0x0011c539, 0x0011c539, 0x0071c539, 0x0071c539, 0x0061c53a, 0x0001c527,
+    0x0001853a, 0x0011853a, 0x0071853a, 0x00018528, 0x00008529, 0x00008529, 0x0001452a, 0x00000515,
+    0x0000033a, 0x0010033a, 0x0070033a, 0x00000328, 0x0000433a, 0x0010433a, 0x0070433a, 0x00004328,
+    0x0001c33a, 0x0011c33a, 0x0071c33a, 0x0001c328, 0x00018329, 0x00018329, 0x0000832a, 0x00000316,
+    0x0000043a, 0x0010043a, 0x0070043a, 0x00000428, 0x0000443a, 0x0010443a, 0x0070443a, 0x00004428,
+    0x0001c43a, 0x0011c43a, 0x0071c43a, 0x0001c428, 0x00018429, 0x00018429, 0x0000842a, 0x00000416,
+};
+
+static const UINT32 sa_hc_sf0_blen4_mdec_ldac[1024] = {
+    0x00008228, 0x0000823a, 0x0010823a, 0x00f0823a, 0x00038228, 0x0003823a, 0x0013823a, 0x00f3823a,
+    0x00000214, 0x00000214, 0x00034229, 0x00034229, 0x0000c229, 0x0000c229, 0x0003022a, 0x0001022a,
+    0x0020023a, 0x00e0023a, 0x00000226, 0x00000226, 0x00000238, 0x0000024a, 0x0400024a, 0x3c00024a,
+    0x00100238, 0x0010024a, 0x0410024a, 0x3c10024a, 0x00f00238, 0x00f0024a, 0x04f0024a, 0x3cf0024a,
+    0x0020423a, 0x00e0423a, 0x00004226, 0x00004226, 0x00004238, 0x0000424a, 0x0400424a, 0x3c00424a,
+    0x00104238, 0x0010424a, 0x0410424a, 0x3c10424a, 0x00f04238, 0x00f0424a, 0x04f0424a, 0x3cf0424a,
+    0x0023c23a, 0x00e3c23a, 0x0003c226, 0x0003c226, 0x0003c238, 0x0003c24a, 0x0403c24a, 0x3c03c24a,
+    0x0013c238, 0x0013c24a, 0x0413c24a, 0x3c13c24a, 0x00f3c238, 0x00f3c24a, 0x04f3c24a, 0x3cf3c24a,
+    0x00008e28, 0x00008e3a, 0x00108e3a, 0x00f08e3a, 0x00038e28, 0x00038e3a, 0x00138e3a, 0x00f38e3a,
+    0x00000e14, 0x00000e14, 0x00034e29, 0x00034e29, 0x0000ce29, 0x0000ce29, 0x00030e2a, 0x00010e2a,
+    0x00200e3a, 0x00e00e3a, 0x00000e26, 0x00000e26, 0x00000e38, 0x00000e4a, 0x04000e4a, 0x3c000e4a,
+    0x00100e38, 0x00100e4a, 0x04100e4a, 0x3c100e4a, 0x00f00e38, 0x00f00e4a, 0x04f00e4a, 0x3cf00e4a,
+    0x00204e3a, 0x00e04e3a, 0x00004e26, 0x00004e26, 0x00004e38, 0x00004e4a, 0x04004e4a, 0x3c004e4a,
+    0x00104e38, 0x00104e4a, 0x04104e4a, 0x3c104e4a, 0x00f04e38, 0x00f04e4a, 0x04f04e4a, 0x3cf04e4a,
+    0x0023ce3a, 0x00e3ce3a, 0x0003ce26, 0x0003ce26, 0x0003ce38, 0x0003ce4a, 0x0403ce4a, 0x3c03ce4a,
+    0x0013ce38, 0x0013ce4a, 0x0413ce4a, 0x3c13ce4a, 0x00f3ce38, 0x00f3ce4a, 0x04f3ce4a, 0x3cf3ce4a,
+    0x00000b18, 0x00000b2a, 0x00004b2a, 0x0003cb2a, 0x00000a18, 0x00000a2a, 0x00004a2a, 0x0003ca2a,
+    0x00000918, 0x0000092a, 0x0000492a, 0x0003c92a, 0x00000618, 0x0000062a, 0x0000462a, 0x0003c62a,
+    0x00000718, 0x0000072a, 0x0000472a, 0x0003c72a, 0x00000818, 0x0000082a, 0x0000482a, 0x0003c82a,
+    0x00000517, 0x00000517, 0x00000529, 0x00000529, 0x00004529, 0x00004529, 0x0003c529, 0x0003c529,
+    0x00008d29, 0x00008d29, 0x00038d29, 0x00038d29, 0x00000d15, 0x00034d2a, 0x0000cd2a, 0x00000d15,
+    0x00000d27, 0x00000d27, 0x00000d39, 0x00000d39, 0x00100d39, 0x00100d39, 0x00f00d39, 0x00f00d39,
+    0x00004d27, 0x00004d27, 0x00004d39, 0x00004d39, 0x00104d39, 0x00104d39, 0x00f04d39, 0x00f04d39,
+    0x0003cd27, 0x0003cd27, 0x0003cd39, 0x0003cd39, 0x0013cd39, 0x0013cd39, 0x00f3cd39, 0x00f3cd39,
+    0x00008329, 0x00008329, 0x00038329, 0x00038329, 0x00000315, 0x0003432a, 0x0000c32a, 0x00000315,
+    0x00000327, 0x00000327, 0x00000339, 0x00000339, 0x00100339, 0x00100339, 0x00f00339, 0x00f00339,
+    0x00004327, 0x00004327, 0x00004339, 0x00004339, 0x00104339, 0x00104339, 0x00f04339, 0x00f04339,
+    0x0003c327, 0x0003c327, 0x0003c339, 0x0003c339, 0x0013c339, 0x0013c339, 0x00f3c339, 0x00f3c339,
+    0x00008c2a, 0x00038c2a, 0x00000c16, 0x00000c16, 0x00000c28, 0x00000c3a, 0x00100c3a, 0x00f00c3a,
+    0x00004c28, 0x00004c3a, 0x00104c3a, 0x00f04c3a, 0x0003cc28, 0x0003cc3a, 0x0013cc3a, 0x00f3cc3a,
+    0x0000842a, 0x0003842a, 0x00000416, 0x00000416, 0x00000428, 0x0000043a, 0x0010043a, 0x00f0043a,
+    0x00004428, 0x0000443a, 0x0010443a, 0x00f0443a, 0x0003c428, 0x0003c43a, 0x0013c43a, 0x00f3c43a,
+    0x0020803a, 0x00e0803a, 0x00008026, 0x00008026, 0x00008038, 0x0000804a, 0x0400804a, 0x3c00804a,
+    0x00108038, 0x0010804a, 0x0410804a, 0x3c10804a, 0x00f08038, 0x00f0804a, 0x04f0804a, 0x3cf0804a,
+    0x0023803a, 0x00e3803a, 0x00038026, 0x00038026, 0x00038038, 0x0003804a, 0x0403804a, 0x3c03804a,
+    0x00138038, 0x0013804a, 0x0413804a, 0x3c13804a, 0x00f38038, 0x00f3804a, 0x04f3804a, 0x3cf3804a,
+    0x0002c02a, 0x0002802a, 0x0002402a, 0x0001802a, 0x0001c02a, 0x0002002a, 0x00014029, 0x00014029,
+    0x00034027, 0x00034027, 0x00034039, 0x00034039, 0x00134039, 0x00134039, 0x00f34039, 0x00f34039,
+    0x0000c027, 0x0000c027, 0x0000c039, 0x0000c039, 0x0010c039, 0x0010c039, 0x00f0c039, 0x00f0c039,
+    0x00030028, 0x0003003a, 0x0013003a, 0x00f3003a, 0x00010028, 0x0001003a, 0x0011003a, 0x00f1003a,
+    0x00200038, 0x0020004a, 0x0420004a, 0x3c20004a, 0x00e00038, 0x00e0004a, 0x04e0004a, 0x3ce0004a,
+    0x00000024, 0x00000024, 0x00d00039, 0x00d00039, 0x00300039, 0x00300039, 0x00c0003a, 0x0040003a,
+    0x0800004a, 0x3800004a, 0x00000036, 0x00000036, 0x00000048, 0x00000048, 0x00000048, 0x00000048,
+    0x04000048, 0x04000048, 0x04000048, 0x04000048, 0x3c000048, 0x3c000048, 0x3c000048, 0x3c000048,
+    0x0810004a, 0x3810004a, 0x00100036, 0x00100036, 0x00100048, 0x00100048, 0x00100048, 0x00100048,
+    0x04100048, 0x04100048, 0x04100048, 0x04100048, 0x3c100048, 0x3c100048, 0x3c100048, 0x3c100048,
+    0x08f0004a, 0x38f0004a, 0x00f00036, 0x00f00036, 0x00f00048, 0x00f00048, 0x00f00048, 0x00f00048,
+    0x04f00048, 0x04f00048, 0x04f00048, 0x04f00048, 0x3cf00048, 0x3cf00048, 0x3cf00048, 0x3cf00048,
+    0x00204038, 0x0020404a, 0x0420404a, 0x3c20404a, 0x00e04038, 0x00e0404a, 0x04e0404a, 0x3ce0404a,
+    0x00004024, 0x00004024, 0x00d04039, 0x00d04039, 0x00304039, 0x00304039, 0x00c0403a, 0x0040403a,
+    0x0800404a, 0x3800404a, 0x00004036, 0x00004036, 0x00004048, 0x00004048, 0x00004048, 0x00004048,
+    0x04004048, 0x04004048, 0x04004048, 0x04004048, 0x3c004048, 0x3c004048, 0x3c004048, 0x3c004048,
+    0x0810404a, 0x3810404a, 0x00104036, 0x00104036, 0x00104048, 0x00104048, 0x00104048, 0x00104048,
+    0x04104048, 0x04104048, 0x04104048, 0x04104048, 0x3c104048, 0x3c104048, 0x3c104048, 0x3c104048,
+    0x08f0404a, 0x38f0404a, 0x00f04036, 0x00f04036, 0x00f04048, 0x00f04048, 0x00f04048, 0x00f04048,
+    0x04f04048, 0x04f04048, 0x04f04048, 0x04f04048, 0x3cf04048, 0x3cf04048, 0x3cf04048, 0x3cf04048,
+    0x0023c038, 0x0023c04a, 0x0423c04a, 0x3c23c04a, 0x00e3c038, 0x00e3c04a, 0x04e3c04a, 0x3ce3c04a,
+    0x0003c024, 0x0003c024, 0x00d3c039, 0x00d3c039, 0x0033c039, 0x0033c039, 0x00c3c03a, 0x0043c03a,
+    0x0803c04a, 0x3803c04a, 0x0003c036, 0x0003c036, 0x0003c048, 0x0003c048, 0x0003c048, 0x0003c048,
+    0x0403c048, 0x0403c048, 0x0403c048, 0x0403c048, 0x3c03c048, 0x3c03c048, 0x3c03c048, 0x3c03c048,
+    0x0813c04a, 0x3813c04a, 0x0013c036, 0x0013c036, 0x0013c048, 0x0013c048, 0x0013c048, 0x0013c048,
+    0x0413c048, 0x0413c048, 0x0413c048, 0x0413c048, 0x3c13c048, 0x3c13c048, 0x3c13c048, 0x3c13c048,
+    0x08f3c04a, 0x38f3c04a, 0x00f3c036, 0x00f3c036, 0x00f3c048, 0x00f3c048, 0x00f3c048, 0x00f3c048,
+    0x04f3c048, 0x04f3c048, 0x04f3c048, 0x04f3c048, 0x3cf3c048, 0x3cf3c048, 0x3cf3c048, 0x3cf3c048,
+    0x0020813a, 0x00e0813a, 0x00008126, 0x00008126, 0x00008138, 0x0000814a, 0x0400814a, 0x3c00814a,
+    0x00108138, 0x0010814a, 0x0410814a, 0x3c10814a, 0x00f08138, 0x00f0814a, 0x04f0814a, 0x3cf0814a,
+    0x0023813a, 0x00e3813a, 0x00038126, 0x00038126, 0x00038138, 0x0003814a, 0x0403814a, 0x3c03814a,
+    0x00138138, 0x0013814a, 0x0413814a, 0x3c13814a, 0x00f38138, 0x00f3814a, 0x04f3814a, 0x3cf3814a,
+    0x0002c12a, 0x0002812a, 0x0002412a, 0x0001812a, 0x0001c12a, 0x0002012a, 0x00014129, 0x00014129,
+    0x00034127, 0x00034127, 0x00034139, 0x00034139, 0x00134139, 0x00134139, 0x00f34139, 0x00f34139,
+    0x0000c127, 0x0000c127, 0x0000c139, 0x0000c139, 0x0010c139, 0x0010c139, 0x00f0c139, 0x00f0c139,
+    0x00030128, 0x0003013a, 0x0013013a, 0x00f3013a, 0x00010128, 0x0001013a, 0x0011013a, 0x00f1013a,
+    0x00200138, 0x0020014a, 0x0420014a, 0x3c20014a, 0x00e00138, 0x00e0014a, 0x04e0014a, 0x3ce0014a,
+    0x00000124, 0x00000124, 0x00d00139, 0x00d00139, 0x00300139, 0x00300139, 0x00c0013a, 0x0040013a,
+    0x0800014a, 0x3800014a, 0x00000136, 0x00000136, 0x00000148, 0x00000148, 0x00000148, 0x00000148,
+    0x04000148, 0x04000148, 0x04000148, 0x04000148, 0x3c000148, 0x3c000148, 0x3c000148, 0x3c000148,
+    0x0810014a, 0x3810014a, 0x00100136, 0x00100136, 0x00100148, 0x00100148, 0x00100148, 0x00100148,
+    0x04100148, 0x04100148, 0x04100148, 0x04100148, 0x3c100148, 0x3c100148, 0x3c100148, 0x3c100148,
+    0x08f0014a, 0x38f0014a, 0x00f00136, 0x00f00136, 0x00f00148, 0x00f00148, 0x00f00148, 0x00f00148,
+    0x04f00148, 0x04f00148, 0x04f00148, 0x04f00148, 0x3cf00148, 0x3cf00148, 0x3cf00148, 0x3cf00148,
+    0x00204138, 0x0020414a, 0x0420414a, 0x3c20414a, 0x00e04138, 0x00e0414a, 0x04e0414a, 0x3ce0414a,
+    0x00004124, 0x00004124, 0x00d04139, 0x00d04139, 0x00304139, 0x00304139, 0x00c0413a, 0x0040413a,
+    0x0800414a, 0x3800414a, 0x00004136, 0x00004136, 0x00004148, 0x00004148, 0x00004148, 0x00004148,
+    0x04004148, 0x04004148, 0x04004148, 0x04004148, 0x3c004148, 0x3c004148, 0x3c004148, 0x3c004148,
+    0x0810414a, 0x3810414a, 0x00104136, 0x00104136, 0x00104148, 0x00104148, 0x00104148, 0x00104148,
+    0x04104148, 0x04104148, 0x04104148, 0x04104148, 0x3c104148, 0x3c104148, 0x3c104148, 0x3c104148,
+    0x08f0414a, 0x38f0414a, 0x00f04136, 0x00f04136, 0x00f04148, 0x00f04148, 0x00f04148, 0x00f04148,
+    0x04f04148, 0x04f04148, 0x04f04148, 0x04f04148, 0x3cf04148, 0x3cf04148, 0x3cf04148, 0x3cf04148,
+    0x0023c138, 0x0023c14a, 0x0423c14a, 0x3c23c14a, 0x00e3c138, 0x00e3c14a, 0x04e3c14a, 0x3ce3c14a,
+    0x0003c124, 0x0003c124, 0x00d3c139, 0x00d3c139, 0x0033c139, 0x0033c139, 0x00c3c13a, 0x0043c13a,
+    0x0803c14a, 0x3803c14a, 0x0003c136, 0x0003c136, 0x0003c148, 0x0003c148, 0x0003c148, 0x0003c148,
+    0x0403c148, 0x0403c148, 0x0403c148, 0x0403c148, 0x3c03c148, 0x3c03c148, 0x3c03c148, 0x3c03c148,
+    0x0813c14a, 0x3813c14a, 0x0013c136, 0x0013c136, 0x0013c148, 0x0013c148, 0x0013c148, 0x0013c148,
+    0x0413c148, 0x0413c148, 0x0413c148, 0x0413c148, 0x3c13c148, 0x3c13c148, 0x3c13c148, 0x3c13c148,
+    0x08f3c14a, 0x38f3c14a, 0x00f3c136, 0x00f3c136, 0x00f3c148, 0x00f3c148, 0x00f3c148, 0x00f3c148,
+    0x04f3c148, 0x04f3c148, 0x04f3c148, 0x04f3c148, 0x3cf3c148, 0x3cf3c148, 0x3cf3c148, 0x3cf3c148,
+    0x00208f3a, 0x00e08f3a, 0x00008f26, 0x00008f26, 0x00008f38, 0x00008f4a, 0x04008f4a, 0x3c008f4a,
+    0x00108f38, 0x00108f4a, 0x04108f4a, 0x3c108f4a, 0x00f08f38, 0x00f08f4a, 0x04f08f4a, 0x3cf08f4a,
+    0x00238f3a, 0x00e38f3a, 0x00038f26, 0x00038f26, 0x00038f38, 0x00038f4a, 0x04038f4a, 0x3c038f4a,
+    0x00138f38, 0x00138f4a, 0x04138f4a, 0x3c138f4a, 0x00f38f38, 0x00f38f4a, 0x04f38f4a, 0x3cf38f4a,
+    0x0002cf2a, 0x00028f2a, 0x00024f2a, 0x00018f2a, 0x0001cf2a, 0x00020f2a, 0x00014f29, 0x00014f29,
+    0x00034f27, 0x00034f27, 0x00034f39, 0x00034f39, 0x00134f39, 0x00134f39, 0x00f34f39, 0x00f34f39,
+    0x0000cf27, 0x0000cf27, 0x0000cf39, 0x0000cf39, 0x0010cf39, 0x0010cf39, 0x00f0cf39, 0x00f0cf39,
+    0x00030f28, 0x00030f3a, 0x00130f3a, 0x00f30f3a, 0x00010f28, 0x00010f3a, 0x00110f3a, 0x00f10f3a,
+    0x00200f38, 0x00200f4a, 0x04200f4a, 0x3c200f4a, 0x00e00f38, 0x00e00f4a, 0x04e00f4a, 0x3ce00f4a,
+    0x00000f24, 0x00000f24, 0x00d00f39, 0x00d00f39, 0x00300f39, 0x00300f39, 0x00c00f3a, 0x00400f3a,
+    0x08000f4a, 0x38000f4a, 0x00000f36, 0x00000f36, 0x00000f48, 0x00000f48, 0x00000f48, 0x00000f48,
+    0x04000f48, 0x04000f48, 0x04000f48, 0x04000f48, 0x3c000f48, 0x3c000f48, 0x3c000f48, 0x3c000f48,
+    0x08100f4a, 0x38100f4a, 0x00100f36, 0x00100f36, 0x00100f48, 0x00100f48, 0x00100f48, 0x00100f48,
+    0x04100f48, 0x04100f48, 0x04100f48, 0x04100f48, 0x3c100f48, 0x3c100f48, 0x3c100f48, 0x3c100f48,
+    0x08f00f4a, 0x38f00f4a, 0x00f00f36, 0x00f00f36, 0x00f00f48, 0x00f00f48, 0x00f00f48, 0x00f00f48,
+    0x04f00f48, 0x04f00f48, 0x04f00f48, 0x04f00f48, 0x3cf00f48, 0x3cf00f48, 0x3cf00f48, 0x3cf00f48,
+    0x00204f38, 0x00204f4a, 0x04204f4a, 0x3c204f4a, 0x00e04f38, 0x00e04f4a, 0x04e04f4a, 0x3ce04f4a,
+    0x00004f24, 0x00004f24, 0x00d04f39, 0x00d04f39, 0x00304f39, 0x00304f39, 0x00c04f3a, 0x00404f3a,
+    0x08004f4a, 0x38004f4a, 0x00004f36, 0x00004f36, 0x00004f48, 0x00004f48, 0x00004f48, 0x00004f48,
+    0x04004f48, 0x04004f48, 0x04004f48, 0x04004f48, 0x3c004f48, 0x3c004f48, 0x3c004f48, 0x3c004f48,
+    0x08104f4a, 0x38104f4a, 0x00104f36, 0x00104f36, 0x00104f48, 0x00104f48, 0x00104f48, 0x00104f48,
+    0x04104f48, 0x04104f48, 0x04104f48, 0x04104f48, 0x3c104f48, 0x3c104f48, 0x3c104f48, 0x3c104f48,
+    0x08f04f4a, 0x38f04f4a, 0x00f04f36, 0x00f04f36, 0x00f04f48, 0x00f04f48, 0x00f04f48, 0x00f04f48,
+    0x04f04f48, 0x04f04f48, 0x04f04f48, 0x04f04f48, 0x3cf04f48, 0x3cf04f48, 0x3cf04f48, 0x3cf04f48,
+    0x0023cf38, 0x0023cf4a, 0x0423cf4a, 0x3c23cf4a, 0x00e3cf38, 0x00e3cf4a, 0x04e3cf4a, 0x3ce3cf4a,
+    0x0003cf24, 0x0003cf24, 0x00d3cf39, 0x00d3cf39, 0x0033cf39, 0x0033cf39, 0x00c3cf3a, 0x0043cf3a,
+    0x0803cf4a, 0x3803cf4a, 0x0003cf36, 0x0003cf36, 0x0003cf48, 0x0003cf48, 0x0003cf48, 0x0003cf48,
+    0x0403cf48, 0x0403cf48, 0x0403cf48, 0x0403cf48, 0x3c03cf48, 0x3c03cf48, 0x3c03cf48, 0x3c03cf48,
+    0x0813cf4a, 0x3813cf4a, 0x0013cf36, 0x0013cf36, 0x0013cf48, 0x0013cf48, 0x0013cf48, 0x0013cf48,
+    0x0413cf48, 0x0413cf48, 0x0413cf48, 0x0413cf48, 0x3c13cf48, 0x3c13cf48, 0x3c13cf48, 0x3c13cf48,
+    0x08f3cf4a, 0x38f3cf4a, 0x00f3cf36, 0x00f3cf36, 0x00f3cf48, 0x00f3cf48, 0x00f3cf48, 0x00f3cf48,
+    0x04f3cf48, 0x04f3cf48, 0x04f3cf48, 0x04f3cf48, 0x3cf3cf48, 0x3cf3cf48, 0x3cf3cf48, 0x3cf3cf48,
+};
+
+static const UINT32 sa_hc_sf0_blen5_mdec_ldac[1024] = {
+    0x01f7df39, 0x01f7df39, 0x0017df39, 0x0017df39, 0x0007df26, 0x01e7df3a, 0x0007df26, 0x0007df26,
+    0x0007df38, 0x0007df38, 0x0007df4a, 0x0007df38, 0x0007df26, 0x0037df3a, 0x0027df39, 0x0027df39,
+    0x01f05f39, 0x01f05f39, 0x00105f39, 0x00105f39, 0x00005f26, 0x01e05f3a, 0x00005f26, 0x00005f26,
+    0x00005f38, 0x00005f38, 0x00005f4a, 0x00005f38, 0x00005f26, 0x00305f3a, 0x00205f39, 0x00205f39,
+    0x00069f2a, 0x0001df2a, 0x00001f13, 0x00001f13, 0x00075f28, 0x00075f28, 0x00075f3a, 0x00075f28,
+    0x01f79f3a, 0x00179f3a, 0x00079f27, 0x00079f27, 0x00079f39, 0x00079f39, 0x00079f27, 0x00279f3a,
+    0x00011f28, 0x00011f28, 0x00011f3a, 0x00011f28, 0x00001f13, 0x00001f13, 0x00019f29, 0x00019f29,
+    0x00065f2a, 0x00001f13, 0x0006df29, 0x0006df29, 0x00001f13, 0x00001f13, 0x00001f13, 0x00021f2a,
+    0x01f01f38, 0x01f01f38, 0x01f01f4a, 0x01f01f38, 0x00101f38, 0x00101f38, 0x00101f4a, 0x00101f38,
+    0x00001f25, 0x01d01f3a, 0x01e01f39, 0x01e01f39, 0x00401f3a, 0x00001f25, 0x00001f25, 0x00001f25,
+    0x7c001f4a, 0x04001f4a, 0x00001f37, 0x00001f37, 0x00001f49, 0x00001f49, 0x00001f37, 0x08001f4a,
+    0x00501f3a, 0x01c01f3a, 0x00301f39, 0x00301f39, 0x00201f38, 0x00201f38, 0x00201f4a, 0x00201f38,
+    0x00015f28, 0x00015f28, 0x00015f3a, 0x00015f28, 0x00071f28, 0x00071f28, 0x00071f3a, 0x00071f28,
+    0x01f0df3a, 0x0010df3a, 0x0000df27, 0x0000df27, 0x0000df39, 0x0000df39, 0x0000df27, 0x0020df3a,
+    0x01f09f39, 0x01f09f39, 0x00109f39, 0x00109f39, 0x00009f26, 0x01e09f3a, 0x00009f26, 0x00009f26,
+    0x00009f38, 0x00009f38, 0x00009f4a, 0x00009f38, 0x00009f26, 0x00309f3a, 0x00209f39, 0x00209f39,
+    0x01f7c139, 0x01f7c139, 0x0017c139, 0x0017c139, 0x0007c126, 0x01e7c13a, 0x0007c126, 0x0007c126,
+    0x0007c138, 0x0007c138, 0x0007c14a, 0x0007c138, 0x0007c126, 0x0037c13a, 0x0027c139, 0x0027c139,
+    0x01f04139, 0x01f04139, 0x00104139, 0x00104139, 0x00004126, 0x01e0413a, 0x00004126, 0x00004126,
+    0x00004138, 0x00004138, 0x0000414a, 0x00004138, 0x00004126, 0x0030413a, 0x00204139, 0x00204139,
+    0x0006812a, 0x0001c12a, 0x00000113, 0x00000113, 0x00074128, 0x00074128, 0x0007413a, 0x00074128,
+    0x01f7813a, 0x0017813a, 0x00078127, 0x00078127, 0x00078139, 0x00078139, 0x00078127, 0x0027813a,
+    0x00010128, 0x00010128, 0x0001013a, 0x00010128, 0x00000113, 0x00000113, 0x00018129, 0x00018129,
+    0x0006412a, 0x00000113, 0x0006c129, 0x0006c129, 0x00000113, 0x00000113, 0x00000113, 0x0002012a,
+    0x01f00138, 0x01f00138, 0x01f0014a, 0x01f00138, 0x00100138, 0x00100138, 0x0010014a, 0x00100138,
+    0x00000125, 0x01d0013a, 0x01e00139, 0x01e00139, 0x0040013a, 0x00000125, 0x00000125, 0x00000125,
+    0x7c00014a, 0x0400014a, 0x00000137, 0x00000137, 0x00000149, 0x00000149, 0x00000137, 0x0800014a,
+    0x0050013a, 0x01c0013a, 0x00300139, 0x00300139, 0x00200138, 0x00200138, 0x0020014a, 0x00200138,
+    0x00014128, 0x00014128, 0x0001413a, 0x00014128, 0x00070128, 0x00070128, 0x0007013a, 0x00070128,
+    0x01f0c13a, 0x0010c13a, 0x0000c127, 0x0000c127, 0x0000c139, 0x0000c139, 0x0000c127, 0x0020c13a,
+    0x01f08139, 0x01f08139, 0x00108139, 0x00108139, 0x00008126, 0x01e0813a, 0x00008126, 0x00008126,
+    0x00008138, 0x00008138, 0x0000814a, 0x00008138, 0x00008126, 0x0030813a, 0x00208139, 0x00208139,
+    0x0007da2a, 0x00005a2a, 0x00001a17, 0x00001a17, 0x00001a29, 0x00001a29, 0x00001a17, 0x00009a2a,
+    0x0007c72a, 0x0000472a, 0x00000717, 0x00000717, 0x00000729, 0x00000729, 0x00000717, 0x0000872a,
+    0x00001418, 0x00001418, 0x0000142a, 0x00001418, 0x00001518, 0x00001518, 0x0000152a, 0x00001518,
+    0x00001718, 0x00001718, 0x0000172a, 0x00001718, 0x00001618, 0x00001618, 0x0000162a, 0x00001618,
+    0x0007dd28, 0x0007dd28, 0x0007dd3a, 0x0007dd28, 0x00005d28, 0x00005d28, 0x00005d3a, 0x00005d28,
+    0x00001d15, 0x00075d2a, 0x00079d29, 0x00079d29, 0x00011d2a, 0x00001d15, 0x00001d15, 0x00001d15,
+    0x01f01d3a, 0x00101d3a, 0x00001d27, 0x00001d27, 0x00001d39, 0x00001d39, 0x00001d27, 0x00201d3a,
+    0x00015d2a, 0x00071d2a, 0x0000dd29, 0x0000dd29, 0x00009d28, 0x00009d28, 0x00009d3a, 0x00009d28,
+    0x01f7de3a, 0x0017de3a, 0x0007de27, 0x0007de27, 0x0007de39, 0x0007de39, 0x0007de27, 0x0027de3a,
+    0x01f05e3a, 0x00105e3a, 0x00005e27, 0x00005e27, 0x00005e39, 0x00005e39, 0x00005e27, 0x00205e3a,
+    0x00001e14, 0x00001e14, 0x00075e29, 0x00075e29, 0x00079e28, 0x00079e28, 0x00079e3a, 0x00079e28,
+    0x00011e29, 0x00011e29, 0x00001e14, 0x00019e2a, 0x00001e14, 0x0006de2a, 0x00001e14, 0x00001e14,
+    0x01f01e39, 0x01f01e39, 0x00101e39, 0x00101e39, 0x00001e26, 0x01e01e3a, 0x00001e26, 0x00001e26,
+    0x00001e38, 0x00001e38, 0x00001e4a, 0x00001e38, 0x00001e26, 0x00301e3a, 0x00201e39, 0x00201e39,
+    0x00015e29, 0x00015e29, 0x00071e29, 0x00071e29, 0x0000de28, 0x0000de28, 0x0000de3a, 0x0000de28,
+    0x01f09e3a, 0x00109e3a, 0x00009e27, 0x00009e27, 0x00009e39, 0x00009e39, 0x00009e27, 0x00209e3a,
+    0x0007c428, 0x0007c428, 0x0007c43a, 0x0007c428, 0x00004428, 0x00004428, 0x0000443a, 0x00004428,
+    0x00000415, 0x0007442a, 0x00078429, 0x00078429, 0x0001042a, 0x00000415, 0x00000415, 0x00000415,
+    0x01f0043a, 0x0010043a, 0x00000427, 0x00000427, 0x00000439, 0x00000439, 0x00000427, 0x0020043a,
+    0x0001442a, 0x0007042a, 0x0000c429, 0x0000c429, 0x00008428, 0x00008428, 0x0000843a, 0x00008428,
+    0x00000b18, 0x00000b18, 0x00000b2a, 0x00000b18, 0x00001818, 0x00001818, 0x0000182a, 0x00001818,
+    0x00000918, 0x00000918, 0x0000092a, 0x00000918, 0x00000a18, 0x00000a18, 0x00000a2a, 0x00000a18,
+    0x0007c629, 0x0007c629, 0x00004629, 0x00004629, 0x00000616, 0x0007862a, 0x00000616, 0x00000616,
+    0x00000628, 0x00000628, 0x0000063a, 0x00000628, 0x00000616, 0x0000c62a, 0x00008629, 0x00008629,
+    0x0007d92a, 0x0000592a, 0x00001917, 0x00001917, 0x00001929, 0x00001929, 0x00001917, 0x0000992a,
+    0x00001318, 0x00001318, 0x0000132a, 0x00001318, 0x00000c18, 0x00000c18, 0x00000c2a, 0x00000c18,
+    0x0007db29, 0x0007db29, 0x00005b29, 0x00005b29, 0x00001b16, 0x00079b2a, 0x00001b16, 0x00001b16,
+    0x00001b28, 0x00001b28, 0x00001b3a, 0x00001b28, 0x00001b16, 0x0000db2a, 0x00009b29, 0x00009b29,
+    0x00001218, 0x00001218, 0x0000122a, 0x00001218, 0x00000d18, 0x00000d18, 0x00000d2a, 0x00000d18,
+    0x00001018, 0x00001018, 0x0000102a, 0x00001018, 0x00001118, 0x00001118, 0x0000112a, 0x00001118,
+    0x00000e18, 0x00000e18, 0x00000e2a, 0x00000e18, 0x00000f18, 0x00000f18, 0x00000f2a, 0x00000f18,
+    0x0007c82a, 0x0000482a, 0x00000817, 0x00000817, 0x00000829, 0x00000829, 0x00000817, 0x0000882a,
+    0x01f7c038, 0x01f7c038, 0x01f7c04a, 0x01f7c038, 0x0017c038, 0x0017c038, 0x0017c04a, 0x0017c038,
+    0x0007c025, 0x01d7c03a, 0x01e7c039, 0x01e7c039, 0x0047c03a, 0x0007c025, 0x0007c025, 0x0007c025,
+    0x7c07c04a, 0x0407c04a, 0x0007c037, 0x0007c037, 0x0007c049, 0x0007c049, 0x0007c037, 0x0807c04a,
+    0x0057c03a, 0x01c7c03a, 0x0037c039, 0x0037c039, 0x0027c038, 0x0027c038, 0x0027c04a, 0x0027c038,
+    0x01f04038, 0x01f04038, 0x01f0404a, 0x01f04038, 0x00104038, 0x00104038, 0x0010404a, 0x00104038,
+    0x00004025, 0x01d0403a, 0x01e04039, 0x01e04039, 0x0040403a, 0x00004025, 0x00004025, 0x00004025,
+    0x7c00404a, 0x0400404a, 0x00004037, 0x00004037, 0x00004049, 0x00004049, 0x00004037, 0x0800404a,
+    0x0050403a, 0x01c0403a, 0x00304039, 0x00304039, 0x00204038, 0x00204038, 0x0020404a, 0x00204038,
+    0x00068029, 0x00068029, 0x0001c029, 0x0001c029, 0x0005002a, 0x0005402a, 0x0005c02a, 0x0005802a,
+    0x01f7403a, 0x0017403a, 0x00074027, 0x00074027, 0x00074039, 0x00074039, 0x00074027, 0x0027403a,
+    0x01f78039, 0x01f78039, 0x00178039, 0x00178039, 0x00078026, 0x01e7803a, 0x00078026, 0x00078026,
+    0x00078038, 0x00078038, 0x0007804a, 0x00078038, 0x00078026, 0x0037803a, 0x00278039, 0x00278039,
+    0x01f1003a, 0x0011003a, 0x00010027, 0x00010027, 0x00010039, 0x00010039, 0x00010027, 0x0021003a,
+    0x0002c02a, 0x0006002a, 0x0002402a, 0x0002802a, 0x00018028, 0x00018028, 0x0001803a, 0x00018028,
+    0x00064029, 0x00064029, 0x0004c02a, 0x0003002a, 0x0006c028, 0x0006c028, 0x0006c03a, 0x0006c028,
+    0x0004802a, 0x0003402a, 0x0004002a, 0x0004402a, 0x0003802a, 0x0003c02a, 0x00020029, 0x00020029,
+    0x7df0004a, 0x05f0004a, 0x01f00037, 0x01f00037, 0x01f00049, 0x01f00049, 0x01f00037, 0x09f0004a,
+    0x7c10004a, 0x0410004a, 0x00100037, 0x00100037, 0x00100049, 0x00100049, 0x00100037, 0x0810004a,
+    0x00000024, 0x00000024, 0x01d00039, 0x01d00039, 0x01e00038, 0x01e00038, 0x01e0004a, 0x01e00038,
+    0x00400039, 0x00400039, 0x00000024, 0x0060003a, 0x00000024, 0x01b0003a, 0x00000024, 0x00000024,
+    0x7c000049, 0x7c000049, 0x04000049, 0x04000049, 0x00000036, 0x7800004a, 0x00000036, 0x00000036,
+    0x00000048, 0x00000048, 0x00000048, 0x00000048, 0x00000036, 0x0c00004a, 0x08000049, 0x08000049,
+    0x00500039, 0x00500039, 0x01c00039, 0x01c00039, 0x00300038, 0x00300038, 0x0030004a, 0x00300038,
+    0x7c20004a, 0x0420004a, 0x00200037, 0x00200037, 0x00200049, 0x00200049, 0x00200037, 0x0820004a,
+    0x01f1403a, 0x0011403a, 0x00014027, 0x00014027, 0x00014039, 0x00014039, 0x00014027, 0x0021403a,
+    0x01f7003a, 0x0017003a, 0x00070027, 0x00070027, 0x00070039, 0x00070039, 0x00070027, 0x0027003a,
+    0x01f0c039, 0x01f0c039, 0x0010c039, 0x0010c039, 0x0000c026, 0x01e0c03a, 0x0000c026, 0x0000c026,
+    0x0000c038, 0x0000c038, 0x0000c04a, 0x0000c038, 0x0000c026, 0x0030c03a, 0x0020c039, 0x0020c039,
+    0x01f08038, 0x01f08038, 0x01f0804a, 0x01f08038, 0x00108038, 0x00108038, 0x0010804a, 0x00108038,
+    0x00008025, 0x01d0803a, 0x01e08039, 0x01e08039, 0x0040803a, 0x00008025, 0x00008025, 0x00008025,
+    0x7c00804a, 0x0400804a, 0x00008037, 0x00008037, 0x00008049, 0x00008049, 0x00008037, 0x0800804a,
+    0x0050803a, 0x01c0803a, 0x00308039, 0x00308039, 0x00208038, 0x00208038, 0x0020804a, 0x00208038,
+    0x0007c528, 0x0007c528, 0x0007c53a, 0x0007c528, 0x00004528, 0x00004528, 0x0000453a, 0x00004528,
+    0x00000515, 0x0007452a, 0x00078529, 0x00078529, 0x0001052a, 0x00000515, 0x00000515, 0x00000515,
+    0x01f0053a, 0x0010053a, 0x00000527, 0x00000527, 0x00000539, 0x00000539, 0x00000527, 0x0020053a,
+    0x0001452a, 0x0007052a, 0x0000c529, 0x0000c529, 0x00008528, 0x00008528, 0x0000853a, 0x00008528,
+    0x0007dc28, 0x0007dc28, 0x0007dc3a, 0x0007dc28, 0x00005c28, 0x00005c28, 0x00005c3a, 0x00005c28,
+    0x00001c15, 0x00075c2a, 0x00079c29, 0x00079c29, 0x00011c2a, 0x00001c15, 0x00001c15, 0x00001c15,
+    0x01f01c3a, 0x00101c3a, 0x00001c27, 0x00001c27, 0x00001c39, 0x00001c39, 0x00001c27, 0x00201c3a,
+    0x00015c2a, 0x00071c2a, 0x0000dc29, 0x0000dc29, 0x00009c28, 0x00009c28, 0x00009c3a, 0x00009c28,
+    0x01f7c33a, 0x0017c33a, 0x0007c327, 0x0007c327, 0x0007c339, 0x0007c339, 0x0007c327, 0x0027c33a,
+    0x01f0433a, 0x0010433a, 0x00004327, 0x00004327, 0x00004339, 0x00004339, 0x00004327, 0x0020433a,
+    0x00000314, 0x00000314, 0x00074329, 0x00074329, 0x00078328, 0x00078328, 0x0007833a, 0x00078328,
+    0x00010329, 0x00010329, 0x00000314, 0x0001832a, 0x00000314, 0x0006c32a, 0x00000314, 0x00000314,
+    0x01f00339, 0x01f00339, 0x00100339, 0x00100339, 0x00000326, 0x01e0033a, 0x00000326, 0x00000326,
+    0x00000338, 0x00000338, 0x0000034a, 0x00000338, 0x00000326, 0x0030033a, 0x00200339, 0x00200339,
+    0x00014329, 0x00014329, 0x00070329, 0x00070329, 0x0000c328, 0x0000c328, 0x0000c33a, 0x0000c328,
+    0x01f0833a, 0x0010833a, 0x00008327, 0x00008327, 0x00008339, 0x00008339, 0x00008327, 0x0020833a,
+    0x01f7c239, 0x01f7c239, 0x0017c239, 0x0017c239, 0x0007c226, 0x01e7c23a, 0x0007c226, 0x0007c226,
+    0x0007c238, 0x0007c238, 0x0007c24a, 0x0007c238, 0x0007c226, 0x0037c23a, 0x0027c239, 0x0027c239,
+    0x01f04239, 0x01f04239, 0x00104239, 0x00104239, 0x00004226, 0x01e0423a, 0x00004226, 0x00004226,
+    0x00004238, 0x00004238, 0x0000424a, 0x00004238, 0x00004226, 0x0030423a, 0x00204239, 0x00204239,
+    0x0006822a, 0x0001c22a, 0x00000213, 0x00000213, 0x00074228, 0x00074228, 0x0007423a, 0x00074228,
+    0x01f7823a, 0x0017823a, 0x00078227, 0x00078227, 0x00078239, 0x00078239, 0x00078227, 0x0027823a,
+    0x00010228, 0x00010228, 0x0001023a, 0x00010228, 0x00000213, 0x00000213, 0x00018229, 0x00018229,
+    0x0006422a, 0x00000213, 0x0006c229, 0x0006c229, 0x00000213, 0x00000213, 0x00000213, 0x0002022a,
+    0x01f00238, 0x01f00238, 0x01f0024a, 0x01f00238, 0x00100238, 0x00100238, 0x0010024a, 0x00100238,
+    0x00000225, 0x01d0023a, 0x01e00239, 0x01e00239, 0x0040023a, 0x00000225, 0x00000225, 0x00000225,
+    0x7c00024a, 0x0400024a, 0x00000237, 0x00000237, 0x00000249, 0x00000249, 0x00000237, 0x0800024a,
+    0x0050023a, 0x01c0023a, 0x00300239, 0x00300239, 0x00200238, 0x00200238, 0x0020024a, 0x00200238,
+    0x00014228, 0x00014228, 0x0001423a, 0x00014228, 0x00070228, 0x00070228, 0x0007023a, 0x00070228,
+    0x01f0c23a, 0x0010c23a, 0x0000c227, 0x0000c227, 0x0000c239, 0x0000c239, 0x0000c227, 0x0020c23a,
+    0x01f08239, 0x01f08239, 0x00108239, 0x00108239, 0x00008226, 0x01e0823a, 0x00008226, 0x00008226,
+    0x00008238, 0x00008238, 0x0000824a, 0x00008238, 0x00008226, 0x0030823a, 0x00208239, 0x00208239,
+};
+
+static const UINT32 sa_hc_sf0_blen6_mdec_ldac[1024] = {
+    0x00000039, 0x00000039, 0x00100039, 0x00100039, 0x0020003a, 0x0030003a, 0x03d0003a, 0x03e0003a,
+    0x03f0003a, 0x00000026, 0x00000026, 0x00000026, 0x00000026, 0x00000026, 0x00000026, 0x00000026,
+    0x00004039, 0x00004039, 0x00104039, 0x00104039, 0x0020403a, 0x0030403a, 0x03d0403a, 0x03e0403a,
+    0x03f0403a, 0x00004026, 0x00004026, 0x00004026, 0x00004026, 0x00004026, 0x00004026, 0x00004026,
+    0x0000803a, 0x0010803a, 0x00008027, 0x00008027, 0x00008027, 0x00008027, 0x00008027, 0x00008027,
+    0x0000c03a, 0x0010c03a, 0x0000c027, 0x0000c027, 0x0000c027, 0x0000c027, 0x0000c027, 0x0000c027,
+    0x000f403a, 0x001f403a, 0x000f4027, 0x000f4027, 0x000f4027, 0x000f4027, 0x000f4027, 0x000f4027,
+    0x000f803a, 0x001f803a, 0x000f8027, 0x000f8027, 0x000f8027, 0x000f8027, 0x000f8027, 0x000f8027,
+    0x000fc03a, 0x001fc03a, 0x000fc027, 0x000fc027, 0x000fc027, 0x000fc027, 0x000fc027, 0x000fc027,
+    0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00014028, 0x00014028, 0x00014028, 0x00014028,
+    0x000e8028, 0x000e8028, 0x000e8028, 0x000e8028, 0x000ec028, 0x000ec028, 0x000ec028, 0x000ec028,
+    0x000f0028, 0x000f0028, 0x000f0028, 0x000f0028, 0x00018029, 0x00018029, 0x0001c029, 0x0001c029,
+    0x00020029, 0x00020029, 0x000e0029, 0x000e0029, 0x000e4029, 0x000e4029, 0x0002402a, 0x0002802a,
+    0x000d402a, 0x000d802a, 0x000dc02a, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
+    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
+    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
+    0x00000139, 0x00000139, 0x00100139, 0x00100139, 0x0020013a, 0x0030013a, 0x03d0013a, 0x03e0013a,
+    0x03f0013a, 0x00000126, 0x00000126, 0x00000126, 0x00000126, 0x00000126, 0x00000126, 0x00000126,
+    0x00004139, 0x00004139, 0x00104139, 0x00104139, 0x0020413a, 0x0030413a, 0x03d0413a, 0x03e0413a,
+    0x03f0413a, 0x00004126, 0x00004126, 0x00004126, 0x00004126, 0x00004126, 0x00004126, 0x00004126,
+    0x0000813a, 0x0010813a, 0x00008127, 0x00008127, 0x00008127, 0x00008127, 0x00008127, 0x00008127,
+    0x0000c13a, 0x0010c13a, 0x0000c127, 0x0000c127, 0x0000c127, 0x0000c127, 0x0000c127, 0x0000c127,
+    0x000f413a, 0x001f413a, 0x000f4127, 0x000f4127, 0x000f4127, 0x000f4127, 0x000f4127, 0x000f4127,
+    0x000f813a, 0x001f813a, 0x000f8127, 0x000f8127, 0x000f8127, 0x000f8127, 0x000f8127, 0x000f8127,
+    0x000fc13a, 0x001fc13a, 0x000fc127, 0x000fc127, 0x000fc127, 0x000fc127, 0x000fc127, 0x000fc127,
+    0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00014128, 0x00014128, 0x00014128, 0x00014128,
+    0x000e8128, 0x000e8128, 0x000e8128, 0x000e8128, 0x000ec128, 0x000ec128, 0x000ec128, 0x000ec128,
+    0x000f0128, 0x000f0128, 0x000f0128, 0x000f0128, 0x00018129, 0x00018129, 0x0001c129, 0x0001c129,
+    0x00020129, 0x00020129, 0x000e0129, 0x000e0129, 0x000e4129, 0x000e4129, 0x0002412a, 0x0002812a,
+    0x000d412a, 0x000d812a, 0x000dc12a, 0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113,
+    0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113,
+    0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x00000113,
+    0x0000023a, 0x0010023a, 0x00000227, 0x00000227, 0x00000227, 0x00000227, 0x00000227, 0x00000227,
+    0x0000423a, 0x0010423a, 0x00004227, 0x00004227, 0x00004227, 0x00004227, 0x00004227, 0x00004227,
+    0x00008228, 0x00008228, 0x00008228, 0x00008228, 0x0000c228, 0x0000c228, 0x0000c228, 0x0000c228,
+    0x000f4228, 0x000f4228, 0x000f4228, 0x000f4228, 0x000f8228, 0x000f8228, 0x000f8228, 0x000f8228,
+    0x000fc228, 0x000fc228, 0x000fc228, 0x000fc228, 0x00010229, 0x00010229, 0x00014229, 0x00014229,
+    0x000e8229, 0x000e8229, 0x000ec229, 0x000ec229, 0x000f0229, 0x000f0229, 0x0001822a, 0x0001c22a,
+    0x0002022a, 0x000e022a, 0x000e422a, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214,
+    0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214,
+    0x0000033a, 0x0010033a, 0x00000327, 0x00000327, 0x00000327, 0x00000327, 0x00000327, 0x00000327,
+    0x0000433a, 0x0010433a, 0x00004327, 0x00004327, 0x00004327, 0x00004327, 0x00004327, 0x00004327,
+    0x00008328, 0x00008328, 0x00008328, 0x00008328, 0x0000c328, 0x0000c328, 0x0000c328, 0x0000c328,
+    0x000f4328, 0x000f4328, 0x000f4328, 0x000f4328, 0x000f8328, 0x000f8328, 0x000f8328, 0x000f8328,
+    0x000fc328, 0x000fc328, 0x000fc328, 0x000fc328, 0x00010329, 0x00010329, 0x00014329, 0x00014329,
+    0x000e8329, 0x000e8329, 0x000ec329, 0x000ec329, 0x000f0329, 0x000f0329, 0x0001832a, 0x0001c32a,
+    0x0002032a, 0x000e032a, 0x000e432a, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314,
+    0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314,
+    0x00003d3a, 0x00103d3a, 0x00003d27, 0x00003d27, 0x00003d27, 0x00003d27, 0x00003d27, 0x00003d27,
+    0x00007d3a, 0x00107d3a, 0x00007d27, 0x00007d27, 0x00007d27, 0x00007d27, 0x00007d27, 0x00007d27,
+    0x0000bd28, 0x0000bd28, 0x0000bd28, 0x0000bd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28,
+    0x000f7d28, 0x000f7d28, 0x000f7d28, 0x000f7d28, 0x000fbd28, 0x000fbd28, 0x000fbd28, 0x000fbd28,
+    0x000ffd28, 0x000ffd28, 0x000ffd28, 0x000ffd28, 0x00013d29, 0x00013d29, 0x00017d29, 0x00017d29,
+    0x000ebd29, 0x000ebd29, 0x000efd29, 0x000efd29, 0x000f3d29, 0x000f3d29, 0x0001bd2a, 0x0001fd2a,
+    0x00023d2a, 0x000e3d2a, 0x000e7d2a, 0x00003d14, 0x00003d14, 0x00003d14, 0x00003d14, 0x00003d14,
+    0x00003d14, 0x00003d14, 0x00003d14, 0x00003d14, 0x00003d14, 0x00003d14, 0x00003d14, 0x00003d14,
+    0x00003e3a, 0x00103e3a, 0x00003e27, 0x00003e27, 0x00003e27, 0x00003e27, 0x00003e27, 0x00003e27,
+    0x00007e3a, 0x00107e3a, 0x00007e27, 0x00007e27, 0x00007e27, 0x00007e27, 0x00007e27, 0x00007e27,
+    0x0000be28, 0x0000be28, 0x0000be28, 0x0000be28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28,
+    0x000f7e28, 0x000f7e28, 0x000f7e28, 0x000f7e28, 0x000fbe28, 0x000fbe28, 0x000fbe28, 0x000fbe28,
+    0x000ffe28, 0x000ffe28, 0x000ffe28, 0x000ffe28, 0x00013e29, 0x00013e29, 0x00017e29, 0x00017e29,
+    0x000ebe29, 0x000ebe29, 0x000efe29, 0x000efe29, 0x000f3e29, 0x000f3e29, 0x0001be2a, 0x0001fe2a,
+    0x00023e2a, 0x000e3e2a, 0x000e7e2a, 0x00003e14, 0x00003e14, 0x00003e14, 0x00003e14, 0x00003e14,
+    0x00003e14, 0x00003e14, 0x00003e14, 0x00003e14, 0x00003e14, 0x00003e14, 0x00003e14, 0x00003e14,
+    0x00003f3a, 0x00103f3a, 0x00003f27, 0x00003f27, 0x00003f27, 0x00003f27, 0x00003f27, 0x00003f27,
+    0x00007f3a, 0x00107f3a, 0x00007f27, 0x00007f27, 0x00007f27, 0x00007f27, 0x00007f27, 0x00007f27,
+    0x0000bf28, 0x0000bf28, 0x0000bf28, 0x0000bf28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28,
+    0x000f7f28, 0x000f7f28, 0x000f7f28, 0x000f7f28, 0x000fbf28, 0x000fbf28, 0x000fbf28, 0x000fbf28,
+    0x000fff28, 0x000fff28, 0x000fff28, 0x000fff28, 0x00013f29, 0x00013f29, 0x00017f29, 0x00017f29,
+    0x000ebf29, 0x000ebf29, 0x000eff29, 0x000eff29, 0x000f3f29, 0x000f3f29, 0x0001bf2a, 0x0001ff2a,
+    0x00023f2a, 0x000e3f2a, 0x000e7f2a, 0x00003f14, 0x00003f14, 0x00003f14, 0x00003f14, 0x00003f14,
+    0x00003f14, 0x00003f14, 0x00003f14, 0x00003f14, 0x00003f14, 0x00003f14, 0x00003f14, 0x00003f14,
+    0x00000428, 0x00000428, 0x00000428, 0x00000428, 0x00004428, 0x00004428, 0x00004428, 0x00004428,
+    0x00008429, 0x00008429, 0x0000c429, 0x0000c429, 0x000f4429, 0x000f4429, 0x000f8429, 0x000f8429,
+    0x000fc429, 0x000fc429, 0x0001042a, 0x0001442a, 0x000e842a, 0x000ec42a, 0x000f042a, 0x00000415,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415,
+    0x00000528, 0x00000528, 0x00000528, 0x00000528, 0x00004528, 0x00004528, 0x00004528, 0x00004528,
+    0x00008529, 0x00008529, 0x0000c529, 0x0000c529, 0x000f4529, 0x000f4529, 0x000f8529, 0x000f8529,
+    0x000fc529, 0x000fc529, 0x0001052a, 0x0001452a, 0x000e852a, 0x000ec52a, 0x000f052a, 0x00000515,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515,
+    0x00003a28, 0x00003a28, 0x00003a28, 0x00003a28, 0x00007a28, 0x00007a28, 0x00007a28, 0x00007a28,
+    0x0000ba29, 0x0000ba29, 0x0000fa29, 0x0000fa29, 0x000f7a29, 0x000f7a29, 0x000fba29, 0x000fba29,
+    0x000ffa29, 0x000ffa29, 0x00013a2a, 0x00017a2a, 0x000eba2a, 0x000efa2a, 0x000f3a2a, 0x00003a15,
+    0x00003a15, 0x00003a15, 0x00003a15, 0x00003a15, 0x00003a15, 0x00003a15, 0x00003a15, 0x00003a15,
+    0x00003b28, 0x00003b28, 0x00003b28, 0x00003b28, 0x00007b28, 0x00007b28, 0x00007b28, 0x00007b28,
+    0x0000bb29, 0x0000bb29, 0x0000fb29, 0x0000fb29, 0x000f7b29, 0x000f7b29, 0x000fbb29, 0x000fbb29,
+    0x000ffb29, 0x000ffb29, 0x00013b2a, 0x00017b2a, 0x000ebb2a, 0x000efb2a, 0x000f3b2a, 0x00003b15,
+    0x00003b15, 0x00003b15, 0x00003b15, 0x00003b15, 0x00003b15, 0x00003b15, 0x00003b15, 0x00003b15,
+    0x00003c28, 0x00003c28, 0x00003c28, 0x00003c28, 0x00007c28, 0x00007c28, 0x00007c28, 0x00007c28,
+    0x0000bc29, 0x0000bc29, 0x0000fc29, 0x0000fc29, 0x000f7c29, 0x000f7c29, 0x000fbc29, 0x000fbc29,
+    0x000ffc29, 0x000ffc29, 0x00013c2a, 0x00017c2a, 0x000ebc2a, 0x000efc2a, 0x000f3c2a, 0x00003c15,
+    0x00003c15, 0x00003c15, 0x00003c15, 0x00003c15, 0x00003c15, 0x00003c15, 0x00003c15, 0x00003c15,
+    0x00000629, 0x00000629, 0x00004629, 0x00004629, 0x0000862a, 0x0000c62a, 0x000f462a, 0x000f862a,
+    0x000fc62a, 0x00000616, 0x00000616, 0x00000616, 0x00000616, 0x00000616, 0x00000616, 0x00000616,
+    0x00000729, 0x00000729, 0x00004729, 0x00004729, 0x0000872a, 0x0000c72a, 0x000f472a, 0x000f872a,
+    0x000fc72a, 0x00000716, 0x00000716, 0x00000716, 0x00000716, 0x00000716, 0x00000716, 0x00000716,
+    0x00000829, 0x00000829, 0x00004829, 0x00004829, 0x0000882a, 0x0000c82a, 0x000f482a, 0x000f882a,
+    0x000fc82a, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816,
+    0x00003829, 0x00003829, 0x00007829, 0x00007829, 0x0000b82a, 0x0000f82a, 0x000f782a, 0x000fb82a,
+    0x000ff82a, 0x00003816, 0x00003816, 0x00003816, 0x00003816, 0x00003816, 0x00003816, 0x00003816,
+    0x00003929, 0x00003929, 0x00007929, 0x00007929, 0x0000b92a, 0x0000f92a, 0x000f792a, 0x000fb92a,
+    0x000ff92a, 0x00003916, 0x00003916, 0x00003916, 0x00003916, 0x00003916, 0x00003916, 0x00003916,
+    0x0000092a, 0x0000492a, 0x00000917, 0x00000917, 0x00000917, 0x00000917, 0x00000917, 0x00000917,
+    0x00000a2a, 0x00004a2a, 0x00000a17, 0x00000a17, 0x00000a17, 0x00000a17, 0x00000a17, 0x00000a17,
+    0x0000352a, 0x0000752a, 0x00003517, 0x00003517, 0x00003517, 0x00003517, 0x00003517, 0x00003517,
+    0x0000362a, 0x0000762a, 0x00003617, 0x00003617, 0x00003617, 0x00003617, 0x00003617, 0x00003617,
+    0x0000372a, 0x0000772a, 0x00003717, 0x00003717, 0x00003717, 0x00003717, 0x00003717, 0x00003717,
+    0x00000b18, 0x00000b18, 0x00000b18, 0x00000b18, 0x00000c18, 0x00000c18, 0x00000c18, 0x00000c18,
+    0x00000d18, 0x00000d18, 0x00000d18, 0x00000d18, 0x00000e18, 0x00000e18, 0x00000e18, 0x00000e18,
+    0x00000f18, 0x00000f18, 0x00000f18, 0x00000f18, 0x00001018, 0x00001018, 0x00001018, 0x00001018,
+    0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001218, 0x00001218, 0x00001218, 0x00001218,
+    0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001418, 0x00001418, 0x00001418, 0x00001418,
+    0x00001518, 0x00001518, 0x00001518, 0x00001518, 0x00001618, 0x00001618, 0x00001618, 0x00001618,
+    0x00001718, 0x00001718, 0x00001718, 0x00001718, 0x00001818, 0x00001818, 0x00001818, 0x00001818,
+    0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18,
+    0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18,
+    0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18,
+    0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00002018, 0x00002018, 0x00002018, 0x00002018,
+    0x00002118, 0x00002118, 0x00002118, 0x00002118, 0x00002218, 0x00002218, 0x00002218, 0x00002218,
+    0x00002318, 0x00002318, 0x00002318, 0x00002318, 0x00002418, 0x00002418, 0x00002418, 0x00002418,
+    0x00002518, 0x00002518, 0x00002518, 0x00002518, 0x00002618, 0x00002618, 0x00002618, 0x00002618,
+    0x00002718, 0x00002718, 0x00002718, 0x00002718, 0x00002818, 0x00002818, 0x00002818, 0x00002818,
+    0x00002918, 0x00002918, 0x00002918, 0x00002918, 0x00002a18, 0x00002a18, 0x00002a18, 0x00002a18,
+    0x00002b18, 0x00002b18, 0x00002b18, 0x00002b18, 0x00002c18, 0x00002c18, 0x00002c18, 0x00002c18,
+    0x00002d18, 0x00002d18, 0x00002d18, 0x00002d18, 0x00002e18, 0x00002e18, 0x00002e18, 0x00002e18,
+    0x00002f18, 0x00002f18, 0x00002f18, 0x00002f18, 0x00003018, 0x00003018, 0x00003018, 0x00003018,
+    0x00003118, 0x00003118, 0x00003118, 0x00003118, 0x00003218, 0x00003218, 0x00003218, 0x00003218,
+    0x00003318, 0x00003318, 0x00003318, 0x00003318, 0x00003418, 0x00003418, 0x00003418, 0x00003418,
+};
+
+static const UINT32 sa_hc_sf1_blen2_mdec_ldac[1024] = {
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045,
+    0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045,
+    0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045,
+    0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045, 0x0c000045,
+    0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045,
+    0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045,
+    0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045,
+    0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045, 0x04000045,
+    0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045,
+    0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045,
+    0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045,
+    0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045, 0x00300045,
+    0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046,
+    0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046, 0x0c300046,
+    0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046,
+    0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046, 0x04300046,
+    0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045,
+    0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045,
+    0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045,
+    0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045, 0x00100045,
+    0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046,
+    0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046, 0x0c100046,
+    0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046,
+    0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046, 0x04100046,
+    0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045,
+    0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045,
+    0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045,
+    0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045, 0x0000c045,
+    0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046,
+    0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046, 0x0c00c046,
+    0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046,
+    0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046, 0x0400c046,
+    0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046,
+    0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046, 0x0030c046,
+    0x0c30c047, 0x0c30c047, 0x0c30c047, 0x0c30c047, 0x0c30c047, 0x0c30c047, 0x0c30c047, 0x0c30c047,
+    0x0430c047, 0x0430c047, 0x0430c047, 0x0430c047, 0x0430c047, 0x0430c047, 0x0430c047, 0x0430c047,
+    0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046,
+    0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046, 0x0010c046,
+    0x0c10c047, 0x0c10c047, 0x0c10c047, 0x0c10c047, 0x0c10c047, 0x0c10c047, 0x0c10c047, 0x0c10c047,
+    0x0410c047, 0x0410c047, 0x0410c047, 0x0410c047, 0x0410c047, 0x0410c047, 0x0410c047, 0x0410c047,
+    0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045,
+    0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045,
+    0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045,
+    0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045, 0x00004045,
+    0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046,
+    0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046, 0x0c004046,
+    0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046,
+    0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046, 0x04004046,
+    0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046,
+    0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046, 0x00304046,
+    0x0c304047, 0x0c304047, 0x0c304047, 0x0c304047, 0x0c304047, 0x0c304047, 0x0c304047, 0x0c304047,
+    0x04304047, 0x04304047, 0x04304047, 0x04304047, 0x04304047, 0x04304047, 0x04304047, 0x04304047,
+    0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046,
+    0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046, 0x00104046,
+    0x0c104047, 0x0c104047, 0x0c104047, 0x0c104047, 0x0c104047, 0x0c104047, 0x0c104047, 0x0c104047,
+    0x04104047, 0x04104047, 0x04104047, 0x04104047, 0x04104047, 0x04104047, 0x04104047, 0x04104047,
+    0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345,
+    0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345,
+    0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345,
+    0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345, 0x00000345,
+    0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346,
+    0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346, 0x0c000346,
+    0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346,
+    0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346, 0x04000346,
+    0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346,
+    0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346, 0x00300346,
+    0x0c300347, 0x0c300347, 0x0c300347, 0x0c300347, 0x0c300347, 0x0c300347, 0x0c300347, 0x0c300347,
+    0x04300347, 0x04300347, 0x04300347, 0x04300347, 0x04300347, 0x04300347, 0x04300347, 0x04300347,
+    0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346,
+    0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346, 0x00100346,
+    0x0c100347, 0x0c100347, 0x0c100347, 0x0c100347, 0x0c100347, 0x0c100347, 0x0c100347, 0x0c100347,
+    0x04100347, 0x04100347, 0x04100347, 0x04100347, 0x04100347, 0x04100347, 0x04100347, 0x04100347,
+    0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346,
+    0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346, 0x0000c346,
+    0x0c00c347, 0x0c00c347, 0x0c00c347, 0x0c00c347, 0x0c00c347, 0x0c00c347, 0x0c00c347, 0x0c00c347,
+    0x0400c347, 0x0400c347, 0x0400c347, 0x0400c347, 0x0400c347, 0x0400c347, 0x0400c347, 0x0400c347,
+    0x0030c347, 0x0030c347, 0x0030c347, 0x0030c347, 0x0030c347, 0x0030c347, 0x0030c347, 0x0030c347,
+    0x0c30c348, 0x0c30c348, 0x0c30c348, 0x0c30c348, 0x0430c348, 0x0430c348, 0x0430c348, 0x0430c348,
+    0x0010c347, 0x0010c347, 0x0010c347, 0x0010c347, 0x0010c347, 0x0010c347, 0x0010c347, 0x0010c347,
+    0x0c10c348, 0x0c10c348, 0x0c10c348, 0x0c10c348, 0x0410c348, 0x0410c348, 0x0410c348, 0x0410c348,
+    0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346,
+    0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346, 0x00004346,
+    0x0c004347, 0x0c004347, 0x0c004347, 0x0c004347, 0x0c004347, 0x0c004347, 0x0c004347, 0x0c004347,
+    0x04004347, 0x04004347, 0x04004347, 0x04004347, 0x04004347, 0x04004347, 0x04004347, 0x04004347,
+    0x00304347, 0x00304347, 0x00304347, 0x00304347, 0x00304347, 0x00304347, 0x00304347, 0x00304347,
+    0x0c304348, 0x0c304348, 0x0c304348, 0x0c304348, 0x04304348, 0x04304348, 0x04304348, 0x04304348,
+    0x00104347, 0x00104347, 0x00104347, 0x00104347, 0x00104347, 0x00104347, 0x00104347, 0x00104347,
+    0x0c104348, 0x0c104348, 0x0c104348, 0x0c104348, 0x04104348, 0x04104348, 0x04104348, 0x04104348,
+    0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145,
+    0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145,
+    0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145,
+    0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145, 0x00000145,
+    0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146,
+    0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146, 0x0c000146,
+    0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146,
+    0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146, 0x04000146,
+    0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146,
+    0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146, 0x00300146,
+    0x0c300147, 0x0c300147, 0x0c300147, 0x0c300147, 0x0c300147, 0x0c300147, 0x0c300147, 0x0c300147,
+    0x04300147, 0x04300147, 0x04300147, 0x04300147, 0x04300147, 0x04300147, 0x04300147, 0x04300147,
+    0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146,
+    0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146, 0x00100146,
+    0x0c100147, 0x0c100147, 0x0c100147, 0x0c100147, 0x0c100147, 0x0c100147, 0x0c100147, 0x0c100147,
+    0x04100147, 0x04100147, 0x04100147, 0x04100147, 0x04100147, 0x04100147, 0x04100147, 0x04100147,
+    0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146,
+    0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146, 0x0000c146,
+    0x0c00c147, 0x0c00c147, 0x0c00c147, 0x0c00c147, 0x0c00c147, 0x0c00c147, 0x0c00c147, 0x0c00c147,
+    0x0400c147, 0x0400c147, 0x0400c147, 0x0400c147, 0x0400c147, 0x0400c147, 0x0400c147, 0x0400c147,
+    0x0030c147, 0x0030c147, 0x0030c147, 0x0030c147, 0x0030c147, 0x0030c147, 0x0030c147, 0x0030c147,
+    0x0c30c148, 0x0c30c148, 0x0c30c148, 0x0c30c148, 0x0430c148, 0x0430c148, 0x0430c148, 0x0430c148,
+    0x0010c147, 0x0010c147, 0x0010c147, 0x0010c147, 0x0010c147, 0x0010c147, 0x0010c147, 0x0010c147,
+    0x0c10c148, 0x0c10c148, 0x0c10c148, 0x0c10c148, 0x0410c148, 0x0410c148, 0x0410c148, 0x0410c148,
+    0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146,
+    0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146, 0x00004146,
+    0x0c004147, 0x0c004147, 0x0c004147, 0x0c004147, 0x0c004147, 0x0c004147, 0x0c004147, 0x0c004147,
+    0x04004147, 0x04004147, 0x04004147, 0x04004147, 0x04004147, 0x04004147, 0x04004147, 0x04004147,
+    0x00304147, 0x00304147, 0x00304147, 0x00304147, 0x00304147, 0x00304147, 0x00304147, 0x00304147,
+    0x0c304148, 0x0c304148, 0x0c304148, 0x0c304148, 0x04304148, 0x04304148, 0x04304148, 0x04304148,
+    0x00104147, 0x00104147, 0x00104147, 0x00104147, 0x00104147, 0x00104147, 0x00104147, 0x00104147,
+    0x0c104148, 0x0c104148, 0x0c104148, 0x0c104148, 0x04104148, 0x04104148, 0x04104148, 0x04104148,
+};
+
+static const UINT32 sa_hc_sf1_blen3_mdec_ldac[1024] = {
+    0x00104139, 0x0010414a, 0x00004126, 0x0060413a, 0x00704138, 0x1c70414a, 0x00704149, 0x00704149,
+    0x0400414a, 0x00004137, 0x1c004149, 0x1c004149, 0x00004148, 0x00004148, 0x00004148, 0x00004148,
+    0x00008128, 0x0070813a, 0x00008139, 0x0000814a, 0x00014129, 0x0001413a, 0x0000c129, 0x0000c13a,
+    0x0011813a, 0x00018127, 0x00718139, 0x0071814a, 0x00018138, 0x1c01814a, 0x00018149, 0x00018149,
+    0x0011c138, 0x1c11c14a, 0x0011c149, 0x0011c149, 0x0021c13a, 0x0001c125, 0x0061c139, 0x0061c14a,
+    0x0471c14a, 0x0071c137, 0x1c71c149, 0x1c71c149, 0x0071c148, 0x0071c148, 0x0071c148, 0x0071c148,
+    0x0401c149, 0x0401c149, 0x0001c136, 0x1801c14a, 0x1c01c148, 0x1c01c148, 0x1c01c148, 0x1c01c148,
+    0x0001c147, 0x0001c147, 0x0001c147, 0x0001c147, 0x0001c147, 0x0001c147, 0x0001c147, 0x0001c147,
+    0x0410014a, 0x00100137, 0x1c100149, 0x1c100149, 0x00100148, 0x00100148, 0x00100148, 0x00100148,
+    0x00200139, 0x0020014a, 0x0050013a, 0x0030013a, 0x00600138, 0x1c60014a, 0x00600149, 0x00600149,
+    0x04700149, 0x04700149, 0x00700136, 0x1870014a, 0x1c700148, 0x1c700148, 0x1c700148, 0x1c700148,
+    0x00700147, 0x00700147, 0x00700147, 0x00700147, 0x00700147, 0x00700147, 0x00700147, 0x00700147,
+    0x04000148, 0x04000148, 0x04000148, 0x04000148, 0x0800014a, 0x00000135, 0x18000149, 0x18000149,
+    0x1c000147, 0x1c000147, 0x1c000147, 0x1c000147, 0x1c000147, 0x1c000147, 0x1c000147, 0x1c000147,
+    0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146,
+    0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146,
+    0x00004228, 0x0070423a, 0x00004239, 0x0000424a, 0x0000822a, 0x00000215, 0x00018229, 0x0001823a,
+    0x0011c23a, 0x0001c227, 0x0071c239, 0x0071c24a, 0x0001c238, 0x1c01c24a, 0x0001c249, 0x0001c249,
+    0x00100239, 0x0010024a, 0x00000226, 0x0060023a, 0x00700238, 0x1c70024a, 0x00700249, 0x00700249,
+    0x0400024a, 0x00000237, 0x1c000249, 0x1c000249, 0x00000248, 0x00000248, 0x00000248, 0x00000248,
+    0x00004529, 0x0000453a, 0x00000516, 0x0001852a, 0x0001c528, 0x0071c53a, 0x0001c539, 0x0001c54a,
+    0x0010053a, 0x00000527, 0x00700539, 0x0070054a, 0x00000538, 0x1c00054a, 0x00000549, 0x00000549,
+    0x00004329, 0x0000433a, 0x00000316, 0x0001832a, 0x0001c328, 0x0071c33a, 0x0001c339, 0x0001c34a,
+    0x0010033a, 0x00000327, 0x00700339, 0x0070034a, 0x00000338, 0x1c00034a, 0x00000349, 0x00000349,
+    0x0010463a, 0x00004627, 0x00704639, 0x0070464a, 0x00004638, 0x1c00464a, 0x00004649, 0x00004649,
+    0x00008629, 0x0000863a, 0x0001462a, 0x0000c62a, 0x00018628, 0x0071863a, 0x00018639, 0x0001864a,
+    0x0011c639, 0x0011c64a, 0x0001c626, 0x0061c63a, 0x0071c638, 0x1c71c64a, 0x0071c649, 0x0071c649,
+    0x0401c64a, 0x0001c637, 0x1c01c649, 0x1c01c649, 0x0001c648, 0x0001c648, 0x0001c648, 0x0001c648,
+    0x00100638, 0x1c10064a, 0x00100649, 0x00100649, 0x0020063a, 0x00000625, 0x00600639, 0x0060064a,
+    0x0470064a, 0x00700637, 0x1c700649, 0x1c700649, 0x00700648, 0x00700648, 0x00700648, 0x00700648,
+    0x04000649, 0x04000649, 0x00000636, 0x1800064a, 0x1c000648, 0x1c000648, 0x1c000648, 0x1c000648,
+    0x00000647, 0x00000647, 0x00000647, 0x00000647, 0x00000647, 0x00000647, 0x00000647, 0x00000647,
+    0x00104738, 0x1c10474a, 0x00104749, 0x00104749, 0x0020473a, 0x00004725, 0x00604739, 0x0060474a,
+    0x0470474a, 0x00704737, 0x1c704749, 0x1c704749, 0x00704748, 0x00704748, 0x00704748, 0x00704748,
+    0x04004749, 0x04004749, 0x00004736, 0x1800474a, 0x1c004748, 0x1c004748, 0x1c004748, 0x1c004748,
+    0x00004747, 0x00004747, 0x00004747, 0x00004747, 0x00004747, 0x00004747, 0x00004747, 0x00004747,
+    0x0010873a, 0x00008727, 0x00708739, 0x0070874a, 0x00008738, 0x1c00874a, 0x00008749, 0x00008749,
+    0x00014728, 0x0071473a, 0x00014739, 0x0001474a, 0x0000c728, 0x0070c73a, 0x0000c739, 0x0000c74a,
+    0x00118739, 0x0011874a, 0x00018726, 0x0061873a, 0x00718738, 0x1c71874a, 0x00718749, 0x00718749,
+    0x0401874a, 0x00018737, 0x1c018749, 0x1c018749, 0x00018748, 0x00018748, 0x00018748, 0x00018748,
+    0x0411c74a, 0x0011c737, 0x1c11c749, 0x1c11c749, 0x0011c748, 0x0011c748, 0x0011c748, 0x0011c748,
+    0x0021c739, 0x0021c74a, 0x0051c73a, 0x0031c73a, 0x0061c738, 0x1c61c74a, 0x0061c749, 0x0061c749,
+    0x0471c749, 0x0471c749, 0x0071c736, 0x1871c74a, 0x1c71c748, 0x1c71c748, 0x1c71c748, 0x1c71c748,
+    0x0071c747, 0x0071c747, 0x0071c747, 0x0071c747, 0x0071c747, 0x0071c747, 0x0071c747, 0x0071c747,
+    0x0401c748, 0x0401c748, 0x0401c748, 0x0401c748, 0x0801c74a, 0x0001c735, 0x1801c749, 0x1801c749,
+    0x1c01c747, 0x1c01c747, 0x1c01c747, 0x1c01c747, 0x1c01c747, 0x1c01c747, 0x1c01c747, 0x1c01c747,
+    0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746,
+    0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746, 0x0001c746,
+    0x04100749, 0x04100749, 0x00100736, 0x1810074a, 0x1c100748, 0x1c100748, 0x1c100748, 0x1c100748,
+    0x00100747, 0x00100747, 0x00100747, 0x00100747, 0x00100747, 0x00100747, 0x00100747, 0x00100747,
+    0x00200738, 0x1c20074a, 0x00200749, 0x00200749, 0x00500739, 0x0050074a, 0x00300739, 0x0030074a,
+    0x0460074a, 0x00600737, 0x1c600749, 0x1c600749, 0x00600748, 0x00600748, 0x00600748, 0x00600748,
+    0x04700748, 0x04700748, 0x04700748, 0x04700748, 0x0870074a, 0x00700735, 0x18700749, 0x18700749,
+    0x1c700747, 0x1c700747, 0x1c700747, 0x1c700747, 0x1c700747, 0x1c700747, 0x1c700747, 0x1c700747,
+    0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746,
+    0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746, 0x00700746,
+    0x04000747, 0x04000747, 0x04000747, 0x04000747, 0x04000747, 0x04000747, 0x04000747, 0x04000747,
+    0x08000749, 0x08000749, 0x1400074a, 0x0c00074a, 0x18000748, 0x18000748, 0x18000748, 0x18000748,
+    0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746,
+    0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746, 0x1c000746,
+    0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745,
+    0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745,
+    0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745,
+    0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745, 0x00000745,
+    0x0410404a, 0x00104037, 0x1c104049, 0x1c104049, 0x00104048, 0x00104048, 0x00104048, 0x00104048,
+    0x00204039, 0x0020404a, 0x0050403a, 0x0030403a, 0x00604038, 0x1c60404a, 0x00604049, 0x00604049,
+    0x04704049, 0x04704049, 0x00704036, 0x1870404a, 0x1c704048, 0x1c704048, 0x1c704048, 0x1c704048,
+    0x00704047, 0x00704047, 0x00704047, 0x00704047, 0x00704047, 0x00704047, 0x00704047, 0x00704047,
+    0x04004048, 0x04004048, 0x04004048, 0x04004048, 0x0800404a, 0x00004035, 0x18004049, 0x18004049,
+    0x1c004047, 0x1c004047, 0x1c004047, 0x1c004047, 0x1c004047, 0x1c004047, 0x1c004047, 0x1c004047,
+    0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046,
+    0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046,
+    0x00108039, 0x0010804a, 0x00008026, 0x0060803a, 0x00708038, 0x1c70804a, 0x00708049, 0x00708049,
+    0x0400804a, 0x00008037, 0x1c008049, 0x1c008049, 0x00008048, 0x00008048, 0x00008048, 0x00008048,
+    0x0011403a, 0x00014027, 0x00714039, 0x0071404a, 0x00014038, 0x1c01404a, 0x00014049, 0x00014049,
+    0x0010c03a, 0x0000c027, 0x0070c039, 0x0070c04a, 0x0000c038, 0x1c00c04a, 0x0000c049, 0x0000c049,
+    0x00118038, 0x1c11804a, 0x00118049, 0x00118049, 0x0021803a, 0x00018025, 0x00618039, 0x0061804a,
+    0x0471804a, 0x00718037, 0x1c718049, 0x1c718049, 0x00718048, 0x00718048, 0x00718048, 0x00718048,
+    0x04018049, 0x04018049, 0x00018036, 0x1801804a, 0x1c018048, 0x1c018048, 0x1c018048, 0x1c018048,
+    0x00018047, 0x00018047, 0x00018047, 0x00018047, 0x00018047, 0x00018047, 0x00018047, 0x00018047,
+    0x0411c049, 0x0411c049, 0x0011c036, 0x1811c04a, 0x1c11c048, 0x1c11c048, 0x1c11c048, 0x1c11c048,
+    0x0011c047, 0x0011c047, 0x0011c047, 0x0011c047, 0x0011c047, 0x0011c047, 0x0011c047, 0x0011c047,
+    0x0021c038, 0x1c21c04a, 0x0021c049, 0x0021c049, 0x0051c039, 0x0051c04a, 0x0031c039, 0x0031c04a,
+    0x0461c04a, 0x0061c037, 0x1c61c049, 0x1c61c049, 0x0061c048, 0x0061c048, 0x0061c048, 0x0061c048,
+    0x0471c048, 0x0471c048, 0x0471c048, 0x0471c048, 0x0871c04a, 0x0071c035, 0x1871c049, 0x1871c049,
+    0x1c71c047, 0x1c71c047, 0x1c71c047, 0x1c71c047, 0x1c71c047, 0x1c71c047, 0x1c71c047, 0x1c71c047,
+    0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046,
+    0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046, 0x0071c046,
+    0x0401c047, 0x0401c047, 0x0401c047, 0x0401c047, 0x0401c047, 0x0401c047, 0x0401c047, 0x0401c047,
+    0x0801c049, 0x0801c049, 0x1401c04a, 0x0c01c04a, 0x1801c048, 0x1801c048, 0x1801c048, 0x1801c048,
+    0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046,
+    0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046, 0x1c01c046,
+    0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045,
+    0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045,
+    0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045,
+    0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045, 0x0001c045,
+    0x04100048, 0x04100048, 0x04100048, 0x04100048, 0x0810004a, 0x00100035, 0x18100049, 0x18100049,
+    0x1c100047, 0x1c100047, 0x1c100047, 0x1c100047, 0x1c100047, 0x1c100047, 0x1c100047, 0x1c100047,
+    0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046,
+    0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046,
+    0x0420004a, 0x00200037, 0x1c200049, 0x1c200049, 0x00200048, 0x00200048, 0x00200048, 0x00200048,
+    0x00500038, 0x1c50004a, 0x00500049, 0x00500049, 0x00300038, 0x1c30004a, 0x00300049, 0x00300049,
+    0x04600049, 0x04600049, 0x00600036, 0x1860004a, 0x1c600048, 0x1c600048, 0x1c600048, 0x1c600048,
+    0x00600047, 0x00600047, 0x00600047, 0x00600047, 0x00600047, 0x00600047, 0x00600047, 0x00600047,
+    0x04700047, 0x04700047, 0x04700047, 0x04700047, 0x04700047, 0x04700047, 0x04700047, 0x04700047,
+    0x08700049, 0x08700049, 0x1470004a, 0x0c70004a, 0x18700048, 0x18700048, 0x18700048, 0x18700048,
+    0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046,
+    0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046, 0x1c700046,
+    0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045,
+    0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045,
+    0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045,
+    0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045, 0x00700045,
+    0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046,
+    0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046,
+    0x08000048, 0x08000048, 0x08000048, 0x08000048, 0x14000049, 0x14000049, 0x0c000049, 0x0c000049,
+    0x18000047, 0x18000047, 0x18000047, 0x18000047, 0x18000047, 0x18000047, 0x18000047, 0x18000047,
+    0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045,
+    0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045,
+    0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045,
+    0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045, 0x1c000045,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+};
+
+static const UINT32 sa_hc_sf1_blen4_mdec_ldac[1024] = {
+    0x00f3cf39, 0x00f3cf4a, 0x0013cf39, 0x0013cf4a, 0x0023cf3a, 0x0003cf26, 0x00e3cf3a, 0x0003cf26,
+    0x3c03cf4a, 0x0403cf4a, 0x0003cf37, 0x0003cf37, 0x0003cf48, 0x0003cf48, 0x0003cf48, 0x0003cf48,
+    0x00f04f39, 0x00f04f4a, 0x00104f39, 0x00104f4a, 0x00204f3a, 0x00004f26, 0x00e04f3a, 0x00004f26,
+    0x3c004f4a, 0x04004f4a, 0x00004f37, 0x00004f37, 0x00004f48, 0x00004f48, 0x00004f48, 0x00004f48,
+    0x00f08f3a, 0x00108f3a, 0x00008f27, 0x00008f27, 0x00008f38, 0x00008f38, 0x00008f49, 0x00008f49,
+    0x00034f29, 0x00034f3a, 0x00030f29, 0x00030f3a, 0x00014f2a, 0x00000f13, 0x00000f13, 0x0002cf2a,
+    0x00f38f3a, 0x00138f3a, 0x00038f27, 0x00038f27, 0x00038f38, 0x00038f38, 0x00038f49, 0x00038f49,
+    0x0000cf28, 0x0000cf28, 0x0000cf39, 0x0000cf4a, 0x00010f28, 0x00010f28, 0x00010f39, 0x00010f4a,
+    0x3cf00f4a, 0x04f00f4a, 0x00f00f37, 0x00f00f37, 0x00f00f48, 0x00f00f48, 0x00f00f48, 0x00f00f48,
+    0x3c100f4a, 0x04100f4a, 0x00100f37, 0x00100f37, 0x00100f48, 0x00100f48, 0x00100f48, 0x00100f48,
+    0x00200f38, 0x00200f38, 0x00200f49, 0x00200f49, 0x00d00f3a, 0x00c00f3a, 0x00000f24, 0x00000f24,
+    0x00e00f38, 0x00e00f38, 0x00e00f49, 0x00e00f49, 0x00300f39, 0x00300f4a, 0x00400f39, 0x00400f4a,
+    0x3c000f48, 0x3c000f48, 0x3c000f48, 0x3c000f48, 0x04000f48, 0x04000f48, 0x04000f48, 0x04000f48,
+    0x08000f49, 0x08000f49, 0x00000f35, 0x00000f35, 0x38000f49, 0x38000f49, 0x0c000f4a, 0x10000f4a,
+    0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46,
+    0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46, 0x00000f46,
+    0x00f3c139, 0x00f3c14a, 0x0013c139, 0x0013c14a, 0x0023c13a, 0x0003c126, 0x00e3c13a, 0x0003c126,
+    0x3c03c14a, 0x0403c14a, 0x0003c137, 0x0003c137, 0x0003c148, 0x0003c148, 0x0003c148, 0x0003c148,
+    0x00f04139, 0x00f0414a, 0x00104139, 0x0010414a, 0x0020413a, 0x00004126, 0x00e0413a, 0x00004126,
+    0x3c00414a, 0x0400414a, 0x00004137, 0x00004137, 0x00004148, 0x00004148, 0x00004148, 0x00004148,
+    0x00f0813a, 0x0010813a, 0x00008127, 0x00008127, 0x00008138, 0x00008138, 0x00008149, 0x00008149,
+    0x00034129, 0x0003413a, 0x00030129, 0x0003013a, 0x0001412a, 0x00000113, 0x00000113, 0x0002c12a,
+    0x00f3813a, 0x0013813a, 0x00038127, 0x00038127, 0x00038138, 0x00038138, 0x00038149, 0x00038149,
+    0x0000c128, 0x0000c128, 0x0000c139, 0x0000c14a, 0x00010128, 0x00010128, 0x00010139, 0x0001014a,
+    0x3cf0014a, 0x04f0014a, 0x00f00137, 0x00f00137, 0x00f00148, 0x00f00148, 0x00f00148, 0x00f00148,
+    0x3c10014a, 0x0410014a, 0x00100137, 0x00100137, 0x00100148, 0x00100148, 0x00100148, 0x00100148,
+    0x00200138, 0x00200138, 0x00200149, 0x00200149, 0x00d0013a, 0x00c0013a, 0x00000124, 0x00000124,
+    0x00e00138, 0x00e00138, 0x00e00149, 0x00e00149, 0x00300139, 0x0030014a, 0x00400139, 0x0040014a,
+    0x3c000148, 0x3c000148, 0x3c000148, 0x3c000148, 0x04000148, 0x04000148, 0x04000148, 0x04000148,
+    0x08000149, 0x08000149, 0x00000135, 0x00000135, 0x38000149, 0x38000149, 0x0c00014a, 0x1000014a,
+    0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146,
+    0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146, 0x00000146,
+    0x00f3c23a, 0x0013c23a, 0x0003c227, 0x0003c227, 0x0003c238, 0x0003c238, 0x0003c249, 0x0003c249,
+    0x00f0423a, 0x0010423a, 0x00004227, 0x00004227, 0x00004238, 0x00004238, 0x00004249, 0x00004249,
+    0x00008228, 0x00008228, 0x00008239, 0x0000824a, 0x0003422a, 0x0003022a, 0x00000214, 0x00000214,
+    0x00038228, 0x00038228, 0x00038239, 0x0003824a, 0x0000c229, 0x0000c23a, 0x00010229, 0x0001023a,
+    0x00f00238, 0x00f00238, 0x00f00249, 0x00f00249, 0x00100238, 0x00100238, 0x00100249, 0x00100249,
+    0x00200239, 0x0020024a, 0x00000225, 0x00000225, 0x00e00239, 0x00e0024a, 0x0030023a, 0x0040023a,
+    0x3c000249, 0x3c000249, 0x04000249, 0x04000249, 0x0800024a, 0x00000236, 0x3800024a, 0x00000236,
+    0x00000247, 0x00000247, 0x00000247, 0x00000247, 0x00000247, 0x00000247, 0x00000247, 0x00000247,
+    0x0003cd29, 0x0003cd3a, 0x00004d29, 0x00004d3a, 0x00008d2a, 0x00000d16, 0x00038d2a, 0x00000d16,
+    0x00f00d3a, 0x00100d3a, 0x00000d27, 0x00000d27, 0x00000d38, 0x00000d38, 0x00000d49, 0x00000d49,
+    0x0003cc29, 0x0003cc3a, 0x00004c29, 0x00004c3a, 0x00008c2a, 0x00000c16, 0x00038c2a, 0x00000c16,
+    0x00f00c3a, 0x00100c3a, 0x00000c27, 0x00000c27, 0x00000c38, 0x00000c38, 0x00000c49, 0x00000c49,
+    0x0003c52a, 0x0000452a, 0x00000517, 0x00000517, 0x00000528, 0x00000528, 0x00000539, 0x0000054a,
+    0x00000618, 0x00000618, 0x00000629, 0x0000063a, 0x00000a18, 0x00000a18, 0x00000a29, 0x00000a3a,
+    0x00000918, 0x00000918, 0x00000929, 0x0000093a, 0x00000718, 0x00000718, 0x00000729, 0x0000073a,
+    0x0003cb2a, 0x00004b2a, 0x00000b17, 0x00000b17, 0x00000b28, 0x00000b28, 0x00000b39, 0x00000b4a,
+    0x00f3ce3a, 0x0013ce3a, 0x0003ce27, 0x0003ce27, 0x0003ce38, 0x0003ce38, 0x0003ce49, 0x0003ce49,
+    0x00f04e3a, 0x00104e3a, 0x00004e27, 0x00004e27, 0x00004e38, 0x00004e38, 0x00004e49, 0x00004e49,
+    0x00008e28, 0x00008e28, 0x00008e39, 0x00008e4a, 0x00034e2a, 0x00030e2a, 0x00000e14, 0x00000e14,
+    0x00038e28, 0x00038e28, 0x00038e39, 0x00038e4a, 0x0000ce29, 0x0000ce3a, 0x00010e29, 0x00010e3a,
+    0x00f00e38, 0x00f00e38, 0x00f00e49, 0x00f00e49, 0x00100e38, 0x00100e38, 0x00100e49, 0x00100e49,
+    0x00200e39, 0x00200e4a, 0x00000e25, 0x00000e25, 0x00e00e39, 0x00e00e4a, 0x00300e3a, 0x00400e3a,
+    0x3c000e49, 0x3c000e49, 0x04000e49, 0x04000e49, 0x08000e4a, 0x00000e36, 0x38000e4a, 0x00000e36,
+    0x00000e47, 0x00000e47, 0x00000e47, 0x00000e47, 0x00000e47, 0x00000e47, 0x00000e47, 0x00000e47,
+    0x0003c328, 0x0003c328, 0x0003c339, 0x0003c34a, 0x00004328, 0x00004328, 0x00004339, 0x0000434a,
+    0x00008329, 0x0000833a, 0x00000315, 0x00000315, 0x00038329, 0x0003833a, 0x0000c32a, 0x0001032a,
+    0x00f00339, 0x00f0034a, 0x00100339, 0x0010034a, 0x0020033a, 0x00000326, 0x00e0033a, 0x00000326,
+    0x3c00034a, 0x0400034a, 0x00000337, 0x00000337, 0x00000348, 0x00000348, 0x00000348, 0x00000348,
+    0x0003c428, 0x0003c428, 0x0003c439, 0x0003c44a, 0x00004428, 0x00004428, 0x00004439, 0x0000444a,
+    0x00008429, 0x0000843a, 0x00000415, 0x00000415, 0x00038429, 0x0003843a, 0x0000c42a, 0x0001042a,
+    0x00f00439, 0x00f0044a, 0x00100439, 0x0010044a, 0x0020043a, 0x00000426, 0x00e0043a, 0x00000426,
+    0x3c00044a, 0x0400044a, 0x00000437, 0x00000437, 0x00000448, 0x00000448, 0x00000448, 0x00000448,
+    0x3cf3c04a, 0x04f3c04a, 0x00f3c037, 0x00f3c037, 0x00f3c048, 0x00f3c048, 0x00f3c048, 0x00f3c048,
+    0x3c13c04a, 0x0413c04a, 0x0013c037, 0x0013c037, 0x0013c048, 0x0013c048, 0x0013c048, 0x0013c048,
+    0x0023c038, 0x0023c038, 0x0023c049, 0x0023c049, 0x00d3c03a, 0x00c3c03a, 0x0003c024, 0x0003c024,
+    0x00e3c038, 0x00e3c038, 0x00e3c049, 0x00e3c049, 0x0033c039, 0x0033c04a, 0x0043c039, 0x0043c04a,
+    0x3c03c048, 0x3c03c048, 0x3c03c048, 0x3c03c048, 0x0403c048, 0x0403c048, 0x0403c048, 0x0403c048,
+    0x0803c049, 0x0803c049, 0x0003c035, 0x0003c035, 0x3803c049, 0x3803c049, 0x0c03c04a, 0x1003c04a,
+    0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046,
+    0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046, 0x0003c046,
+    0x3cf0404a, 0x04f0404a, 0x00f04037, 0x00f04037, 0x00f04048, 0x00f04048, 0x00f04048, 0x00f04048,
+    0x3c10404a, 0x0410404a, 0x00104037, 0x00104037, 0x00104048, 0x00104048, 0x00104048, 0x00104048,
+    0x00204038, 0x00204038, 0x00204049, 0x00204049, 0x00d0403a, 0x00c0403a, 0x00004024, 0x00004024,
+    0x00e04038, 0x00e04038, 0x00e04049, 0x00e04049, 0x00304039, 0x0030404a, 0x00404039, 0x0040404a,
+    0x3c004048, 0x3c004048, 0x3c004048, 0x3c004048, 0x04004048, 0x04004048, 0x04004048, 0x04004048,
+    0x08004049, 0x08004049, 0x00004035, 0x00004035, 0x38004049, 0x38004049, 0x0c00404a, 0x1000404a,
+    0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046,
+    0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046, 0x00004046,
+    0x00f08038, 0x00f08038, 0x00f08049, 0x00f08049, 0x00108038, 0x00108038, 0x00108049, 0x00108049,
+    0x00208039, 0x0020804a, 0x00008025, 0x00008025, 0x00e08039, 0x00e0804a, 0x0030803a, 0x0040803a,
+    0x3c008049, 0x3c008049, 0x04008049, 0x04008049, 0x0800804a, 0x00008036, 0x3800804a, 0x00008036,
+    0x00008047, 0x00008047, 0x00008047, 0x00008047, 0x00008047, 0x00008047, 0x00008047, 0x00008047,
+    0x00f3403a, 0x0013403a, 0x00034027, 0x00034027, 0x00034038, 0x00034038, 0x00034049, 0x00034049,
+    0x00f3003a, 0x0013003a, 0x00030027, 0x00030027, 0x00030038, 0x00030038, 0x00030049, 0x00030049,
+    0x00014028, 0x00014028, 0x00014039, 0x0001404a, 0x00018029, 0x0001803a, 0x00028029, 0x0002803a,
+    0x00024029, 0x0002403a, 0x0001c029, 0x0001c03a, 0x0002c028, 0x0002c028, 0x0002c039, 0x0002c04a,
+    0x00f38038, 0x00f38038, 0x00f38049, 0x00f38049, 0x00138038, 0x00138038, 0x00138049, 0x00138049,
+    0x00238039, 0x0023804a, 0x00038025, 0x00038025, 0x00e38039, 0x00e3804a, 0x0033803a, 0x0043803a,
+    0x3c038049, 0x3c038049, 0x04038049, 0x04038049, 0x0803804a, 0x00038036, 0x3803804a, 0x00038036,
+    0x00038047, 0x00038047, 0x00038047, 0x00038047, 0x00038047, 0x00038047, 0x00038047, 0x00038047,
+    0x00f0c039, 0x00f0c04a, 0x0010c039, 0x0010c04a, 0x0020c03a, 0x0000c026, 0x00e0c03a, 0x0000c026,
+    0x3c00c04a, 0x0400c04a, 0x0000c037, 0x0000c037, 0x0000c048, 0x0000c048, 0x0000c048, 0x0000c048,
+    0x00f10039, 0x00f1004a, 0x00110039, 0x0011004a, 0x0021003a, 0x00010026, 0x00e1003a, 0x00010026,
+    0x3c01004a, 0x0401004a, 0x00010037, 0x00010037, 0x00010048, 0x00010048, 0x00010048, 0x00010048,
+    0x3cf00048, 0x3cf00048, 0x3cf00048, 0x3cf00048, 0x04f00048, 0x04f00048, 0x04f00048, 0x04f00048,
+    0x08f00049, 0x08f00049, 0x00f00035, 0x00f00035, 0x38f00049, 0x38f00049, 0x0cf0004a, 0x10f0004a,
+    0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046,
+    0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046, 0x00f00046,
+    0x3c100048, 0x3c100048, 0x3c100048, 0x3c100048, 0x04100048, 0x04100048, 0x04100048, 0x04100048,
+    0x08100049, 0x08100049, 0x00100035, 0x00100035, 0x38100049, 0x38100049, 0x0c10004a, 0x1010004a,
+    0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046,
+    0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046, 0x00100046,
+    0x3c200049, 0x3c200049, 0x04200049, 0x04200049, 0x0820004a, 0x00200036, 0x3820004a, 0x00200036,
+    0x00200047, 0x00200047, 0x00200047, 0x00200047, 0x00200047, 0x00200047, 0x00200047, 0x00200047,
+    0x00d00038, 0x00d00038, 0x00d00049, 0x00d00049, 0x00c00038, 0x00c00038, 0x00c00049, 0x00c00049,
+    0x00500039, 0x0050004a, 0x0060003a, 0x00a0003a, 0x0090003a, 0x0070003a, 0x00b00039, 0x00b0004a,
+    0x3ce00049, 0x3ce00049, 0x04e00049, 0x04e00049, 0x08e0004a, 0x00e00036, 0x38e0004a, 0x00e00036,
+    0x00e00047, 0x00e00047, 0x00e00047, 0x00e00047, 0x00e00047, 0x00e00047, 0x00e00047, 0x00e00047,
+    0x3c30004a, 0x0430004a, 0x00300037, 0x00300037, 0x00300048, 0x00300048, 0x00300048, 0x00300048,
+    0x3c40004a, 0x0440004a, 0x00400037, 0x00400037, 0x00400048, 0x00400048, 0x00400048, 0x00400048,
+    0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046,
+    0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046, 0x3c000046,
+    0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046,
+    0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046, 0x04000046,
+    0x08000047, 0x08000047, 0x08000047, 0x08000047, 0x08000047, 0x08000047, 0x08000047, 0x08000047,
+    0x34000049, 0x34000049, 0x30000049, 0x30000049, 0x1400004a, 0x00000033, 0x00000033, 0x2c00004a,
+    0x38000047, 0x38000047, 0x38000047, 0x38000047, 0x38000047, 0x38000047, 0x38000047, 0x38000047,
+    0x0c000048, 0x0c000048, 0x0c000048, 0x0c000048, 0x10000048, 0x10000048, 0x10000048, 0x10000048,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+    0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+};
+
+static const UINT32 sa_hc_sf1_blen5_mdec_ldac[1024] = {
+    0x00000039, 0x00000039, 0x0050003a, 0x0060003a, 0x0040003a, 0x0070003a, 0x00000026, 0x0020003a,
+    0x00000026, 0x0080003a, 0x00100039, 0x00100039, 0x0030003a, 0x00000026, 0x01f00039, 0x01f00039,
+    0x0001403a, 0x00014027, 0x00014027, 0x00014027, 0x00014027, 0x0011403a, 0x00014027, 0x01f1403a,
+    0x0001803a, 0x00018027, 0x00018027, 0x00018027, 0x00018027, 0x0011803a, 0x00018027, 0x01f1803a,
+    0x0001003a, 0x00010027, 0x00010027, 0x00010027, 0x00010027, 0x0011003a, 0x00010027, 0x01f1003a,
+    0x0001c03a, 0x0001c027, 0x0001c027, 0x0001c027, 0x0001c027, 0x0011c03a, 0x0001c027, 0x01f1c03a,
+    0x00000013, 0x00000013, 0x00000013, 0x0002c02a, 0x00078029, 0x00078029, 0x0003002a, 0x0007402a,
+    0x0000803a, 0x00008027, 0x00008027, 0x00008027, 0x00008027, 0x0010803a, 0x00008027, 0x01f0803a,
+    0x00024028, 0x00024028, 0x00024028, 0x00024028, 0x0007002a, 0x0006c02a, 0x00028029, 0x00028029,
+    0x0002003a, 0x00020027, 0x00020027, 0x00020027, 0x00020027, 0x0012003a, 0x00020027, 0x01f2003a,
+    0x00004039, 0x00004039, 0x0050403a, 0x0060403a, 0x0040403a, 0x0070403a, 0x00004026, 0x0020403a,
+    0x00004026, 0x0080403a, 0x00104039, 0x00104039, 0x0030403a, 0x00004026, 0x01f04039, 0x01f04039,
+    0x0000c03a, 0x0000c027, 0x0000c027, 0x0000c027, 0x0000c027, 0x0010c03a, 0x0000c027, 0x01f0c03a,
+    0x0006402a, 0x0006802a, 0x0006002a, 0x0005c02a, 0x0005802a, 0x0005402a, 0x0003402a, 0x0005002a,
+    0x0007c039, 0x0007c039, 0x0057c03a, 0x0067c03a, 0x0047c03a, 0x0077c03a, 0x0007c026, 0x0027c03a,
+    0x0007c026, 0x0087c03a, 0x0017c039, 0x0017c039, 0x0037c03a, 0x0007c026, 0x01f7c039, 0x01f7c039,
+    0x0000053a, 0x00000527, 0x00000527, 0x00000527, 0x00000527, 0x0010053a, 0x00000527, 0x01f0053a,
+    0x00014528, 0x00014528, 0x00014528, 0x00014528, 0x00018528, 0x00018528, 0x00018528, 0x00018528,
+    0x00010528, 0x00010528, 0x00010528, 0x00010528, 0x0001c528, 0x0001c528, 0x0001c528, 0x0001c528,
+    0x00000514, 0x00000514, 0x0007852a, 0x00000514, 0x00008528, 0x00008528, 0x00008528, 0x00008528,
+    0x00024529, 0x00024529, 0x00000514, 0x0002852a, 0x00020528, 0x00020528, 0x00020528, 0x00020528,
+    0x0000453a, 0x00004527, 0x00004527, 0x00004527, 0x00004527, 0x0010453a, 0x00004527, 0x01f0453a,
+    0x0000c528, 0x0000c528, 0x0000c528, 0x0000c528, 0x00000514, 0x00000514, 0x00000514, 0x00000514,
+    0x0007c53a, 0x0007c527, 0x0007c527, 0x0007c527, 0x0007c527, 0x0017c53a, 0x0007c527, 0x01f7c53a,
+    0x0000063a, 0x00000627, 0x00000627, 0x00000627, 0x00000627, 0x0010063a, 0x00000627, 0x01f0063a,
+    0x00014628, 0x00014628, 0x00014628, 0x00014628, 0x00018628, 0x00018628, 0x00018628, 0x00018628,
+    0x00010628, 0x00010628, 0x00010628, 0x00010628, 0x0001c628, 0x0001c628, 0x0001c628, 0x0001c628,
+    0x00000614, 0x00000614, 0x0007862a, 0x00000614, 0x00008628, 0x00008628, 0x00008628, 0x00008628,
+    0x00024629, 0x00024629, 0x00000614, 0x0002862a, 0x00020628, 0x00020628, 0x00020628, 0x00020628,
+    0x0000463a, 0x00004627, 0x00004627, 0x00004627, 0x00004627, 0x0010463a, 0x00004627, 0x01f0463a,
+    0x0000c628, 0x0000c628, 0x0000c628, 0x0000c628, 0x00000614, 0x00000614, 0x00000614, 0x00000614,
+    0x0007c63a, 0x0007c627, 0x0007c627, 0x0007c627, 0x0007c627, 0x0017c63a, 0x0007c627, 0x01f7c63a,
+    0x0000043a, 0x00000427, 0x00000427, 0x00000427, 0x00000427, 0x0010043a, 0x00000427, 0x01f0043a,
+    0x00014428, 0x00014428, 0x00014428, 0x00014428, 0x00018428, 0x00018428, 0x00018428, 0x00018428,
+    0x00010428, 0x00010428, 0x00010428, 0x00010428, 0x0001c428, 0x0001c428, 0x0001c428, 0x0001c428,
+    0x00000414, 0x00000414, 0x0007842a, 0x00000414, 0x00008428, 0x00008428, 0x00008428, 0x00008428,
+    0x00024429, 0x00024429, 0x00000414, 0x0002842a, 0x00020428, 0x00020428, 0x00020428, 0x00020428,
+    0x0000443a, 0x00004427, 0x00004427, 0x00004427, 0x00004427, 0x0010443a, 0x00004427, 0x01f0443a,
+    0x0000c428, 0x0000c428, 0x0000c428, 0x0000c428, 0x00000414, 0x00000414, 0x00000414, 0x00000414,
+    0x0007c43a, 0x0007c427, 0x0007c427, 0x0007c427, 0x0007c427, 0x0017c43a, 0x0007c427, 0x01f7c43a,
+    0x0000073a, 0x00000727, 0x00000727, 0x00000727, 0x00000727, 0x0010073a, 0x00000727, 0x01f0073a,
+    0x00014728, 0x00014728, 0x00014728, 0x00014728, 0x00018728, 0x00018728, 0x00018728, 0x00018728,
+    0x00010728, 0x00010728, 0x00010728, 0x00010728, 0x0001c728, 0x0001c728, 0x0001c728, 0x0001c728,
+    0x00000714, 0x00000714, 0x0007872a, 0x00000714, 0x00008728, 0x00008728, 0x00008728, 0x00008728,
+    0x00024729, 0x00024729, 0x00000714, 0x0002872a, 0x00020728, 0x00020728, 0x00020728, 0x00020728,
+    0x0000473a, 0x00004727, 0x00004727, 0x00004727, 0x00004727, 0x0010473a, 0x00004727, 0x01f0473a,
+    0x0000c728, 0x0000c728, 0x0000c728, 0x0000c728, 0x00000714, 0x00000714, 0x00000714, 0x00000714,
+    0x0007c73a, 0x0007c727, 0x0007c727, 0x0007c727, 0x0007c727, 0x0017c73a, 0x0007c727, 0x01f7c73a,
+    0x00000e18, 0x00000e18, 0x00000e18, 0x00000e18, 0x00001118, 0x00001118, 0x00001118, 0x00001118,
+    0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001218, 0x00001218, 0x00001218, 0x00001218,
+    0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00000f18, 0x00000f18, 0x00000f18, 0x00000f18,
+    0x00000b2a, 0x00000b17, 0x00000b17, 0x00000b17, 0x00000b17, 0x00004b2a, 0x00000b17, 0x0007cb2a,
+    0x00001e29, 0x00001e29, 0x00015e2a, 0x00019e2a, 0x00011e2a, 0x0001de2a, 0x00001e16, 0x00009e2a,
+    0x00001e16, 0x00021e2a, 0x00005e29, 0x00005e29, 0x0000de2a, 0x00001e16, 0x0007de29, 0x0007de29,
+    0x00000c2a, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00004c2a, 0x00000c17, 0x0007cc2a,
+    0x00001d2a, 0x00001d17, 0x00001d17, 0x00001d17, 0x00001d17, 0x00005d2a, 0x00001d17, 0x0007dd2a,
+    0x0000023a, 0x00000227, 0x00000227, 0x00000227, 0x00000227, 0x0010023a, 0x00000227, 0x01f0023a,
+    0x00014228, 0x00014228, 0x00014228, 0x00014228, 0x00018228, 0x00018228, 0x00018228, 0x00018228,
+    0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x0001c228, 0x0001c228, 0x0001c228, 0x0001c228,
+    0x00000214, 0x00000214, 0x0007822a, 0x00000214, 0x00008228, 0x00008228, 0x00008228, 0x00008228,
+    0x00024229, 0x00024229, 0x00000214, 0x0002822a, 0x00020228, 0x00020228, 0x00020228, 0x00020228,
+    0x0000423a, 0x00004227, 0x00004227, 0x00004227, 0x00004227, 0x0010423a, 0x00004227, 0x01f0423a,
+    0x0000c228, 0x0000c228, 0x0000c228, 0x0000c228, 0x00000214, 0x00000214, 0x00000214, 0x00000214,
+    0x0007c23a, 0x0007c227, 0x0007c227, 0x0007c227, 0x0007c227, 0x0017c23a, 0x0007c227, 0x01f7c23a,
+    0x00000928, 0x00000928, 0x00000928, 0x00000928, 0x00014929, 0x00014929, 0x00018929, 0x00018929,
+    0x00010929, 0x00010929, 0x0001c929, 0x0001c929, 0x00000915, 0x00000915, 0x00008929, 0x00008929,
+    0x0002492a, 0x00000915, 0x00020929, 0x00020929, 0x00004928, 0x00004928, 0x00004928, 0x00004928,
+    0x0000c929, 0x0000c929, 0x00000915, 0x00000915, 0x0007c928, 0x0007c928, 0x0007c928, 0x0007c928,
+    0x00001c2a, 0x00001c17, 0x00001c17, 0x00001c17, 0x00001c17, 0x00005c2a, 0x00001c17, 0x0007dc2a,
+    0x00001b2a, 0x00001b17, 0x00001b17, 0x00001b17, 0x00001b17, 0x00005b2a, 0x00001b17, 0x0007db2a,
+    0x00000a29, 0x00000a29, 0x00014a2a, 0x00018a2a, 0x00010a2a, 0x0001ca2a, 0x00000a16, 0x00008a2a,
+    0x00000a16, 0x00020a2a, 0x00004a29, 0x00004a29, 0x0000ca2a, 0x00000a16, 0x0007ca29, 0x0007ca29,
+    0x0000083a, 0x00000827, 0x00000827, 0x00000827, 0x00000827, 0x0010083a, 0x00000827, 0x01f0083a,
+    0x00014828, 0x00014828, 0x00014828, 0x00014828, 0x00018828, 0x00018828, 0x00018828, 0x00018828,
+    0x00010828, 0x00010828, 0x00010828, 0x00010828, 0x0001c828, 0x0001c828, 0x0001c828, 0x0001c828,
+    0x00000814, 0x00000814, 0x0007882a, 0x00000814, 0x00008828, 0x00008828, 0x00008828, 0x00008828,
+    0x00024829, 0x00024829, 0x00000814, 0x0002882a, 0x00020828, 0x00020828, 0x00020828, 0x00020828,
+    0x0000483a, 0x00004827, 0x00004827, 0x00004827, 0x00004827, 0x0010483a, 0x00004827, 0x01f0483a,
+    0x0000c828, 0x0000c828, 0x0000c828, 0x0000c828, 0x00000814, 0x00000814, 0x00000814, 0x00000814,
+    0x0007c83a, 0x0007c827, 0x0007c827, 0x0007c827, 0x0007c827, 0x0017c83a, 0x0007c827, 0x01f7c83a,
+    0x00000139, 0x00000139, 0x0050013a, 0x0060013a, 0x0040013a, 0x0070013a, 0x00000126, 0x0020013a,
+    0x00000126, 0x0080013a, 0x00100139, 0x00100139, 0x0030013a, 0x00000126, 0x01f00139, 0x01f00139,
+    0x0001413a, 0x00014127, 0x00014127, 0x00014127, 0x00014127, 0x0011413a, 0x00014127, 0x01f1413a,
+    0x0001813a, 0x00018127, 0x00018127, 0x00018127, 0x00018127, 0x0011813a, 0x00018127, 0x01f1813a,
+    0x0001013a, 0x00010127, 0x00010127, 0x00010127, 0x00010127, 0x0011013a, 0x00010127, 0x01f1013a,
+    0x0001c13a, 0x0001c127, 0x0001c127, 0x0001c127, 0x0001c127, 0x0011c13a, 0x0001c127, 0x01f1c13a,
+    0x00000113, 0x00000113, 0x00000113, 0x0002c12a, 0x00078129, 0x00078129, 0x0003012a, 0x0007412a,
+    0x0000813a, 0x00008127, 0x00008127, 0x00008127, 0x00008127, 0x0010813a, 0x00008127, 0x01f0813a,
+    0x00024128, 0x00024128, 0x00024128, 0x00024128, 0x0007012a, 0x0006c12a, 0x00028129, 0x00028129,
+    0x0002013a, 0x00020127, 0x00020127, 0x00020127, 0x00020127, 0x0012013a, 0x00020127, 0x01f2013a,
+    0x00004139, 0x00004139, 0x0050413a, 0x0060413a, 0x0040413a, 0x0070413a, 0x00004126, 0x0020413a,
+    0x00004126, 0x0080413a, 0x00104139, 0x00104139, 0x0030413a, 0x00004126, 0x01f04139, 0x01f04139,
+    0x0000c13a, 0x0000c127, 0x0000c127, 0x0000c127, 0x0000c127, 0x0010c13a, 0x0000c127, 0x01f0c13a,
+    0x0006412a, 0x0006812a, 0x0006012a, 0x0005c12a, 0x0005812a, 0x0005412a, 0x0003412a, 0x0005012a,
+    0x0007c139, 0x0007c139, 0x0057c13a, 0x0067c13a, 0x0047c13a, 0x0077c13a, 0x0007c126, 0x0027c13a,
+    0x0007c126, 0x0087c13a, 0x0017c139, 0x0017c139, 0x0037c13a, 0x0007c126, 0x01f7c139, 0x01f7c139,
+    0x0000033a, 0x00000327, 0x00000327, 0x00000327, 0x00000327, 0x0010033a, 0x00000327, 0x01f0033a,
+    0x00014328, 0x00014328, 0x00014328, 0x00014328, 0x00018328, 0x00018328, 0x00018328, 0x00018328,
+    0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x0001c328, 0x0001c328, 0x0001c328, 0x0001c328,
+    0x00000314, 0x00000314, 0x0007832a, 0x00000314, 0x00008328, 0x00008328, 0x00008328, 0x00008328,
+    0x00024329, 0x00024329, 0x00000314, 0x0002832a, 0x00020328, 0x00020328, 0x00020328, 0x00020328,
+    0x0000433a, 0x00004327, 0x00004327, 0x00004327, 0x00004327, 0x0010433a, 0x00004327, 0x01f0433a,
+    0x0000c328, 0x0000c328, 0x0000c328, 0x0000c328, 0x00000314, 0x00000314, 0x00000314, 0x00000314,
+    0x0007c33a, 0x0007c327, 0x0007c327, 0x0007c327, 0x0007c327, 0x0017c33a, 0x0007c327, 0x01f7c33a,
+    0x0000192a, 0x00001917, 0x00001917, 0x00001917, 0x00001917, 0x0000592a, 0x00001917, 0x0007d92a,
+    0x00001a2a, 0x00001a17, 0x00001a17, 0x00001a17, 0x00001a17, 0x00005a2a, 0x00001a17, 0x0007da2a,
+    0x0000182a, 0x00001817, 0x00001817, 0x00001817, 0x00001817, 0x0000582a, 0x00001817, 0x0007d82a,
+    0x0000172a, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x0000572a, 0x00001717, 0x0007d72a,
+    0x0000162a, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x0000562a, 0x00001617, 0x0007d62a,
+    0x0000152a, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x0000552a, 0x00001517, 0x0007d52a,
+    0x00000d2a, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00004d2a, 0x00000d17, 0x0007cd2a,
+    0x0000142a, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x0000542a, 0x00001417, 0x0007d42a,
+    0x00001f39, 0x00001f39, 0x00501f3a, 0x00601f3a, 0x00401f3a, 0x00701f3a, 0x00001f26, 0x00201f3a,
+    0x00001f26, 0x00801f3a, 0x00101f39, 0x00101f39, 0x00301f3a, 0x00001f26, 0x01f01f39, 0x01f01f39,
+    0x00015f3a, 0x00015f27, 0x00015f27, 0x00015f27, 0x00015f27, 0x00115f3a, 0x00015f27, 0x01f15f3a,
+    0x00019f3a, 0x00019f27, 0x00019f27, 0x00019f27, 0x00019f27, 0x00119f3a, 0x00019f27, 0x01f19f3a,
+    0x00011f3a, 0x00011f27, 0x00011f27, 0x00011f27, 0x00011f27, 0x00111f3a, 0x00011f27, 0x01f11f3a,
+    0x0001df3a, 0x0001df27, 0x0001df27, 0x0001df27, 0x0001df27, 0x0011df3a, 0x0001df27, 0x01f1df3a,
+    0x00001f13, 0x00001f13, 0x00001f13, 0x0002df2a, 0x00079f29, 0x00079f29, 0x00031f2a, 0x00075f2a,
+    0x00009f3a, 0x00009f27, 0x00009f27, 0x00009f27, 0x00009f27, 0x00109f3a, 0x00009f27, 0x01f09f3a,
+    0x00025f28, 0x00025f28, 0x00025f28, 0x00025f28, 0x00071f2a, 0x0006df2a, 0x00029f29, 0x00029f29,
+    0x00021f3a, 0x00021f27, 0x00021f27, 0x00021f27, 0x00021f27, 0x00121f3a, 0x00021f27, 0x01f21f3a,
+    0x00005f39, 0x00005f39, 0x00505f3a, 0x00605f3a, 0x00405f3a, 0x00705f3a, 0x00005f26, 0x00205f3a,
+    0x00005f26, 0x00805f3a, 0x00105f39, 0x00105f39, 0x00305f3a, 0x00005f26, 0x01f05f39, 0x01f05f39,
+    0x0000df3a, 0x0000df27, 0x0000df27, 0x0000df27, 0x0000df27, 0x0010df3a, 0x0000df27, 0x01f0df3a,
+    0x00065f2a, 0x00069f2a, 0x00061f2a, 0x0005df2a, 0x00059f2a, 0x00055f2a, 0x00035f2a, 0x00051f2a,
+    0x0007df39, 0x0007df39, 0x0057df3a, 0x0067df3a, 0x0047df3a, 0x0077df3a, 0x0007df26, 0x0027df3a,
+    0x0007df26, 0x0087df3a, 0x0017df39, 0x0017df39, 0x0037df3a, 0x0007df26, 0x01f7df39, 0x01f7df39,
+};
 #endif /* _ENCODE_ONLY */
 
 /***************************************************************************************************
@@ -649,17 +1706,17 @@ DECLFUNC HCENC ga_hcenc_sf1_ldac[LDAC_MAXSFCBLEN_2-LDAC_MINSFCBLEN_2+1] = {
 
 #ifndef _ENCODE_ONLY
 DECLFUNC HCDEC ga_hcdec_sf0_ldac[LDAC_MAXSFCBLEN_0-LDAC_MINSFCBLEN_0+1] = {
-    {sa_hc_sf0_blen3_ldac,  8,  3,  7,  6, sa_hc_sf0_blen3_dec_ldac},
-    {sa_hc_sf0_blen4_ldac, 16,  4, 15,  8, sa_hc_sf0_blen4_dec_ldac},
-    {sa_hc_sf0_blen5_ldac, 32,  5, 31,  8, sa_hc_sf0_blen5_dec_ldac},
-    {sa_hc_sf0_blen6_ldac, 64,  6, 63,  8, sa_hc_sf0_blen6_dec_ldac},
+    {sa_hc_sf0_blen3_ldac,  8,  3,  7,  6, sa_hc_sf0_blen3_dec_ldac, sa_hc_sf0_blen3_mdec_ldac},
+    {sa_hc_sf0_blen4_ldac, 16,  4, 15,  8, sa_hc_sf0_blen4_dec_ldac, sa_hc_sf0_blen4_mdec_ldac},
+    {sa_hc_sf0_blen5_ldac, 32,  5, 31,  8, sa_hc_sf0_blen5_dec_ldac, sa_hc_sf0_blen5_mdec_ldac},
+    {sa_hc_sf0_blen6_ldac, 64,  6, 63,  8, sa_hc_sf0_blen6_dec_ldac, sa_hc_sf0_blen6_mdec_ldac},
 };
 
 DECLFUNC HCDEC ga_hcdec_sf1_ldac[LDAC_MAXSFCBLEN_2-LDAC_MINSFCBLEN_2+1] = {
-    {sa_hc_sf1_blen2_ldac,  4,  2,  3,  2, sa_hc_sf1_blen2_dec_ldac},
-    {sa_hc_sf1_blen3_ldac,  8,  3,  7,  6, sa_hc_sf1_blen3_dec_ldac},
-    {sa_hc_sf1_blen4_ldac, 16,  4, 15,  8, sa_hc_sf1_blen4_dec_ldac},
-    {sa_hc_sf1_blen5_ldac, 32,  5, 31,  8, sa_hc_sf1_blen5_dec_ldac},
+    {sa_hc_sf1_blen2_ldac,  4,  2,  3,  2, sa_hc_sf1_blen2_dec_ldac, sa_hc_sf1_blen2_mdec_ldac},
+    {sa_hc_sf1_blen3_ldac,  8,  3,  7,  6, sa_hc_sf1_blen3_dec_ldac, sa_hc_sf1_blen3_mdec_ldac},
+    {sa_hc_sf1_blen4_ldac, 16,  4, 15,  8, sa_hc_sf1_blen4_dec_ldac, sa_hc_sf1_blen4_mdec_ldac},
+    {sa_hc_sf1_blen5_ldac, 32,  5, 31,  8, sa_hc_sf1_blen5_dec_ldac, sa_hc_sf1_blen5_mdec_ldac},
 };
 #endif /* _ENCODE_ONLY */
 
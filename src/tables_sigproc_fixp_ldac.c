@@ -66,6 +66,22 @@ static const INT32 sa_fwin_2fs_ldac[LDAC_2FSLSU] = { /* Q30 */
 #endif /* _DECODE_ONLY */
 #ifndef _ENCODE_ONLY
 DECLFUNC const INT32 *gaa_bwin_ldac[LDAC_NUMLNN];
+static const INT32 sa_bwin_qfs_ldac[LDAC_QFSLSU] = { /* Q30 */
+    0x0009e128, 0x0059a183, 0x00fcf8bc, 0x01fbae39, 0x0361a407, 0x053ef5e7, 0x07a7dc07, 0x0ab3fb96,
+    0x0e7c9f1e, 0x13191ee4, 0x1898b5be, 0x1ef969f3, 0x261d0678, 0x2dbf91b0, 0x3575533d, 0x3cb6a777,
+    0x42faa453, 0x47d80de4, 0x4b1dadde, 0x4cd70af6, 0x4d3e42e4, 0x4ca527e6, 0x4b60721f, 0x49ba8eda,
+    0x47ee317c, 0x46262c84, 0x447fe54c, 0x430e87ab, 0x41de00ed, 0x40f563f0, 0x4058a929, 0x4009de1c,
+};
+static const INT32 sa_bwin_hfs_ldac[LDAC_HFSLSU] = { /* Q30 */
+    0x000277d0, 0x001641be, 0x003e129d, 0x007a64ec, 0x00cbf17f, 0x0133b0bb, 0x01b2dc02, 0x024aef24,
+    0x02fda995, 0x03cd0f00, 0x04bb66cb, 0x05cb39d2, 0x06ff4d92, 0x085a9bb8, 0x09e044d1, 0x0b937c9a,
+    0x0d776e53, 0x0f8f174e, 0x11dd163f, 0x14636e19, 0x17233c63, 0x1a1c6462, 0x1d4d32bb, 0x20b2001e,
+    0x2444dcf1, 0x27fd5300, 0x2bd04c89, 0x2fb02fdc, 0x338d3b6e, 0x3756270f, 0x3af90459, 0x3e644bfe,
+    0x4187fad3, 0x44569b00, 0x46c6169b, 0x48d03947, 0x4a72d433, 0x4baf87b0, 0x4c8b42fd, 0x4d0d937d,
+    0x4d3fdeb7, 0x4d2c9fa9, 0x4cdeb98c, 0x4c60eac7, 0x4bbd63fe, 0x4afd81ee, 0x4a29a59b, 0x494924b7,
+    0x48624bef, 0x477a6d71, 0x4695f6d6, 0x45b88aca, 0x44e51bd1, 0x441e0654, 0x436528da, 0x42bbf9df,
+    0x42239af7, 0x419ce949, 0x41288b6b, 0x40c6fcea, 0x407897a0, 0x403d9b1c, 0x4016324e, 0x4002779f,
+};
 static const INT32 sa_bwin_1fs_ldac[LDAC_1FSLSU] = { /* Q30 */
     0x00009dec, 0x00058e07, 0x000f720a, 0x001e5194, 0x0032381b, 0x004b34e9, 0x00695b2d, 0x008cc1ff,
     0x00b58467, 0x00e3c16f, 0x01179c29, 0x01513bbb, 0x0190cb70, 0x01d67abe, 0x02227d51, 0x02750b17,
@@ -124,6 +140,24 @@ static const INT32 sa_bwin_2fs_ldac[LDAC_2FSLSU] = { /* Q30 */
     MDCT/IMDCT Tables
 ***************************************************************************************************/
 DECLFUNC const INT32 *gaa_wcos_ldac[LDAC_NUMLNN];
+#ifndef _ENCODE_ONLY
+static const INT32 sa_wcos_qfs_ldac[LDAC_QFSLSU] = { /* Q31 */
+    0x5a82799a, 0x7641af3d, 0xcf043ab3, 0x7d8a5f40, 0x471cece7, 0xe70747c4, 0x9592675c, 0x7f62368f,
+    0x70e2cbc6, 0x5133cc94, 0x25280c5e, 0xf3742ca2, 0xc3a94590, 0x9d0dfe54, 0x8582faa5, 0x7ff62182,
+    0x7f0991c4, 0x7ce3ceb2, 0x798a23b1, 0x7504d345, 0x6f5f02b2, 0x68a69e81, 0x60ec3830, 0x5842dd54,
+    0x4ebfe8a5, 0x447acd50, 0x398cdd32, 0x2e110a62, 0x2223a4c5, 0x15e21445, 0x096a9049, 0x00000000,
+};
+static const INT32 sa_wcos_hfs_ldac[LDAC_HFSLSU] = { /* Q31 */
+    0x5a82799a, 0x7641af3d, 0xcf043ab3, 0x7d8a5f40, 0x471cece7, 0xe70747c4, 0x9592675c, 0x7f62368f,
+    0x70e2cbc6, 0x5133cc94, 0x25280c5e, 0xf3742ca2, 0xc3a94590, 0x9d0dfe54, 0x8582faa5, 0x7fd8878e,
+    0x7c29fbee, 0x73b5ebd1, 0x66cf8120, 0x55f5a4d2, 0x41ce1e65, 0x2b1f34eb, 0x12c8106f, 0xf9b82684,
+    0xe0e60685, 0xc945dfec, 0xb3c0200c, 0xa1288376, 0x9235f2ec, 0x877b7bec, 0x8162aa04, 0x7ffd885a,
+    0x7fc25596, 0x7f3857f6, 0x7e5fe493, 0x7d3980ec, 0x7bc5e290, 0x7a05eead, 0x77fab989, 0x75a585cf,
+    0x7307c3d0, 0x7023109a, 0x6cf934fc, 0x698c246c, 0x65ddfbd3, 0x61f1003f, 0x5dc79d7c, 0x59646498,
+    0x54ca0a4b, 0x4ffb654d, 0x4afb6c98, 0x45cd358f, 0x4073f21d, 0x3af2eeb7, 0x354d9057, 0x2f875262,
+    0x29a3c485, 0x23a6887f, 0x1d934fe5, 0x176dd9de, 0x1139f0cf, 0x0afb6805, 0x04b6195d, 0x00000000,
+};
+#endif /* _ENCODE_ONLY */
 static const INT32 sa_wcos_1fs_ldac[LDAC_1FSLSU] = { /* Q31 */
     0x5a82799a, 0x7641af3d, 0xcf043ab3, 0x7d8a5f40, 0x471cece7, 0xe70747c4, 0x9592675c, 0x7f62368f,
     0x70e2cbc6, 0x5133cc94, 0x25280c5e, 0xf3742ca2, 0xc3a94590, 0x9d0dfe54, 0x8582faa5, 0x7fd8878e,
@@ -178,6 +212,24 @@ static const INT32 sa_wcos_2fs_ldac[LDAC_2FSLSU] = { /* Q31 */
 };
 
 DECLFUNC const INT32 *gaa_wsin_ldac[LDAC_NUMLNN];
+#ifndef _ENCODE_ONLY
+static const INT32 sa_wsin_qfs_ldac[LDAC_QFSLSU] = { /* Q31 */
+    0x5a82799a, 0x30fbc54d, 0x7641af3d, 0x18f8b83c, 0x6a6d98a4, 0x7d8a5f40, 0x471cece7, 0x0c8bd35e,
+    0x3c56ba70, 0x62f201ac, 0x7a7d055b, 0x7f62368f, 0x70e2cbc6, 0x5133cc94, 0x25280c5e, 0x03242abf,
+    0x0fab272b, 0x1c0b826a, 0x2826b928, 0x33def287, 0x3f1749b8, 0x49b41533, 0x539b2af0, 0x5cb420e0,
+    0x64e88926, 0x6c242960, 0x72552c85, 0x776c4edb, 0x7b5d039e, 0x7e1d93ea, 0x7fa736b4, 0x00000000,
+};
+static const INT32 sa_wsin_hfs_ldac[LDAC_HFSLSU] = { /* Q31 */
+    0x5a82799a, 0x30fbc54d, 0x7641af3d, 0x18f8b83c, 0x6a6d98a4, 0x7d8a5f40, 0x471cece7, 0x0c8bd35e,
+    0x3c56ba70, 0x62f201ac, 0x7a7d055b, 0x7f62368f, 0x70e2cbc6, 0x5133cc94, 0x25280c5e, 0x0647d97c,
+    0x1f19f97b, 0x36ba2014, 0x4c3fdff4, 0x5ed77c8a, 0x6dca0d14, 0x78848414, 0x7e9d55fc, 0x7fd8878e,
+    0x7c29fbee, 0x73b5ebd1, 0x66cf8120, 0x55f5a4d2, 0x41ce1e65, 0x2b1f34eb, 0x12c8106f, 0x01921d20,
+    0x07d95b9e, 0x0e1bc2e4, 0x145576b1, 0x1a82a026, 0x209f701c, 0x26a82186, 0x2c98fbba, 0x326e54c7,
+    0x382493b0, 0x3db832a6, 0x4325c135, 0x4869e665, 0x4d8162c4, 0x5269126e, 0x571deefa, 0x5b9d1154,
+    0x5fe3b38d, 0x63ef3290, 0x67bd0fbd, 0x6b4af279, 0x6e96a99d, 0x719e2cd2, 0x745f9dd1, 0x76d94989,
+    0x7909a92d, 0x7aef6323, 0x7c894bde, 0x7dd6668f, 0x7ed5e5c6, 0x7f872bf3, 0x7fe9cbc0, 0x00000000,
+};
+#endif /* _ENCODE_ONLY */
 static const INT32 sa_wsin_1fs_ldac[LDAC_1FSLSU] = { /* Q31 */
     0x5a82799a, 0x30fbc54d, 0x7641af3d, 0x18f8b83c, 0x6a6d98a4, 0x7d8a5f40, 0x471cece7, 0x0c8bd35e,
     0x3c56ba70, 0x62f201ac, 0x7a7d055b, 0x7f62368f, 0x70e2cbc6, 0x5133cc94, 0x25280c5e, 0x0647d97c,
@@ -232,6 +284,18 @@ static const INT32 sa_wsin_2fs_ldac[LDAC_2FSLSU] = { /* Q31 */
 };
 
 DECLFUNC const int *gaa_perm_ldac[LDAC_NUMLNN];
+#ifndef _ENCODE_ONLY
+static const int sa_perm_qfs_ldac[LDAC_QFSLSU] = {
+      0,  16,  24,   8,  12,  28,  20,   4,   6,  22,  30,  14,  10,  26,  18,   2,
+      3,  19,  27,  11,  15,  31,  23,   7,   5,  21,  29,  13,   9,  25,  17,   1,
+};
+static const int sa_perm_hfs_ldac[LDAC_HFSLSU] = {
+      0,  32,  48,  16,  24,  56,  40,   8,  12,  44,  60,  28,  20,  52,  36,   4,
+      6,  38,  54,  22,  30,  62,  46,  14,  10,  42,  58,  26,  18,  50,  34,   2,
+      3,  35,  51,  19,  27,  59,  43,  11,  15,  47,  63,  31,  23,  55,  39,   7,
+      5,  37,  53,  21,  29,  61,  45,  13,   9,  41,  57,  25,  17,  49,  33,   1,
+};
+#endif /* _ENCODE_ONLY */
 static const int sa_perm_1fs_ldac[LDAC_1FSLSU] = {
       0,  64,  96,  32,  48, 112,  80,  16,  24,  88, 120,  56,  40, 104,  72,   8,
      12,  76, 108,  44,  60, 124,  92,  28,  20,  84, 116,  52,  36, 100,  68,   4,
@@ -326,7 +390,7 @@ DECLFUNC const INT32 ga_rsf_ldac[LDAC_NIDWL] = { /* Q31 */
 DECLFUNC void set_mdct_table_ldac(
 int nlnn)
 {
-    int index = nlnn - LDAC_1FSLNN;
+    int index = nlnn - LDAC_MINLNN;
 
     if (nlnn == LDAC_1FSLNN) {
         gaa_fwin_ldac[index] = sa_fwin_1fs_ldac;
@@ -352,9 +416,21 @@ int nlnn)
 DECLFUNC void set_imdct_table_ldac(
 int nlnn)
 {
-    int index = nlnn - LDAC_1FSLNN;
+    int index = nlnn - LDAC_MINLNN;
 
-    if (nlnn == LDAC_1FSLNN) {
+    if (nlnn == LDAC_QFSLNN) {
+        gaa_bwin_ldac[index] = sa_bwin_qfs_ldac;
+        gaa_wcos_ldac[index] = sa_wcos_qfs_ldac;
+        gaa_wsin_ldac[index] = sa_wsin_qfs_ldac;
+        gaa_perm_ldac[index] = sa_perm_qfs_ldac;
+    }
+    else if (nlnn == LDAC_HFSLNN) {
+        gaa_bwin_ldac[index] = sa_bwin_hfs_ldac;
+        gaa_wcos_ldac[index] = sa_wcos_hfs_ldac;
+        gaa_wsin_ldac[index] = sa_wsin_hfs_ldac;
+        gaa_perm_ldac[index] = sa_perm_hfs_ldac;
+    }
+    else if (nlnn == LDAC_1FSLNN) {
         gaa_bwin_ldac[index] = sa_bwin_1fs_ldac;
         gaa_wcos_ldac[index] = sa_wcos_1fs_ldac;
         gaa_wsin_ldac[index] = sa_wsin_1fs_ldac;
@@ -114,6 +114,34 @@ static const SCALAR sa_fwin_2fs_ldac[LDAC_2FSLSU] = {
 #endif /* _DECODE_ONLY */
 #ifndef _ENCODE_ONLY
 DECLFUNC const SCALAR *gaa_bwin_ldac[LDAC_NUMLNN];
+static const SCALAR sa_bwin_qfs_ldac[LDAC_QFSLSU] = {
+    6.0299779721621847e-04, 5.4706359544924518e-03, 1.5440162107711763e-02, 3.0986362502589793e-02,
+    5.2834516998977371e-02, 8.1967807649557758e-02, 1.1962032943822126e-01, 1.6723527528158466e-01,
+    2.2635629570209154e-01, 2.9840824393163262e-01, 3.8432067448719570e-01, 4.8397301439629320e-01,
+    5.9552156193015915e-01, 7.1481744975248285e-01, 8.3528595906222869e-01, 9.4864832518372089e-01,
+    1.0465479670713655e+00, 1.1225619050791027e+00, 1.1736864725388505e+00, 1.2006251716905572e+00,
+    1.2069251273879424e+00, 1.1975803134040572e+00, 1.1777615833648820e+00, 1.1520115973647393e+00,
+    1.1239131654189367e+00, 1.0960799495229752e+00, 1.0703061337200250e+00, 1.0477618376744242e+00,
+    1.0291750257159231e+00, 1.0149774397988705e+00, 1.0054114245807528e+00, 1.0006022714599612e+00,
+};
+static const SCALAR sa_bwin_hfs_ldac[LDAC_HFSLSU] = {
+    1.5063601381682011e-04, 1.3584474462543673e-03, 3.7886177320334948e-03, 7.4703503843106941e-03,
+    1.2447713421893936e-02, 1.8779928743902788e-02, 2.6541711957177312e-02, 3.5823617534646711e-02,
+    4.6732325615097714e-02, 5.9390783134218229e-02, 7.3938082263507884e-02, 9.0528922524202554e-02,
+    1.0933245918379747e-01, 1.3053029043162839e-01, 1.5431328196962141e-01, 1.8087687549234893e-01,
+    2.1041448667730633e-01, 2.4310858398841251e-01, 2.7911907387439294e-01, 3.1856872996596275e-01,
+    3.6152562795443510e-01, 4.0798291770561540e-01, 4.5783680167276419e-01, 5.1086428598490374e-01,
+    5.6670306751604915e-01, 6.2483668296959261e-01, 6.8458855955238695e-01, 7.4512859813279664e-01,
+    8.0549512595071404e-01, 8.6463333603715675e-01, 9.2144879049936534e-01, 9.7487163368853158e-01,
+    1.0239245475428549e+00, 1.0677859781525272e+00, 1.1058403504640590e+00, 1.1377089681197510e+00,
+    1.1632585999272458e+00, 1.1825885024539857e+00, 1.1959998581789721e+00, 1.2039536211881785e+00,
+    1.2070233145307434e+00, 1.2058486131649038e+00, 1.2010940425977306e+00, 1.1934153504838110e+00,
+    1.1834344842439810e+00, 1.1717228717811341e+00, 1.1587919249501786e+00, 1.1450893197640402e+00,
+    1.1309995494487095e+00, 1.1168473822408467e+00, 1.1029030881588378e+00, 1.0893885582131884e+00,
+    1.0764836829527873e+00, 1.0643325635250040e+00, 1.0530492907625166e+00, 1.0427231479840364e+00,
+    1.0334231771880353e+00, 1.0252021034645229e+00, 1.0180996458407174e+00, 1.0121452604998511e+00,
+    1.0073603692144730e+00, 1.0037601255634612e+00, 1.0013547666740488e+00, 1.0001505906450658e+00,
+};
 static const SCALAR sa_bwin_1fs_ldac[LDAC_1FSLSU] = {
     3.7651915440975394e-05, 3.3903736493220906e-04, 9.4271596562608224e-04, 1.8505048571780874e-03,
     3.0651340559987705e-03, 4.5902515284472027e-03, 6.4304297938873652e-03, 8.5911739140682748e-03,
@@ -220,6 +248,36 @@ static const SCALAR sa_bwin_2fs_ldac[LDAC_2FSLSU] = {
     MDCT/IMDCT Tables
 ***************************************************************************************************/
 DECLFUNC const SCALAR *gaa_wcos_ldac[LDAC_NUMLNN];
+#ifndef _ENCODE_ONLY
+static const SCALAR sa_wcos_qfs_ldac[LDAC_QFSLSU] = {
+    7.0710678118654757e-01, 9.2387953251128674e-01,-3.8268343236508973e-01, 9.8078528040323043e-01,
+    5.5557023301960229e-01,-1.9509032201612819e-01,-8.3146961230254535e-01, 9.9518472667219693e-01,
+    8.8192126434835505e-01, 6.3439328416364549e-01, 2.9028467725446233e-01,-9.8017140329560645e-02,
+   -4.7139673682599770e-01,-7.7301045336273699e-01,-9.5694033573220882e-01, 9.9969881869620425e-01,
+    9.9247953459870997e-01, 9.7570213003852857e-01, 9.4952818059303667e-01, 9.1420975570353069e-01,
+    8.7008699110871146e-01, 8.1758481315158371e-01, 7.5720884650648457e-01, 6.8954054473706694e-01,
+    6.1523159058062682e-01, 5.3499761988709726e-01, 4.4961132965460660e-01, 3.5989503653498828e-01,
+    2.6671275747489842e-01, 1.7096188876030136e-01, 7.3564563599667454e-02, 0.0000000000000000e+00,
+};
+static const SCALAR sa_wcos_hfs_ldac[LDAC_HFSLSU] = {
+    7.0710678118654757e-01, 9.2387953251128674e-01,-3.8268343236508973e-01, 9.8078528040323043e-01,
+    5.5557023301960229e-01,-1.9509032201612819e-01,-8.3146961230254535e-01, 9.9518472667219693e-01,
+    8.8192126434835505e-01, 6.3439328416364549e-01, 2.9028467725446233e-01,-9.8017140329560645e-02,
+   -4.7139673682599770e-01,-7.7301045336273699e-01,-9.5694033573220882e-01, 9.9879545620517241e-01,
+    9.7003125319454397e-01, 9.0398929312344334e-01, 8.0320753148064494e-01, 6.7155895484701833e-01,
+    5.1410274419322166e-01, 3.3688985339222005e-01, 1.4673047445536175e-01,-4.9067674327418008e-02,
+   -2.4298017990326387e-01,-4.2755509343028186e-01,-5.9569930449243336e-01,-7.4095112535495888e-01,
+   -8.5772861000027201e-01,-9.4154406518302070e-01,-9.8917650996478101e-01, 9.9992470183914450e-01,
+    9.9811811290014918e-01, 9.9390697000235606e-01, 9.8730141815785843e-01, 9.7831737071962765e-01,
+    9.6697647104485207e-01, 9.5330604035419386e-01, 9.3733901191257496e-01, 9.1911385169005777e-01,
+    8.9867446569395382e-01, 8.7607009419540660e-01, 8.5135519310526520e-01, 8.2458930278502529e-01,
+    7.9583690460888357e-01, 7.6516726562245896e-01, 7.3265427167241282e-01, 6.9837624940897292e-01,
+    6.6241577759017178e-01, 6.2485948814238645e-01, 5.8579785745643886e-01, 5.4532498842204646e-01,
+    5.0353838372571758e-01, 4.6053871095824001e-01, 4.1642956009763732e-01, 3.7131719395183760e-01,
+    3.2531029216226298e-01, 2.7851968938505306e-01, 2.3105810828067128e-01, 1.8303988795514106e-01,
+    1.3458070850712622e-01, 8.5797312344439880e-02, 3.6807222941358991e-02, 0.0000000000000000e+00,
+};
+#endif /* _ENCODE_ONLY */
 static const SCALAR sa_wcos_1fs_ldac[LDAC_1FSLSU] = {
     7.0710678118654757e-01, 9.2387953251128674e-01,-3.8268343236508973e-01, 9.8078528040323043e-01,
     5.5557023301960229e-01,-1.9509032201612819e-01,-8.3146961230254535e-01, 9.9518472667219693e-01,
@@ -322,6 +380,36 @@ static const SCALAR sa_wcos_2fs_ldac[LDAC_2FSLSU] = {
 };
 
 DECLFUNC const SCALAR *gaa_wsin_ldac[LDAC_NUMLNN];
+#ifndef _ENCODE_ONLY
+static const SCALAR sa_wsin_qfs_ldac[LDAC_QFSLSU] = {
+    7.0710678118654746e-01, 3.8268343236508978e-01, 9.2387953251128674e-01, 1.9509032201612825e-01,
+    8.3146961230254524e-01, 9.8078528040323043e-01, 5.5557023301960218e-01, 9.8017140329560604e-02,
+    4.7139673682599764e-01, 7.7301045336273699e-01, 9.5694033573220894e-01, 9.9518472667219693e-01,
+    8.8192126434835505e-01, 6.3439328416364549e-01, 2.9028467725446239e-01, 2.4541228522912288e-02,
+    1.2241067519921620e-01, 2.1910124015686980e-01, 3.1368174039889152e-01, 4.0524131400498986e-01,
+    4.9289819222978404e-01, 5.7580819141784534e-01, 6.5317284295377676e-01, 7.2424708295146689e-01,
+    7.8834642762660623e-01, 8.4485356524970701e-01, 8.9322430119551532e-01, 9.3299279883473885e-01,
+    9.6377606579543984e-01, 9.8527764238894122e-01, 9.9729045667869021e-01, 0.0000000000000000e+00,
+};
+static const SCALAR sa_wsin_hfs_ldac[LDAC_HFSLSU] = {
+    7.0710678118654746e-01, 3.8268343236508978e-01, 9.2387953251128674e-01, 1.9509032201612825e-01,
+    8.3146961230254524e-01, 9.8078528040323043e-01, 5.5557023301960218e-01, 9.8017140329560604e-02,
+    4.7139673682599764e-01, 7.7301045336273699e-01, 9.5694033573220894e-01, 9.9518472667219693e-01,
+    8.8192126434835505e-01, 6.3439328416364549e-01, 2.9028467725446239e-01, 4.9067674327418015e-02,
+    2.4298017990326387e-01, 4.2755509343028208e-01, 5.9569930449243336e-01, 7.4095112535495911e-01,
+    8.5772861000027212e-01, 9.4154406518302081e-01, 9.8917650996478101e-01, 9.9879545620517241e-01,
+    9.7003125319454397e-01, 9.0398929312344345e-01, 8.0320753148064494e-01, 6.7155895484701855e-01,
+    5.1410274419322177e-01, 3.3688985339222033e-01, 1.4673047445536180e-01, 1.2271538285719925e-02,
+    6.1320736302208578e-02, 1.1022220729388306e-01, 1.5885814333386145e-01, 2.0711137619221856e-01,
+    2.5486565960451457e-01, 3.0200594931922808e-01, 3.4841868024943456e-01, 3.9399204006104810e-01,
+    4.3861623853852766e-01, 4.8218377207912272e-01, 5.2458968267846895e-01, 5.6573181078361312e-01,
+    6.0551104140432555e-01, 6.4383154288979139e-01, 6.8060099779545302e-01, 7.1573082528381859e-01,
+    7.4913639452345926e-01, 7.8073722857209438e-01, 8.1045719825259477e-01, 8.3822470555483797e-01,
+    8.6397285612158670e-01, 8.8763962040285393e-01, 9.0916798309052227e-01, 9.2850608047321548e-01,
+    9.4560732538052128e-01, 9.6043051941556579e-01, 9.7293995220556007e-01, 9.8310548743121629e-01,
+    9.9090263542778001e-01, 9.9631261218277800e-01, 9.9932238458834954e-01, 0.0000000000000000e+00,
+};
+#endif /* _ENCODE_ONLY */
 static const SCALAR sa_wsin_1fs_ldac[LDAC_1FSLSU] = {
     7.0710678118654746e-01, 3.8268343236508978e-01, 9.2387953251128674e-01, 1.9509032201612825e-01,
     8.3146961230254524e-01, 9.8078528040323043e-01, 5.5557023301960218e-01, 9.8017140329560604e-02,
@@ -457,6 +545,16 @@ static const int sa_perm_2fs_ldac[LDAC_2FSLSU] = {
 
 #ifndef _ENCODE_ONLY
 DECLFUNC const int *gaa_rev_perm_ldac[LDAC_NUMLNN];
+static const int sa_rev_perm_qfs_ldac[LDAC_QFSLSU] = {
+     15,  16,   0,  31,   8,  23,   7,  24,  12,  19,   3,  28,  11,  20,   4,  27,
+     14,  17,   1,  30,   9,  22,   6,  25,  13,  18,   2,  29,  10,  21,   5,  26,
+};
+static const int sa_rev_perm_hfs_ldac[LDAC_HFSLSU] = {
+     31,  32,   0,  63,  16,  47,  15,  48,  24,  39,   7,  56,  23,  40,   8,  55,
+     28,  35,   3,  60,  19,  44,  12,  51,  27,  36,   4,  59,  20,  43,  11,  52,
+     30,  33,   1,  62,  17,  46,  14,  49,  25,  38,   6,  57,  22,  41,   9,  54,
+     29,  34,   2,  61,  18,  45,  13,  50,  26,  37,   5,  58,  21,  42,  10,  53,
+};
 static const int sa_rev_perm_1fs_ldac[LDAC_1FSLSU] = {
      63,  64,   0, 127,  32,  95,  31,  96,  48,  79,  15, 112,  47,  80,  16, 111,
      56,  71,   7, 120,  39,  88,  24, 103,  55,  72,   8, 119,  40,  87,  23, 104,
@@ -567,7 +665,7 @@ DECLFUNC const SCALAR ga_rsf_ldac[LDAC_NIDWL] = {
 DECLFUNC void set_mdct_table_ldac(
 int nlnn)
 {
-    int index = nlnn - LDAC_1FSLNN;
+    int index = nlnn - LDAC_MINLNN;
 
     if (nlnn == LDAC_1FSLNN) {
         gaa_fwin_ldac[index] = sa_fwin_1fs_ldac;
@@ -593,9 +691,21 @@ int nlnn)
 DECLFUNC void set_imdct_table_ldac(
 int nlnn)
 {
-    int index = nlnn - LDAC_1FSLNN;
+    int index = nlnn - LDAC_MINLNN;
 
-    if (nlnn == LDAC_1FSLNN) {
+    if (nlnn == LDAC_QFSLNN) {
+        gaa_bwin_ldac[index] = sa_bwin_qfs_ldac;
+        gaa_wcos_ldac[index] = sa_wcos_qfs_ldac;
+        gaa_wsin_ldac[index] = sa_wsin_qfs_ldac;
+        gaa_rev_perm_ldac[index] = sa_rev_perm_qfs_ldac;
+    }
+    else if (nlnn == LDAC_HFSLNN) {
+        gaa_bwin_ldac[index] = sa_bwin_hfs_ldac;
+        gaa_wcos_ldac[index] = sa_wcos_hfs_ldac;
+        gaa_wsin_ldac[index] = sa_wsin_hfs_ldac;
+        gaa_rev_perm_ldac[index] = sa_rev_perm_hfs_ldac;
+    }
+    else if (nlnn == LDAC_1FSLNN) {
         gaa_bwin_ldac[index] = sa_bwin_1fs_ldac;
         gaa_wcos_ldac[index] = sa_wcos_1fs_ldac;
         gaa_wsin_ldac[index] = sa_wsin_1fs_ldac;
@@ -7,31 +7,77 @@
 #include "ldac.h"
 
 #ifndef _ENCODE_ONLY
+/***************************************************************************************************
+    Refill Bit Reader
+***************************************************************************************************/
+#define LDAC_ACCSIZE 64
+
+static void refill_bit_reader_ldac(
+BITRD *p_br)
+{
+    UINT64 tmp;
+    STREAM *p_pos = p_br->p_pos;
+
+    if (p_br->p_end - p_pos >= LDAC_ACCSIZE/LDAC_BYTESIZE) {
+        tmp = ((UINT64)p_pos[0] << 56) | ((UINT64)p_pos[1] << 48)
+            | ((UINT64)p_pos[2] << 40) | ((UINT64)p_pos[3] << 32)
+            | ((UINT64)p_pos[4] << 24) | ((UINT64)p_pos[5] << 16)
+            | ((UINT64)p_pos[6] << 8) | (UINT64)p_pos[7];
+        p_br->acc |= tmp >> p_br->nacc;
+        p_br->p_pos += (LDAC_ACCSIZE-1-p_br->nacc) >> LDAC_LOC_SHIFT;
+        p_br->nacc |= LDAC_ACCSIZE-LDAC_BYTESIZE;
+    }
+    else {
+        /* Bits beyond the end of the buffer are read as zeros */
+        while (p_br->nacc <= LDAC_ACCSIZE-LDAC_BYTESIZE) {
+            if (p_br->p_pos < p_br->p_end) {
+                p_br->acc |= (UINT64)*p_br->p_pos++ << (LDAC_ACCSIZE-LDAC_BYTESIZE-p_br->nacc);
+            }
+            p_br->nacc += LDAC_BYTESIZE;
+        }
+    }
+
+    return;
+}
+
 /***************************************************************************************************
     Read and Unpack from MSB
 ***************************************************************************************************/
-static void read_unpack_ldac(
+__inline static void read_unpack_ldac(
 int nbits,
-STREAM *p_block,
-int *p_loc,
+BITRD *p_br,
 int *p_idata)
 {
-    register STREAM *p_bufptr;
-    register int bit_idx;
-    register unsigned int tmp;
-
-    p_bufptr = p_block + (*p_loc >> LDAC_LOC_SHIFT);
-    bit_idx = *p_loc & LDAC_LOC_MASK;
-    if (*p_loc < 8*LDAC_MAXNBYTES) {
-        tmp = (*p_bufptr << 16) | (*(p_bufptr+1) << 8) | (*(p_bufptr+2));
-        tmp = 0xffffff & (tmp << bit_idx);
-        *p_idata = tmp >> (24 - nbits);
-    }
-    else {
-        *p_idata = 0;
+    if (p_br->nacc < nbits) {
+        refill_bit_reader_ldac(p_br);
     }
 
-    *p_loc += nbits;
+    *p_idata = (int)((p_br->acc >> 1) >> (LDAC_ACCSIZE-1-nbits));
+    p_br->acc <<= nbits;
+    p_br->nacc -= nbits;
+    p_br->loc += nbits;
+
+    return;
+}
+
+/***************************************************************************************************
+    Initialize Bit Reader
+***************************************************************************************************/
+static void init_bit_reader_ldac(
+BITRD *p_br,
+STREAM *p_stream,
+int nbytes,
+int loc)
+{
+    int dummy;
+
+    p_br->acc = 0;
+    p_br->nacc = 0;
+    p_br->loc = loc & ~LDAC_LOC_MASK;
+    p_br->p_pos = p_stream + (loc >> LDAC_LOC_SHIFT);
+    p_br->p_end = p_stream + nbytes;
+
+    read_unpack_ldac(loc & LDAC_LOC_MASK, p_br, &dummy);
 
     return;
 }
@@ -42,18 +88,52 @@ int *p_idata)
 static int read_varlencode_dectbl_ldac(
 HCDEC *p_hcspec,
 const unsigned char *p_dectbl,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
-    int index, val;
+    int index, val, nbits;
 
-    read_unpack_ldac(p_hcspec->maxlen, p_stream, p_loc, &index);
+    if (p_br->nacc < p_hcspec->maxlen) {
+        refill_bit_reader_ldac(p_br);
+    }
+
+    index = (int)(p_br->acc >> (LDAC_ACCSIZE-p_hcspec->maxlen));
     val = p_dectbl[index];
-    *p_loc -= p_hcspec->maxlen - hc_len_ldac(p_hcspec->p_tbl+val);
+    nbits = hc_len_ldac(p_hcspec->p_tbl+val);
+    p_br->acc <<= nbits;
+    p_br->nacc -= nbits;
+    p_br->loc += nbits;
 
     return val;
 }
 
+/***************************************************************************************************
+    Read Multiple Huffman Codes
+***************************************************************************************************/
+static int read_varlencode_mdectbl_ldac(
+HCDEC *p_hcspec,
+BITRD *p_br,
+int *p_val)
+{
+    int i, ncodes, nbits;
+    UINT32 entry;
+
+    if (p_br->nacc < LDAC_SFCMDECBITS) {
+        refill_bit_reader_ldac(p_br);
+    }
+
+    entry = p_hcspec->p_mdec[p_br->acc >> (LDAC_ACCSIZE-LDAC_SFCMDECBITS)];
+    nbits = entry & 0xf;
+    ncodes = (entry >> 4) & 0xf;
+    for (i = 0; i < ncodes; i++) {
+        p_val[i] = (entry >> (8+6*i)) & 0x3f;
+    }
+    p_br->acc <<= nbits;
+    p_br->nacc -= nbits;
+    p_br->loc += nbits;
+
+    return ncodes;
+}
+
 
 /***************************************************************************************************
     Unpack Frame Header
@@ -65,20 +145,23 @@ int *p_frame_length,
 int *p_frame_status,
 STREAM *p_stream)
 {
-    int loc = 0;
+    BITRD br;
+    BITRD *p_br = &br;
     int val;
 
-    read_unpack_ldac(LDAC_SYNCWORDBITS, p_stream, &loc, &val);
+    init_bit_reader_ldac(p_br, p_stream, LDAC_FRMHDRBYTES, 0);
+
+    read_unpack_ldac(LDAC_SYNCWORDBITS, p_br, &val);
 
     if (val == LDAC_SYNCWORD) {
-        read_unpack_ldac(LDAC_SMPLRATEBITS, p_stream, &loc, p_smplrate_id);
+        read_unpack_ldac(LDAC_SMPLRATEBITS, p_br, p_smplrate_id);
 
-        read_unpack_ldac(LDAC_CHCONFIG2BITS, p_stream, &loc, p_chconfig_id);
+        read_unpack_ldac(LDAC_CHCONFIG2BITS, p_br, p_chconfig_id);
 
-        read_unpack_ldac(LDAC_FRAMELEN2BITS, p_stream, &loc, p_frame_length);
+        read_unpack_ldac(LDAC_FRAMELEN2BITS, p_br, p_frame_length);
         (*p_frame_length)++;
 
-        read_unpack_ldac(LDAC_FRAMESTATBITS, p_stream, &loc, p_frame_status);
+        read_unpack_ldac(LDAC_FRAMESTATBITS, p_br, p_frame_status);
     }
     else {
         return LDAC_FALSE;
@@ -91,20 +174,19 @@ STREAM *p_stream)
     Unpack Frame Alignment
 ***************************************************************************************************/
 static int unpack_frame_alignment_ldac(
-STREAM *p_stream,
-int *p_loc,
+BITRD *p_br,
 int nbytes_frame)
 {
     int i;
     int nbytes_filled, dummy;
 
-    nbytes_filled = nbytes_frame - *p_loc / LDAC_BYTESIZE;
+    nbytes_filled = nbytes_frame - p_br->loc / LDAC_BYTESIZE;
     if (nbytes_filled < 0) {
         return LDAC_FALSE;
     }
 
     for (i = 0; i < nbytes_filled; i++) {
-        read_unpack_ldac(LDAC_BYTESIZE, p_stream, p_loc, &dummy);
+        read_unpack_ldac(LDAC_BYTESIZE, p_br, &dummy);
         if (dummy != LDAC_FILLCODE) {
             return LDAC_FALSE;
         }
@@ -116,18 +198,17 @@ int nbytes_frame)
 /***************************************************************************************************
     Unpack Byte Alignment
 ***************************************************************************************************/
-#define unpack_block_alignment_ldac(p_stream, p_loc) unpack_byte_alignment_ldac((p_stream), (p_loc))
+#define unpack_block_alignment_ldac(p_br) unpack_byte_alignment_ldac((p_br))
 
 static int unpack_byte_alignment_ldac(
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     int nbits_padding, dummy;
 
-    nbits_padding = ((*p_loc + LDAC_BYTESIZE - 1) / LDAC_BYTESIZE) * LDAC_BYTESIZE - *p_loc;
+    nbits_padding = ((p_br->loc + LDAC_BYTESIZE - 1) / LDAC_BYTESIZE) * LDAC_BYTESIZE - p_br->loc;
 
     if (nbits_padding > 0) {
-        read_unpack_ldac(nbits_padding, p_stream, p_loc, &dummy);
+        read_unpack_ldac(nbits_padding, p_br, &dummy);
         if (dummy) {
             return LDAC_FALSE;
         }
@@ -141,10 +222,9 @@ int *p_loc)
 ***************************************************************************************************/
 static int unpack_band_info_ldac(
 AB *p_ab,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
-    read_unpack_ldac(LDAC_NBANDBITS, p_stream, p_loc, &p_ab->nbands);
+    read_unpack_ldac(LDAC_NBANDBITS, p_br, &p_ab->nbands);
     p_ab->nbands += LDAC_BAND_OFFSET;
 
     if (p_ab->nbands > ga_max_nbands_ldac[*p_ab->p_smplrate_id]) {
@@ -154,10 +234,10 @@ int *p_loc)
 
     p_ab->nqus = ga_nqus_ldac[p_ab->nbands];
 
-    read_unpack_ldac(LDAC_FLAGBITS, p_stream, p_loc, &p_ab->ext_flag);
+    read_unpack_ldac(LDAC_FLAGBITS, p_br, &p_ab->ext_flag);
 
     if (p_ab->ext_flag) {
-        read_unpack_ldac(LDAC_EXTMODEBITS, p_stream, p_loc, &p_ab->ext_mode);
+        read_unpack_ldac(LDAC_EXTMODEBITS, p_br, &p_ab->ext_mode);
 
         if (p_ab->ext_mode == LDAC_MODE_3) {
             AC *p_ac;
@@ -167,16 +247,16 @@ int *p_loc)
             for (ich = 0; ich < nchs; ich++) {
                 p_ac = p_ab->ap_ac[ich];
 
-                read_unpack_ldac(LDAC_EXTSIZEBITS, p_stream, p_loc, &p_ac->ext_size);
+                read_unpack_ldac(LDAC_EXTSIZEBITS, p_br, &p_ac->ext_size);
 
                 rest_bits = p_ac->ext_size;
                 while (rest_bits > 0) {
                     if (rest_bits > 16) {
-                        read_unpack_ldac(16, p_stream, p_loc, &val);
+                        read_unpack_ldac(16, p_br, &val);
                         rest_bits -= 16;
                     }
                     else {
-                        read_unpack_ldac(rest_bits, p_stream, p_loc, &val);
+                        read_unpack_ldac(rest_bits, p_br, &val);
                         rest_bits = 0;
                     }
                 }
@@ -192,20 +272,19 @@ int *p_loc)
 ***************************************************************************************************/
 static int unpack_gradient_ldac(
 AB *p_ab,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
-    read_unpack_ldac(LDAC_GRADMODEBITS, p_stream, p_loc, &p_ab->grad_mode);
+    read_unpack_ldac(LDAC_GRADMODEBITS, p_br, &p_ab->grad_mode);
 
     if (p_ab->grad_mode == LDAC_MODE_0) {
-        read_unpack_ldac(LDAC_GRADQU0BITS, p_stream, p_loc, &p_ab->grad_qu_l);
+        read_unpack_ldac(LDAC_GRADQU0BITS, p_br, &p_ab->grad_qu_l);
 
         if (p_ab->grad_qu_l >= LDAC_MAXGRADQU) {
             *p_ab->p_error_code = LDAC_ERR_SYNTAX_GRAD_A;
             return LDAC_FALSE;
         }
 
-        read_unpack_ldac(LDAC_GRADQU0BITS, p_stream, p_loc, &p_ab->grad_qu_h);
+        read_unpack_ldac(LDAC_GRADQU0BITS, p_br, &p_ab->grad_qu_h);
         p_ab->grad_qu_h++;
 
         if (p_ab->grad_qu_h >= LDAC_MAXGRADQU+1) {
@@ -217,25 +296,25 @@ int *p_loc)
             return LDAC_FALSE;
         }
 
-        read_unpack_ldac(LDAC_GRADOSBITS, p_stream, p_loc, &p_ab->grad_os_l);
+        read_unpack_ldac(LDAC_GRADOSBITS, p_br, &p_ab->grad_os_l);
 
-        read_unpack_ldac(LDAC_GRADOSBITS, p_stream, p_loc, &p_ab->grad_os_h);
+        read_unpack_ldac(LDAC_GRADOSBITS, p_br, &p_ab->grad_os_h);
     }
     else {
-        read_unpack_ldac(LDAC_GRADQU1BITS, p_stream, p_loc, &p_ab->grad_qu_l);
+        read_unpack_ldac(LDAC_GRADQU1BITS, p_br, &p_ab->grad_qu_l);
 
         if (p_ab->grad_qu_l > LDAC_DEFGRADQUH) {
             *p_ab->p_error_code = LDAC_ERR_SYNTAX_GRAD_D;
             return LDAC_FALSE;
         }
 
-        read_unpack_ldac(LDAC_GRADOSBITS, p_stream, p_loc, &p_ab->grad_os_l);
+        read_unpack_ldac(LDAC_GRADOSBITS, p_br, &p_ab->grad_os_l);
 
         p_ab->grad_qu_h = LDAC_DEFGRADQUH;
         p_ab->grad_os_h = LDAC_DEFGRADOSH;
     }
 
-    read_unpack_ldac(LDAC_NADJQUBITS, p_stream, p_loc, &p_ab->nadjqus);
+    read_unpack_ldac(LDAC_NADJQUBITS, p_br, &p_ab->nadjqus);
 
     if (p_ab->nadjqus > p_ab->nqus) {
         *p_ab->p_error_code = LDAC_ERR_SYNTAX_GRAD_E;
@@ -250,30 +329,40 @@ int *p_loc)
 ***************************************************************************************************/
 static int unpack_scale_factor_0_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     HCDEC *p_hcsf;
-    int iqu;
+    int iqu, i;
     int nqus = p_ac->p_ab->nqus;
-    int dif;
+    int ncodes, a_dif[LDAC_SFCMDECNCODES];
     const unsigned char *p_tbl;
 
-    read_unpack_ldac(LDAC_SFCBLENBITS, p_stream, p_loc, &p_ac->sfc_bitlen);
+    read_unpack_ldac(LDAC_SFCBLENBITS, p_br, &p_ac->sfc_bitlen);
     p_ac->sfc_bitlen += LDAC_MINSFCBLEN_0;
 
-    read_unpack_ldac(LDAC_IDSFBITS, p_stream, p_loc, &p_ac->sfc_offset);
+    read_unpack_ldac(LDAC_IDSFBITS, p_br, &p_ac->sfc_offset);
 
-    read_unpack_ldac(LDAC_SFCWTBLBITS, p_stream, p_loc, &p_ac->sfc_weight);
+    read_unpack_ldac(LDAC_SFCWTBLBITS, p_br, &p_ac->sfc_weight);
 
-    read_unpack_ldac(p_ac->sfc_bitlen, p_stream, p_loc, p_ac->a_idsf+0);
+    read_unpack_ldac(p_ac->sfc_bitlen, p_br, p_ac->a_idsf+0);
 
     p_tbl = gaa_sfcwgt_ldac[p_ac->sfc_weight];
     p_hcsf = ga_hcdec_sf0_ldac + (p_ac->sfc_bitlen-LDAC_MINSFCBLEN_0);
-    for (iqu = 1; iqu < nqus; iqu++) {
-        dif = read_varlencode_dectbl_ldac(p_hcsf, p_hcsf->p_dec, p_stream, p_loc);
-        p_ac->a_idsf[iqu] = (p_ac->a_idsf[iqu-1] + dif) & p_hcsf->mask;
-        p_ac->a_idsf[iqu-1] += -p_tbl[iqu-1] + p_ac->sfc_offset;
+    iqu = 1;
+    while (iqu < nqus) {
+        /* Decode several codes per lookup, as long as all of them are needed */
+        if (nqus-iqu >= LDAC_SFCMDECNCODES) {
+            ncodes = read_varlencode_mdectbl_ldac(p_hcsf, p_br, a_dif);
+        }
+        else {
+            a_dif[0] = read_varlencode_dectbl_ldac(p_hcsf, p_hcsf->p_dec, p_br);
+            ncodes = 1;
+        }
+
+        for (i = 0; i < ncodes; i++, iqu++) {
+            p_ac->a_idsf[iqu] = (p_ac->a_idsf[iqu-1] + a_dif[i]) & p_hcsf->mask;
+            p_ac->a_idsf[iqu-1] += -p_tbl[iqu-1] + p_ac->sfc_offset;
+        }
     }
     p_ac->a_idsf[nqus-1] += -p_tbl[nqus-1] + p_ac->sfc_offset;
 
@@ -285,29 +374,28 @@ int *p_loc)
 ***************************************************************************************************/
 static int unpack_scale_factor_1_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     int iqu;
     int nqus = p_ac->p_ab->nqus;
     const unsigned char *p_tbl;
 
-    read_unpack_ldac(LDAC_SFCBLENBITS, p_stream, p_loc, &p_ac->sfc_bitlen);
+    read_unpack_ldac(LDAC_SFCBLENBITS, p_br, &p_ac->sfc_bitlen);
     p_ac->sfc_bitlen += LDAC_MINSFCBLEN_1;
 
     if (p_ac->sfc_bitlen > 4) {
         for (iqu = 0; iqu < nqus; iqu++) {
-            read_unpack_ldac(LDAC_IDSFBITS, p_stream, p_loc, p_ac->a_idsf+iqu);
+            read_unpack_ldac(LDAC_IDSFBITS, p_br, p_ac->a_idsf+iqu);
         }
     }
     else {
-        read_unpack_ldac(LDAC_IDSFBITS, p_stream, p_loc, &p_ac->sfc_offset);
+        read_unpack_ldac(LDAC_IDSFBITS, p_br, &p_ac->sfc_offset);
 
-        read_unpack_ldac(LDAC_SFCWTBLBITS, p_stream, p_loc, &p_ac->sfc_weight);
+        read_unpack_ldac(LDAC_SFCWTBLBITS, p_br, &p_ac->sfc_weight);
 
         p_tbl = gaa_sfcwgt_ldac[p_ac->sfc_weight];
         for (iqu = 0; iqu < nqus; iqu++) {
-            read_unpack_ldac(p_ac->sfc_bitlen, p_stream, p_loc, p_ac->a_idsf+iqu);
+            read_unpack_ldac(p_ac->sfc_bitlen, p_br, p_ac->a_idsf+iqu);
             p_ac->a_idsf[iqu] += -p_tbl[iqu] + p_ac->sfc_offset;
         }
     }
@@ -322,22 +410,32 @@ int *p_loc)
 
 static int unpack_scale_factor_2_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     HCDEC *p_hcsf;
-    int iqu;
+    int iqu, i;
     int nqus = p_ac->p_ab->nqus;
-    int dif;
+    int dif, ncodes, a_dif[LDAC_SFCMDECNCODES];
 
-    read_unpack_ldac(LDAC_SFCBLENBITS, p_stream, p_loc, &p_ac->sfc_bitlen);
+    read_unpack_ldac(LDAC_SFCBLENBITS, p_br, &p_ac->sfc_bitlen);
     p_ac->sfc_bitlen += LDAC_MINSFCBLEN_2;
 
     p_hcsf = ga_hcdec_sf1_ldac + (p_ac->sfc_bitlen-LDAC_MINSFCBLEN_2);
-    for (iqu = 0; iqu < nqus; iqu++) {
-        dif = read_varlencode_dectbl_ldac(p_hcsf, p_hcsf->p_dec, p_stream, p_loc);
-        dif = bs_to_int_ldac(dif, p_ac->sfc_bitlen) & LDAC_SFC_MASK;
-        p_ac->a_idsf[iqu] = (p_ac->p_ab->ap_ac[0]->a_idsf[iqu] + dif) & LDAC_SFC_MASK;
+    iqu = 0;
+    while (iqu < nqus) {
+        /* Decode several codes per lookup, as long as all of them are needed */
+        if (nqus-iqu >= LDAC_SFCMDECNCODES) {
+            ncodes = read_varlencode_mdectbl_ldac(p_hcsf, p_br, a_dif);
+        }
+        else {
+            a_dif[0] = read_varlencode_dectbl_ldac(p_hcsf, p_hcsf->p_dec, p_br);
+            ncodes = 1;
+        }
+
+        for (i = 0; i < ncodes; i++, iqu++) {
+            dif = bs_to_int_ldac(a_dif[i], p_ac->sfc_bitlen) & LDAC_SFC_MASK;
+            p_ac->a_idsf[iqu] = (p_ac->p_ab->ap_ac[0]->a_idsf[iqu] + dif) & LDAC_SFC_MASK;
+        }
     }
 
     return LDAC_TRUE;
@@ -348,8 +446,7 @@ int *p_loc)
 ***************************************************************************************************/
 static int unpack_scale_factor_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     int iqu;
     int status = 0;
@@ -359,23 +456,23 @@ int *p_loc)
         p_ac->a_idsf[iqu] = 0;
     }
 
-    read_unpack_ldac(LDAC_SFCMODEBITS, p_stream, p_loc, &p_ac->sfc_mode);
+    read_unpack_ldac(LDAC_SFCMODEBITS, p_br, &p_ac->sfc_mode);
     sfc_mode = p_ac->sfc_mode;
 
     if (p_ac->ich == 0) {
         if (sfc_mode == LDAC_MODE_0) {
-            status = unpack_scale_factor_0_ldac(p_ac, p_stream, p_loc);
+            status = unpack_scale_factor_0_ldac(p_ac, p_br);
         }
         else {
-            status = unpack_scale_factor_1_ldac(p_ac, p_stream, p_loc);
+            status = unpack_scale_factor_1_ldac(p_ac, p_br);
         }
     }
     else {
         if (sfc_mode == LDAC_MODE_0) {
-            status = unpack_scale_factor_0_ldac(p_ac, p_stream, p_loc);
+            status = unpack_scale_factor_0_ldac(p_ac, p_br);
         }
         else {
-            status = unpack_scale_factor_2_ldac(p_ac, p_stream, p_loc);
+            status = unpack_scale_factor_2_ldac(p_ac, p_br);
         }
     }
 
@@ -394,92 +491,102 @@ int *p_loc)
 }
 
 /***************************************************************************************************
-    Unpack Spectrum Data
+    Unpack and Dequantize Spectrum Data
 ***************************************************************************************************/
 static int unpack_spectrum_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     int iqu, isp, i;
-    int lsp, hsp;
     int nqus = p_ac->p_ab->nqus;
+    int nqus_dec = (p_ac->gain > 0) ? min_ldac(nqus, p_ac->nqus_limit) : 0;
     int nsps, idwl1, wl, val;
-
-    for (isp = 0; isp < LDAC_MAXLSU; isp++) {
-        p_ac->a_qspec[isp] = 0;
-    }
+    int a_qspec[LDAC_MAXNSPS];
+    int *p_qspec;
 
     for (iqu = 0; iqu < nqus; iqu++) {
-        lsp = ga_isp_ldac[iqu];
-        hsp = ga_isp_ldac[iqu+1];
         nsps = ga_nsps_ldac[iqu];
         idwl1 = p_ac->a_idwl1[iqu];
         wl = ga_wl_ldac[idwl1];
 
-        if (idwl1 == 1) {
-            isp = lsp;
+        /* QU with residual is kept until its residual is unpacked */
+        p_qspec = (p_ac->a_idwl2[iqu] > 0) ? p_ac->a_qspec+ga_isp_ldac[iqu] : a_qspec;
 
+        if (idwl1 == 1) {
             if (nsps == 2) {
-                read_unpack_ldac(LDAC_2DIMSPECBITS, p_stream, p_loc, &val);
-                p_ac->a_qspec[isp  ] = gaa_2dimdec_spec_ldac[val][0];
-                p_ac->a_qspec[isp+1] = gaa_2dimdec_spec_ldac[val][1];
+                read_unpack_ldac(LDAC_2DIMSPECBITS, p_br, &val);
+                p_qspec[0] = gaa_2dimdec_spec_ldac[val][0];
+                p_qspec[1] = gaa_2dimdec_spec_ldac[val][1];
             }
             else {
-                for (i = 0; i < nsps>>2; i++, isp+=4) {
-                    read_unpack_ldac(LDAC_4DIMSPECBITS, p_stream, p_loc, &val);
+                for (i = 0, isp = 0; i < nsps>>2; i++, isp+=4) {
+                    read_unpack_ldac(LDAC_4DIMSPECBITS, p_br, &val);
 
                     if (val >= LDAC_N4DIMSPECDECTBL) {
                         *p_ac->p_ab->p_error_code = LDAC_ERR_SYNTAX_SPEC;
                         return LDAC_FALSE;
                     }
 
-                    p_ac->a_qspec[isp  ] = gaa_4dimdec_spec_ldac[val][0];
-                    p_ac->a_qspec[isp+1] = gaa_4dimdec_spec_ldac[val][1];
-                    p_ac->a_qspec[isp+2] = gaa_4dimdec_spec_ldac[val][2];
-                    p_ac->a_qspec[isp+3] = gaa_4dimdec_spec_ldac[val][3];
+                    p_qspec[isp  ] = gaa_4dimdec_spec_ldac[val][0];
+                    p_qspec[isp+1] = gaa_4dimdec_spec_ldac[val][1];
+                    p_qspec[isp+2] = gaa_4dimdec_spec_ldac[val][2];
+                    p_qspec[isp+3] = gaa_4dimdec_spec_ldac[val][3];
                 }
             }
         }
         else {
-            for (isp = lsp; isp < hsp; isp++) {
-                read_unpack_ldac(wl, p_stream, p_loc, &val);
-                p_ac->a_qspec[isp] = bs_to_int_ldac(val, wl);
+            for (isp = 0; isp < nsps; isp++) {
+                read_unpack_ldac(wl, p_br, &val);
+                p_qspec[isp] = bs_to_int_ldac(val, wl);
             }
         }
+
+        if ((iqu < nqus_dec) && (p_qspec == a_qspec)) {
+            dequant_spectrum_ldac(p_ac, iqu, a_qspec);
+        }
     }
 
+    /* Muted channel and QUs above the decoder limit are only parsed */
+    clear_spectrum_ldac(p_ac, ga_isp_ldac[nqus_dec]);
+
     return LDAC_TRUE;
 }
 
 /***************************************************************************************************
-    Unpack Residual Data
+    Unpack and Dequantize Residual Data
 ***************************************************************************************************/
 static int unpack_residual_ldac(
 AC *p_ac,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     int iqu, isp;
-    int lsp, hsp;
     int nqus = p_ac->p_ab->nqus;
-    int idwl2, wl, val;
-
-    for (isp = 0; isp < LDAC_MAXLSU; isp++) {
-        p_ac->a_rspec[isp] = 0;
-    }
+    int nqus_dec = (p_ac->gain > 0) ? min_ldac(nqus, p_ac->nqus_limit) : 0;
+    int nsps, idwl2, wl, val;
+    int a_rspec[LDAC_MAXNSPS];
+    int *p_qspec;
 
     for (iqu = 0; iqu < nqus; iqu++) {
         idwl2 = p_ac->a_idwl2[iqu];
 
         if (idwl2 > 0) {
-            lsp = ga_isp_ldac[iqu];
-            hsp = ga_isp_ldac[iqu+1];
+            nsps = ga_nsps_ldac[iqu];
             wl = ga_wl_ldac[idwl2];
 
-            for (isp = lsp; isp < hsp; isp++) {
-                read_unpack_ldac(wl, p_stream, p_loc, &val);
-                p_ac->a_rspec[isp] = bs_to_int_ldac(val, wl);
+            for (isp = 0; isp < nsps; isp++) {
+                read_unpack_ldac(wl, p_br, &val);
+                a_rspec[isp] = bs_to_int_ldac(val, wl);
+            }
+
+            /* Each bin of the QU is written once, with or without its residual */
+            if (iqu < nqus_dec) {
+                p_qspec = p_ac->a_qspec+ga_isp_ldac[iqu];
+                if (p_ac->skip_residual) {
+                    dequant_spectrum_ldac(p_ac, iqu, p_qspec);
+                }
+                else {
+                    dequant_spectrum_residual_ldac(p_ac, iqu, p_qspec, a_rspec);
+                }
             }
         }
     }
@@ -493,8 +600,7 @@ int *p_loc)
 ***************************************************************************************************/
 static int unpack_audio_block_ldac(
 AB *p_ab,
-STREAM *p_stream,
-int *p_loc)
+BITRD *p_br)
 {
     AC *p_ac;
     int ich;
@@ -502,11 +608,11 @@ int *p_loc)
     int status = LDAC_TRUE;
 
     if (status) {
-        status = unpack_band_info_ldac(p_ab, p_stream, p_loc);
+        status = unpack_band_info_ldac(p_ab, p_br);
     }
 
     if (status) {
-        status = unpack_gradient_ldac(p_ab, p_stream, p_loc);
+        status = unpack_gradient_ldac(p_ab, p_br);
     }
 
     if (status) {
@@ -517,7 +623,7 @@ int *p_loc)
         p_ac = p_ab->ap_ac[ich];
 
         if (status) {
-            status = unpack_scale_factor_ldac(p_ac, p_stream, p_loc);
+            status = unpack_scale_factor_ldac(p_ac, p_br);
         }
 
         if (status) {
@@ -529,11 +635,11 @@ int *p_loc)
         }
 
         if (status) {
-            status = unpack_spectrum_ldac(p_ac, p_stream, p_loc);
+            status = unpack_spectrum_ldac(p_ac, p_br);
         }
 
         if (status) {
-            status = unpack_residual_ldac(p_ac, p_stream, p_loc);
+            status = unpack_residual_ldac(p_ac, p_br);
         }
 
         if (status != LDAC_TRUE) {
@@ -559,18 +665,22 @@ int *p_nbytes_used)
     int ibk;
     int nbk = gaa_block_setting_ldac[p_cfg->chconfig_id][1];
     int frame_length = p_cfg->frame_length;
+    BITRD br;
+    BITRD *p_br = &br;
+
+    init_bit_reader_ldac(p_br, p_stream, frame_length, *p_loc);
 
     for (ibk = 0; ibk < nbk; ibk++) {
-        status = unpack_audio_block_ldac(p_ab, p_stream, p_loc);
+        status = unpack_audio_block_ldac(p_ab, p_br);
         if (!status) {
             return LDAC_ERR_UNPACK_BLOCK_FAILED;
         }
 
-        if (*p_loc > frame_length*LDAC_BYTESIZE) {
+        if (p_br->loc > frame_length*LDAC_BYTESIZE) {
             return LDAC_ERR_FRAME_LENGTH_OVER;
         }
 
-        status = unpack_block_alignment_ldac(p_stream, p_loc);
+        status = unpack_block_alignment_ldac(p_br);
         if (!status) {
             return LDAC_ERR_UNPACK_BLOCK_ALIGN;
         }
@@ -578,11 +688,12 @@ int *p_nbytes_used)
         p_ab++;
     }
 
-    status = unpack_frame_alignment_ldac(p_stream, p_loc, frame_length);
+    status = unpack_frame_alignment_ldac(p_br, frame_length);
     if (!status) {
         return LDAC_ERR_UNPACK_FRAME_ALIGN;
     }
 
+    *p_loc = p_br->loc;
     if (*p_loc > frame_length*LDAC_BYTESIZE) {
         return LDAC_ERR_FRAME_ALIGN_OVER;
     }
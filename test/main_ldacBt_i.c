@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include    "ldacBT.h"
 /* Select endian */
 #define __LITTLE_ENDIAN__
@@ -73,6 +74,11 @@ typedef struct _st_ldacenc_param{
     int ith;
     int cm;
     int eqmid; /* Encode quality mode index */
+    int complexity; /* Encoder complexity level */
+    int load; /* Allowed encode time for deadline governor */
+    int feature; /* Show statistics of signal analysis features */
+    int pack_mode; /* Encoder packing mode */
+    int warm_start; /* Warm start of bit allocation */
     char * pPathFileIn;
     char * pPathFileOut;
 } LDAC_ENCODE_PARAM;
@@ -100,6 +106,8 @@ static const char *get_smplfmt_string(LDACBT_SMPL_FMT_T);
 static void   show_copyright(void);
 static void   finish(int);
 static char  *delpath(char*);
+static unsigned int get_clock_us(void*);
+static void   count_features(void*, const LDACBT_FRAME_FEATURES*);
 
 #include <dlfcn.h>
 #include <errno.h>
@@ -152,6 +160,32 @@ static const char *LDACBT_API_ALTER_EQMID_PRIORITY="ldacBT_alter_eqmid_priority"
 typedef int (*tLDACBT_ALTER_EQMID_PRIORITY)(HANDLE_LDAC_BT hLdacBt, int priority);
 static tLDACBT_ALTER_EQMID_PRIORITY ldacBT_api_alter_eqmid_priority;
 
+static const char *LDACBT_API_SET_COMPLEXITY="ldacBT_set_complexity";
+typedef int (*tLDACBT_SET_COMPLEXITY)(HANDLE_LDAC_BT hLdacBt, int level);
+static tLDACBT_SET_COMPLEXITY ldacBT_api_set_complexity;
+
+static const char *LDACBT_API_GET_COMPLEXITY="ldacBT_get_complexity";
+typedef int (*tLDACBT_GET_COMPLEXITY)(HANDLE_LDAC_BT hLdacBt);
+static tLDACBT_GET_COMPLEXITY ldacBT_api_get_complexity;
+
+static const char *LDACBT_API_SET_DEADLINE_GOVERNOR="ldacBT_set_deadline_governor";
+typedef int (*tLDACBT_SET_DEADLINE_GOVERNOR)(HANDLE_LDAC_BT hLdacBt, LDACBT_CLOCK_FUNC clock_func,
+                                             void *p_ctx, int load);
+static tLDACBT_SET_DEADLINE_GOVERNOR ldacBT_api_set_deadline_governor;
+
+static const char *LDACBT_API_SET_FEATURE_CALLBACK="ldacBT_set_feature_callback";
+typedef int (*tLDACBT_SET_FEATURE_CALLBACK)(HANDLE_LDAC_BT hLdacBt, LDACBT_FEATURE_FUNC feature_func,
+                                            void *p_ctx);
+static tLDACBT_SET_FEATURE_CALLBACK ldacBT_api_set_feature_callback;
+
+static const char *LDACBT_API_SET_PACK_MODE="ldacBT_set_pack_mode";
+typedef int (*tLDACBT_SET_PACK_MODE)(HANDLE_LDAC_BT hLdacBt, int mode);
+static tLDACBT_SET_PACK_MODE ldacBT_api_set_pack_mode;
+
+static const char *LDACBT_API_SET_WARM_START="ldacBT_set_warm_start";
+typedef int (*tLDACBT_SET_WARM_START)(HANDLE_LDAC_BT hLdacBt, int enable);
+static tLDACBT_SET_WARM_START ldacBT_api_set_warm_start;
+
 static const char *LDACBT_API_ENCODE="ldacBT_encode";
 typedef int (*tLDACBT_ENCODE)(HANDLE_LDAC_BT hLdacBt, void *p_pcm, int *pcm_used,
                               unsigned char *p_stream, int *stream_sz, int *frame_num );
@@ -213,6 +247,24 @@ static int open_lib_and_load_func(void)
     if((ldacBT_api_alter_eqmid_priority = load_func(LDACBT_API_ALTER_EQMID_PRIORITY)) == NULL)
       return -1;
 
+    if((ldacBT_api_set_complexity = load_func(LDACBT_API_SET_COMPLEXITY)) == NULL)
+      return -1;
+
+    if((ldacBT_api_get_complexity = load_func(LDACBT_API_GET_COMPLEXITY)) == NULL)
+      return -1;
+
+    if((ldacBT_api_set_deadline_governor = load_func(LDACBT_API_SET_DEADLINE_GOVERNOR)) == NULL)
+      return -1;
+
+    if((ldacBT_api_set_feature_callback = load_func(LDACBT_API_SET_FEATURE_CALLBACK)) == NULL)
+      return -1;
+
+    if((ldacBT_api_set_pack_mode = load_func(LDACBT_API_SET_PACK_MODE)) == NULL)
+      return -1;
+
+    if((ldacBT_api_set_warm_start = load_func(LDACBT_API_SET_WARM_START)) == NULL)
+      return -1;
+
     if((ldacBT_api_encode = load_func(LDACBT_API_ENCODE)) == NULL)
       return -1;
 
@@ -226,7 +278,7 @@ static int open_lib_and_load_func(void)
 static void usage(char *p_prog)
 {
     static char    *a_usage[] = {
-        "[EncodeQualityModeID] [ChannelMode] [InputFile] [OutputFile]",
+        "[EncodeQualityModeID] [ChannelMode] [Complexity] [Governor] [Feature] [PackMode] [InputFile] [OutputFile]",
         "",
         "EncodeQualityModeID : Encode Quality Mode Index. (HQ/SQ/MQ)",
         "                    : -HQ : HQ mode (default)",
@@ -236,6 +288,14 @@ static void usage(char *p_prog)
         "            : -stereo : LDACBT_CHANNEL_MODE_STEREO (default for 2ch)",
         "            : -dual   : LDACBT_CHANNEL_MODE_DUAL_CHANNEL",
         "            : -mono   : LDACBT_CHANNEL_MODE_MONO (default for 1ch)",
+        "Complexity : Encoder complexity level. (fast/exhaustive)",
+        "           : -fast       : LDACBT_COMPLEXITY_FAST",
+        "           : -exhaustive : LDACBT_COMPLEXITY_EXHAUSTIVE",
+        "Governor : Deadline governor of encoder complexity level.",
+        "         : -load<N> : Allowed encode time in N percent of frame period. (1-100)",
+        "Feature : -feature : Show statistics of signal analysis features.",
+        "PackMode : -refpack : LDACBT_PACKMODE_REFERENCE (bit-exact with default)",
+        "WarmStart : -warm : Start bit allocation from the result of the previous frame.",
         "[InputFile *]   : PCM Audio Data File",
         "[OutputFile *]  : LDAC Coded Bit Stream File",
         "",
@@ -301,7 +361,7 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
 {
     int   i, j;
     char *p_ptr;
-    int   eqmid, cm, flgReset;
+    int   eqmid, cm, complexity, load, feature, pack_mode, warm_start, flgReset;
     char *ap_file[NFILES];
 
     /* Specify I/O File & Option List */
@@ -311,6 +371,11 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
             j = 0;
             eqmid = LDACBT_EQMID_HQ;
             cm = UNSET;
+            complexity = UNSET;
+            load = UNSET;
+            feature = 0;
+            pack_mode = UNSET;
+            warm_start = UNSET;
             ap_file[0] = NULL;
             ap_file[1] = NULL;
         }
@@ -324,6 +389,12 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
             else if (!strcmp(p_ptr, "stereo")) { cm = LDACBT_CHANNEL_MODE_STEREO;}
             else if (!strcmp(p_ptr, "dual")) { cm = LDACBT_CHANNEL_MODE_DUAL_CHANNEL;}
             else if (!strcmp(p_ptr, "mono")) { cm = LDACBT_CHANNEL_MODE_MONO;}
+            else if (!strcmp(p_ptr, "fast")) { complexity = LDACBT_COMPLEXITY_FAST;}
+            else if (!strcmp(p_ptr, "exhaustive")) { complexity = LDACBT_COMPLEXITY_EXHAUSTIVE;}
+            else if (!strncmp(p_ptr, "load", 4)) { load = atoi(p_ptr+4);}
+            else if (!strcmp(p_ptr, "feature")) { feature = 1;}
+            else if (!strcmp(p_ptr, "refpack")) { pack_mode = LDACBT_PACKMODE_REFERENCE;}
+            else if (!strcmp(p_ptr, "warm")) { warm_start = 1;}
 
             else {
                 fprintf(stderr, "-%s: Unknown Option\n", p_ptr);
@@ -341,6 +412,11 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
                 ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->ith = pList->nParam;
                 ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->cm = cm;
                 ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->eqmid = eqmid;
+                ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->complexity = complexity;
+                ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->load = load;
+                ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->feature = feature;
+                ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->pack_mode = pack_mode;
+                ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->warm_start = warm_start;
                 ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->pPathFileIn  = ap_file[0];
                 ((LDAC_ENCODE_PARAM **)pList->params)[pList->nParam]->pPathFileOut = ap_file[1];
                 ++pList->nParam;
@@ -431,6 +507,7 @@ ldac_encode_proc(void *data)
     int eqmid, frame_sample;
     unsigned char a_pcm_in[LDAC_PRCNCH * LDACBT_MAX_LSU * sizeof(int)];
     unsigned char a_stream[LDACBT_MAX_NBYTES];
+    int a_nfrm_status[4] = {0, 0, 0, 0};
     LDAC_ENCODE_PARAM * pEncParam;
 #ifdef USE_LDACBT_SPEC_INFO
     LDACBT_SPEC_INFO spec_info;
@@ -506,6 +583,56 @@ CHANNEL_MODE_CHECK_ERR:
         goto ldacBT_encode_proc_end;
     }
 
+    /* Set Encoder Complexity Level */
+    if ( pEncParam->complexity != UNSET ) {
+        result = ldacBT_api_set_complexity(hData, pEncParam->complexity);
+        if (result) {
+            fprintf(stderr, "[ERR] Setting complexity level! Error code %s\n",
+                    get_error_code_string(ldacBT_api_get_error_code(hData)));
+            goto ldacBT_encode_proc_end;
+        }
+    }
+
+    /* Set Deadline Governor */
+    if ( pEncParam->load != UNSET ) {
+        result = ldacBT_api_set_deadline_governor(hData, get_clock_us, NULL, pEncParam->load);
+        if (result) {
+            fprintf(stderr, "[ERR] Setting deadline governor! Error code %s\n",
+                    get_error_code_string(ldacBT_api_get_error_code(hData)));
+            goto ldacBT_encode_proc_end;
+        }
+    }
+
+    /* Set Feature Callback */
+    if ( pEncParam->feature ) {
+        result = ldacBT_api_set_feature_callback(hData, count_features, a_nfrm_status);
+        if (result) {
+            fprintf(stderr, "[ERR] Setting feature callback! Error code %s\n",
+                    get_error_code_string(ldacBT_api_get_error_code(hData)));
+            goto ldacBT_encode_proc_end;
+        }
+    }
+
+    /* Set Encoder Packing Mode */
+    if ( pEncParam->pack_mode != UNSET ) {
+        result = ldacBT_api_set_pack_mode(hData, pEncParam->pack_mode);
+        if (result) {
+            fprintf(stderr, "[ERR] Setting packing mode! Error code %s\n",
+                    get_error_code_string(ldacBT_api_get_error_code(hData)));
+            goto ldacBT_encode_proc_end;
+        }
+    }
+
+    /* Set Warm Start of Bit Allocation */
+    if ( pEncParam->warm_start != UNSET ) {
+        result = ldacBT_api_set_warm_start(hData, pEncParam->warm_start);
+        if (result) {
+            fprintf(stderr, "[ERR] Setting warm start! Error code %s\n",
+                    get_error_code_string(ldacBT_api_get_error_code(hData)));
+            goto ldacBT_encode_proc_end;
+        }
+    }
+
     /* Open Coded Bit Stream File */
 #ifdef USE_LDACBT_SPEC_INFO
     fpo = fopen_ldac_write( &spec_info, out_file, sf, cm);
@@ -600,6 +727,16 @@ CHANNEL_MODE_CHECK_ERR:
         }while(--i>0);
     }
 
+    if ( pEncParam->load != UNSET ) {
+        fprintf(stderr, "<%d>  - Complexity Level    : %d (governed)\n", pEncParam->ith,
+                ldacBT_api_get_complexity(hData));
+    }
+    if ( pEncParam->feature ) {
+        fprintf(stderr, "<%d>  - Frame Status        : %d/%d/%d/%d frames (0/1/2/3)\n",
+                pEncParam->ith, a_nfrm_status[0], a_nfrm_status[1], a_nfrm_status[2],
+                a_nfrm_status[3]);
+    }
+
 ldacBT_encode_proc_end:
     /* Close Files */
     if( fpi != NULL ){ fclose(fpi);}
@@ -653,6 +790,22 @@ static char    *delpath(char *str)
     else {        return ptr+1;}
 }
 
+/* Monotonic clock for the deadline governor. Unit:us */
+static unsigned int get_clock_us(void *p_ctx)
+{
+    struct timespec ts;
+    (void)p_ctx;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned int)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/* Count frames for each frame status. */
+static void count_features(void *p_ctx, const LDACBT_FRAME_FEATURES *p_features)
+{
+    int *p_nfrm_status = (int *)p_ctx;
+    p_nfrm_status[p_features->frame_status & 3]++;
+}
+
 #ifdef USE_LDACBT_SPEC_INFO
 /* Update A2DP Codec Specific Element Info for LDAC */
 static int update_ldac_spec_info( LDACBT_SPEC_INFO *p_spec_info, int sf, int cm )
@@ -1109,6 +1262,8 @@ static const char * ldac_ErrCode2Str( int ErrCode )
         CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_GRADPAR_D);
         CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_NBANDS);
         CASE_RETURN_STR(LDACBT_ERR_PACK_BLOCK_FAILED);
+        CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_COMPLEXITY);
+        CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_PACKMODE);
         CASE_RETURN_STR(LDACBT_ERR_DEC_INIT_ALLOC);
         CASE_RETURN_STR(LDACBT_ERR_INPUT_BUFFER_SIZE);
         CASE_RETURN_STR(LDACBT_ERR_UNPACK_BLOCK_FAILED);
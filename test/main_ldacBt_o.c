@@ -31,6 +31,7 @@
 #define NFILES      2
 #define BYTESIZE    8    /* Number of Bits in a Byte */
 #define WORD_MIDDLE 3    /* 24bits/sample 2's Complement Integer Data */
+#define SHIFT_SAMPLES(n, nshift) (((nshift) < 0) ? ((n) >> -(nshift)) : ((n) << (nshift)))
 
 #define USE_LDACBT_SPEC_INFO
 #ifdef USE_LDACBT_SPEC_INFO
@@ -72,6 +73,17 @@ typedef struct _st_ldacdec_param{
     LDACBT_SMPL_FMT_T fmt;
     int wlen;
     int nodelay;
+    int packet;
+    int loss;
+    int stream;
+    int jitter;
+    int planar;
+    int spectrum;
+    int gain;
+    int quality;
+    int nqus;
+    int nshift;
+    int mix;
     char * pPathFileIn;
     char * pPathFileOut;
 } LDAC_DECODE_PARAM;
@@ -91,6 +103,9 @@ static FILE *fopen_ldac_read(LDACBT_SPEC_INFO*, char*, int*, int*, int*);
 static FILE *fopen_ldac_read(char*);
 static int get_ldac_spec_info(unsigned char*, int*, int*, int*);
 #endif /* USE_LDACBT_SPEC_INFO */
+static int get_ldac_frame_bytes(unsigned char*);
+static int ldac_jitter_proc(HANDLE_LDAC_BT, FILE*, FILE*, LDAC_DECODE_PARAM*, int, int, int*);
+static int ldac_mix_proc(HANDLE_LDAC_BT, FILE*, FILE*, LDAC_DECODE_PARAM*, int, int, int*);
 static FILE *open_wavefile_write(char*, LDACBT_SMPL_FMT_T, int, int, int);
 static int fclose_wave_write(FILE*);
 static const char * get_error_code_string(int);
@@ -145,6 +160,71 @@ typedef int (*tLDACBT_DECODE)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs, unsig
                               int *used_bytes, int *wrote_bytes );
 static tLDACBT_DECODE ldacBT_api_decode;
 
+static const char *LDACBT_API_SET_DEC_GAIN="ldacBT_set_decode_gain";
+typedef int (*tLDACBT_SET_DEC_GAIN)(HANDLE_LDAC_BT hLdacBt, int ch, int gain);
+static tLDACBT_SET_DEC_GAIN ldacBT_api_set_decode_gain;
+
+static const char *LDACBT_API_SET_DEC_QUALITY="ldacBT_set_decode_quality";
+typedef int (*tLDACBT_SET_DEC_QUALITY)(HANDLE_LDAC_BT hLdacBt, int quality, int nqus);
+static tLDACBT_SET_DEC_QUALITY ldacBT_api_set_decode_quality;
+
+static const char *LDACBT_API_DECODE_PLANAR="ldacBT_decode_planar";
+typedef int (*tLDACBT_DECODE_PLANAR)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs,
+                                     unsigned char *ap_pcm[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+                                     int *used_bytes, int *wrote_bytes );
+static tLDACBT_DECODE_PLANAR ldacBT_api_decode_planar;
+
+static const char *LDACBT_API_DECODE_MIX="ldacBT_decode_mix";
+typedef int (*tLDACBT_DECODE_MIX)(HANDLE_LDAC_BT hLdacBt, unsigned char *ap_bs[], int a_bs_bytes[],
+                                  int n_streams, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                  int a_used_bytes[], int *wrote_bytes );
+static tLDACBT_DECODE_MIX ldacBT_api_decode_mix;
+
+static const char *LDACBT_API_DECODE_SPECTRUM="ldacBT_decode_spectrum";
+typedef int (*tLDACBT_DECODE_SPECTRUM)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_bs,
+                                       unsigned char *ap_spec[], LDACBT_SMPL_FMT_T fmt, int bs_bytes,
+                                       int *used_bytes, int *wrote_bytes,
+                                       int *ap_idsf[], int *ap_idwl[], int *p_nqus );
+static tLDACBT_DECODE_SPECTRUM ldacBT_api_decode_spectrum;
+
+static const char *LDACBT_API_DECODE_PACKET="ldacBT_decode_packet";
+typedef int (*tLDACBT_DECODE_PACKET)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_payload,
+                                     unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                     int payload_bytes, int pcm_bytes,
+                                     int *used_bytes, int *wrote_bytes );
+static tLDACBT_DECODE_PACKET ldacBT_api_decode_packet;
+
+static const char *LDACBT_API_DECODE_CONCEAL="ldacBT_decode_conceal";
+typedef int (*tLDACBT_DECODE_CONCEAL)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_pcm,
+                                      LDACBT_SMPL_FMT_T fmt, int n_frames, int pcm_bytes,
+                                      int *wrote_bytes );
+static tLDACBT_DECODE_CONCEAL ldacBT_api_decode_conceal;
+
+static const char *LDACBT_API_DECODE_STREAM="ldacBT_decode_stream";
+typedef int (*tLDACBT_DECODE_STREAM)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_data,
+                                     unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                                     int data_bytes, int pcm_bytes,
+                                     int *used_bytes, int *wrote_bytes );
+static tLDACBT_DECODE_STREAM ldacBT_api_decode_stream;
+
+static const char *LDACBT_API_JB_RESET="ldacBT_jb_reset";
+typedef int (*tLDACBT_JB_RESET)(HANDLE_LDAC_BT hLdacBt, int min_depth, int max_depth);
+static tLDACBT_JB_RESET ldacBT_api_jb_reset;
+
+static const char *LDACBT_API_JB_PUT="ldacBT_jb_put";
+typedef int (*tLDACBT_JB_PUT)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_rtp, int rtp_bytes,
+                              unsigned int arrival_us );
+static tLDACBT_JB_PUT ldacBT_api_jb_put;
+
+static const char *LDACBT_API_JB_PULL="ldacBT_jb_pull";
+typedef int (*tLDACBT_JB_PULL)(HANDLE_LDAC_BT hLdacBt, unsigned char *p_pcm, LDACBT_SMPL_FMT_T fmt,
+                               int pcm_bytes, int *wrote_bytes );
+static tLDACBT_JB_PULL ldacBT_api_jb_pull;
+
+static const char *LDACBT_API_JB_GET_STATS="ldacBT_jb_get_stats";
+typedef int (*tLDACBT_JB_GET_STATS)(HANDLE_LDAC_BT hLdacBt, LDACBT_JB_STATS *p_stats);
+static tLDACBT_JB_GET_STATS ldacBT_api_jb_get_stats;
+
 static const char *LDACBT_API_GET_ERR="ldacBT_get_error_code";
 typedef int (*tLDACBT_GET_ERR)(HANDLE_LDAC_BT hLdacBt);
 static tLDACBT_GET_ERR ldacBT_api_get_error_code;
@@ -196,6 +276,42 @@ static int open_lib_and_load_func(void)
     if((ldacBT_api_decode = load_func(LDACBT_API_DECODE)) == NULL)
       return -1;
 
+    if((ldacBT_api_set_decode_gain = load_func(LDACBT_API_SET_DEC_GAIN)) == NULL)
+      return -1;
+
+    if((ldacBT_api_set_decode_quality = load_func(LDACBT_API_SET_DEC_QUALITY)) == NULL)
+      return -1;
+
+    if((ldacBT_api_decode_planar = load_func(LDACBT_API_DECODE_PLANAR)) == NULL)
+      return -1;
+
+    if((ldacBT_api_decode_mix = load_func(LDACBT_API_DECODE_MIX)) == NULL)
+      return -1;
+
+    if((ldacBT_api_decode_spectrum = load_func(LDACBT_API_DECODE_SPECTRUM)) == NULL)
+      return -1;
+
+    if((ldacBT_api_decode_packet = load_func(LDACBT_API_DECODE_PACKET)) == NULL)
+      return -1;
+
+    if((ldacBT_api_decode_conceal = load_func(LDACBT_API_DECODE_CONCEAL)) == NULL)
+      return -1;
+
+    if((ldacBT_api_decode_stream = load_func(LDACBT_API_DECODE_STREAM)) == NULL)
+      return -1;
+
+    if((ldacBT_api_jb_reset = load_func(LDACBT_API_JB_RESET)) == NULL)
+      return -1;
+
+    if((ldacBT_api_jb_put = load_func(LDACBT_API_JB_PUT)) == NULL)
+      return -1;
+
+    if((ldacBT_api_jb_pull = load_func(LDACBT_API_JB_PULL)) == NULL)
+      return -1;
+
+    if((ldacBT_api_jb_get_stats = load_func(LDACBT_API_JB_GET_STATS)) == NULL)
+      return -1;
+
     if((ldacBT_api_get_error_code = load_func(LDACBT_API_GET_ERR)) == NULL)
       return -1;
 
@@ -217,6 +333,18 @@ static void usage(char *p_prog)
         "-int32      : 32bit Integer PCM Output",
         "-float      : floating point PCM Output",
         "-nodelay    : Delay Compensated",
+        "-gain<N>    : Output gain (N=0-32768, 32768 for unity)",
+        "-lowq       : Low quality decoding without the residual data",
+        "-nqus<N>    : Dequantize the lower N quantization units only (N=0-34)",
+        "-nshift<N>  : Shift the output sampling frequency by N octaves (N=-2-1)",
+        "-planar     : Decode into planar channel buffers",
+        "-spectrum   : Output MDCT spectrum instead of PCM (with -int32 or -float)",
+        "-packet<N>  : Decode N frames per media payload (N=1-15)",
+        "-loss<N>    : Drop N percent of frames (payloads) and conceal them",
+        "-stream<N>  : Feed the bit stream in chunks of N bytes (N=3-2048)",
+        "-mix<N>     : Mix the bit stream with itself delayed by N frames (N=0-1000)",
+        "-jitter<N>  : Send RTP packets with up to N ms of arrival jitter",
+        "              through the jitter buffer (N=0-1000)",
         "",
         "",
         "* : thread/process number.",
@@ -279,7 +407,7 @@ static int growth_param_list_if_need(PARAM_LIST *pList)
 static int get_option(int argc, char **argv, PARAM_LIST *pList)
 {
     int  i, j;
-    int  wext, wlength, nodelay, flgReset;
+    int  wext, wlength, nodelay, gain, quality, nqus, nshift, mix, planar, spectrum, packet, loss, stream, jitter, flgReset;
     LDACBT_SMPL_FMT_T fmt;
     char *p_ptr;
     char *ap_file[NFILES];
@@ -293,6 +421,17 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
             fmt = LDACBT_SMPL_FMT_S24;
             wlength = 3;
             nodelay = 0;
+            gain = LDACBT_DEC_GAIN_UNITY;
+            quality = LDACBT_DEC_QUALITY_HIGH;
+            nqus = LDACBT_MAX_NQUS;
+            nshift = 0;
+            mix = -1;
+            planar = 0;
+            spectrum = 0;
+            packet = 0;
+            loss = 0;
+            stream = 0;
+            jitter = -1;
             ap_file[0] = NULL;
             ap_file[1] = NULL;
         }
@@ -315,6 +454,65 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
                 wlength = 4;
             }
             else if (!strcmp(p_ptr, "nodelay")) {        nodelay = 1; }
+            else if (!strncmp(p_ptr, "gain", 4)) {
+                gain = atoi(p_ptr+4);
+                if ((gain < 0) || (gain > LDACBT_DEC_GAIN_UNITY)) {
+                    fprintf(stderr, "-%s: Illegal Gain\n", p_ptr);
+                    return -1;
+                }
+            }
+            else if (!strcmp(p_ptr, "lowq")) {           quality = LDACBT_DEC_QUALITY_LOW; }
+            else if (!strncmp(p_ptr, "nqus", 4)) {
+                nqus = atoi(p_ptr+4);
+                if ((nqus < 0) || (nqus > LDACBT_MAX_NQUS)) {
+                    fprintf(stderr, "-%s: Illegal Number of Quantization Units\n", p_ptr);
+                    return -1;
+                }
+            }
+            else if (!strncmp(p_ptr, "nshift", 6)) {
+                nshift = atoi(p_ptr+6);
+                if ((nshift < -2) || (nshift > 1)) {
+                    fprintf(stderr, "-%s: Illegal Shift\n", p_ptr);
+                    return -1;
+                }
+            }
+            else if (!strncmp(p_ptr, "mix", 3)) {
+                mix = atoi(p_ptr+3);
+                if ((mix < 0) || (mix > 1000)) {
+                    fprintf(stderr, "-%s: Illegal Delay\n", p_ptr);
+                    return -1;
+                }
+            }
+            else if (!strcmp(p_ptr, "planar")) {         planar = 1; }
+            else if (!strcmp(p_ptr, "spectrum")) {       spectrum = 1; }
+            else if (!strncmp(p_ptr, "packet", 6)) {
+                packet = atoi(p_ptr+6);
+                if ((packet < 1) || (packet > LDACBT_PKT_NFRM_MASK)) {
+                    fprintf(stderr, "-%s: Illegal Number of Frames\n", p_ptr);
+                    return -1;
+                }
+            }
+            else if (!strncmp(p_ptr, "loss", 4)) {
+                loss = atoi(p_ptr+4);
+                if ((loss < 0) || (loss > 100)) {
+                    fprintf(stderr, "-%s: Illegal Loss Rate\n", p_ptr);
+                    return -1;
+                }
+            }
+            else if (!strncmp(p_ptr, "stream", 6)) {
+                stream = atoi(p_ptr+6);
+                if ((stream < 3) || (stream > 2*LDACBT_MAX_NBYTES)) {
+                    fprintf(stderr, "-%s: Illegal Chunk Size\n", p_ptr);
+                    return -1;
+                }
+            }
+            else if (!strncmp(p_ptr, "jitter", 6)) {
+                jitter = atoi(p_ptr+6);
+                if ((jitter < 0) || (jitter > 1000)) {
+                    fprintf(stderr, "-%s: Illegal Jitter\n", p_ptr);
+                    return -1;
+                }
+            }
             else {
                 fprintf(stderr, "-%s: Unknown Option\n", p_ptr);
                 return -1;
@@ -325,6 +523,10 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
                 ap_file[j++] = p_ptr;
             }
             if( j == NFILES) {
+                if( spectrum && (wlength != 4) ){
+                    fprintf(stderr, "-spectrum: Needs -int32 or -float\n");
+                    return -1;
+                }
                 if( growth_param_list_if_need(pList) < 0){return -1;}
 
                 ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->ith = pList->nParam;
@@ -332,6 +534,17 @@ static int get_option(int argc, char **argv, PARAM_LIST *pList)
                 ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->fmt = fmt;
                 ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->wlen = wlength;
                 ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->nodelay = nodelay;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->packet = packet;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->loss = loss;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->stream = stream;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->jitter = jitter;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->planar = planar;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->spectrum = spectrum;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->gain = gain;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->quality = quality;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->nqus = nqus;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->nshift = nshift;
+                ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->mix = mix;
                 ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->pPathFileIn  = ap_file[0];
                 ((LDAC_DECODE_PARAM **)pList->params)[pList->nParam]->pPathFileOut = ap_file[1];
                 ++pList->nParam;
@@ -373,12 +586,23 @@ int main( int argc, char **argv )
     if ( paramList.nParam <= 0 ) { usage(delpath(argv[0])); }
 
     for( i = 0; i < paramList.nParam; i++ ){
-        fprintf( stderr, "[% 2d] ext:%d fmt:%s wlen:%d nodelay:%d %s -> %s\n",
+        fprintf( stderr, "[% 2d] ext:%d fmt:%s wlen:%d nodelay:%d packet:%d loss:%d stream:%d jitter:%d planar:%d spectrum:%d gain:%d quality:%d nqus:%d nshift:%d mix:%d %s -> %s\n",
                  ((LDAC_DECODE_PARAM **)paramList.params)[i]->ith,
                  ((LDAC_DECODE_PARAM **)paramList.params)[i]->wext,
                  get_smplfmt_string(((LDAC_DECODE_PARAM **)paramList.params)[i]->fmt),
                  ((LDAC_DECODE_PARAM **)paramList.params)[i]->wlen,
                  ((LDAC_DECODE_PARAM **)paramList.params)[i]->nodelay,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->packet,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->loss,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->stream,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->jitter,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->planar,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->spectrum,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->gain,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->quality,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->nqus,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->nshift,
+                 ((LDAC_DECODE_PARAM **)paramList.params)[i]->mix,
                  ((LDAC_DECODE_PARAM **)paramList.params)[i]->pPathFileIn,
                  ((LDAC_DECODE_PARAM **)paramList.params)[i]->pPathFileOut);
     }
@@ -418,15 +642,25 @@ ldac_decode_proc(void *data)
     int flgInit = 0;
 #endif /* USE_LDACBT_SPEC_INFO */
     int channel, wlength, sf, cm;
-    int result, isf, status, wext, nodelay, sf_out;
-    int n_read_bytes, used_bytes, wrote_bytes;
+    int result, isf, status, wext, nodelay, planar, spectrum, packet, nfrm, sf_out;
+    int max_nqus;
+    int loss, lost, nlost, stream, jitter, frm_pcm_bytes;
+    long data_pos;
+    unsigned int loss_seed;
+    int n_read_bytes, payload_bytes = 0, used_bytes, wrote_bytes;
     LDAC_DECODE_PARAM * pDecParam;
-    unsigned char    a_pcm_out[LDACBT_MAX_LSU*LDAC_PRCNCH*sizeof(int)];
+    unsigned char    *p_stream;
+    unsigned char    a_pcm_out[LDACBT_PKT_NFRM_MASK*LDACBT_MAX_LSU*LDAC_PRCNCH*sizeof(int)];
     unsigned char    a_stream[LDACBT_MAX_NBYTES+2];
+    int              a_planar[LDAC_PRCNCH*LDACBT_MAX_LSU];
+    unsigned char    a_payload[1+LDACBT_PKT_NFRM_MASK*LDACBT_MAX_NBYTES+2];
 
     /* Reset */
     status = 0;
     result = 0;
+    isf = 0;
+    nlost = 0;
+    max_nqus = 0;
     hData = NULL;
     fpi = fpo = NULL;
 #ifdef USE_LDACBT_SPEC_INFO
@@ -439,6 +673,12 @@ ldac_decode_proc(void *data)
     fmt =  pDecParam->fmt;
     wlength = pDecParam->wlen;
     nodelay = pDecParam->nodelay;
+    planar = pDecParam->planar;
+    spectrum = pDecParam->spectrum;
+    packet = pDecParam->packet;
+    loss = pDecParam->loss;
+    stream = pDecParam->stream;
+    jitter = pDecParam->jitter;
     in_file = pDecParam->pPathFileIn;
     out_file = pDecParam->pPathFileOut;
 
@@ -460,10 +700,27 @@ ldac_decode_proc(void *data)
         goto FINISH;
     }
 
+    /* Set Output Gain */
+    if (ldacBT_api_set_decode_gain( hData, 0, pDecParam->gain ) ||
+        ldacBT_api_set_decode_gain( hData, 1, pDecParam->gain )) {
+        fprintf(stderr, "[ERR] Setting output gain! Error code %s\n",
+            get_error_code_string(ldacBT_api_get_error_code(hData)));
+        status = -1;
+        goto FINISH;
+    }
+
+    /* Set Decoder Quality */
+    if (ldacBT_api_set_decode_quality( hData, pDecParam->quality, pDecParam->nqus )) {
+        fprintf(stderr, "[ERR] Setting decoder quality! Error code %s\n",
+            get_error_code_string(ldacBT_api_get_error_code(hData)));
+        status = -1;
+        goto FINISH;
+    }
+
 #ifdef USE_LDACBT_SPEC_INFO
 
     /* Initialize LDAC Handle as Decoder */
-    result = ldacBT_api_init_handle_decode( hData, cm, sf, 0, 0, 0 );
+    result = ldacBT_api_init_handle_decode( hData, cm, sf, pDecParam->nshift, 0, 0 );
     if (result) {
         fprintf(stderr, "[ERR] Initializing LDAC Handle for synthesis! Error code %s\n",
             get_error_code_string(ldacBT_api_get_error_code(hData)));
@@ -471,7 +728,7 @@ ldac_decode_proc(void *data)
         goto FINISH;
     }
 
-    sf_out = sf;
+    sf_out = SHIFT_SAMPLES(sf, pDecParam->nshift);
 
     /* Open PCM Audio Data File */
     if ((fpo = open_wavefile_write(out_file, fmt, channel, sf_out, wext)) == (FILE *)NULL) {
@@ -498,23 +755,66 @@ ldac_decode_proc(void *data)
 #endif /* USE_LDACBT_SPEC_INFO */
 
     /* Decoding */
-    isf = 0;
+    loss_seed = 1;
+    data_pos = ftell(fpi);
     while (1) {
-        /* For non-transport format (Read Maximum bytes at once ) */
-        n_read_bytes = fread(a_stream, sizeof(unsigned char), LDACBT_MAX_NBYTES, fpi);
-        if (n_read_bytes <= 0) {
-            break;
+        if (stream) {
+            /* Feed the bit stream in chunks of "stream" bytes */
+            n_read_bytes = fread(a_payload, sizeof(unsigned char), stream, fpi);
+            if (n_read_bytes <= 0) {
+                break;
+            }
+            p_stream = a_payload;
+            nfrm = 0;
+        }
+        else if (packet) {
+            /* Gather up to "packet" frames into one media payload */
+            n_read_bytes = fread(a_payload+1, sizeof(unsigned char), packet*LDACBT_MAX_NBYTES, fpi);
+            if (n_read_bytes <= 0) {
+                break;
+            }
+            memset(a_payload+1+n_read_bytes, 0, 2);
+            n_read_bytes++;
+            p_stream = a_payload + 1;
+            payload_bytes = 1;
+            nfrm = 0;
+            while ((nfrm < packet) && (payload_bytes+3 <= n_read_bytes) && (p_stream[0] == 0xAA)) {
+                int frmlen = get_ldac_frame_bytes(p_stream);
+                if (payload_bytes+frmlen > n_read_bytes) {
+                    break;
+                }
+                payload_bytes += frmlen;
+                p_stream += frmlen;
+                nfrm++;
+            }
+            if (nfrm == 0) {
+                /* let the decoder report the broken frame */
+                nfrm = 1;
+                payload_bytes = n_read_bytes;
+            }
+            a_payload[0] = (unsigned char)nfrm;
+            p_stream = a_payload + 1;
+        }
+        else {
+            /* For non-transport format (Read Maximum bytes at once ) */
+            n_read_bytes = fread(a_stream, sizeof(unsigned char), LDACBT_MAX_NBYTES, fpi);
+            if (n_read_bytes <= 0) {
+                break;
+            }
+            p_stream = a_stream;
+            payload_bytes = n_read_bytes;
+            nfrm = 1;
         }
 
 #ifndef USE_LDACBT_SPEC_INFO
         if (flgInit == 0) {
-            if (get_ldac_spec_info( a_stream, &sf, &cm, &channel ) < 0) {
+            if (get_ldac_spec_info( p_stream, &sf, &cm, &channel ) < 0) {
                 status = -1;
                 goto FINISH;
             }
 
             /* Initialize LDAC Handle as Decoder */
-            result = ldacBT_api_init_handle_decode( hData, cm, sf, 0, 0, 0 );
+            result = ldacBT_api_init_handle_decode( hData, cm, sf, pDecParam->nshift, 0, 0 );
             if (result) {
                 fprintf(stderr, "[ERR] Initializing LDAC Handle for synthesis! Error code %s\n",
                     get_error_code_string(ldacBT_api_get_error_code(hData)));
@@ -522,7 +822,7 @@ ldac_decode_proc(void *data)
                 goto FINISH;
             }
 
-            sf_out = sf;
+            sf_out = SHIFT_SAMPLES(sf, pDecParam->nshift);
 
             /* Open PCM Audio Data File */
             if ((fpo = open_wavefile_write(out_file, fmt, channel, sf_out, wext)) == (FILE *)NULL) {
@@ -551,11 +851,135 @@ ldac_decode_proc(void *data)
         }
 #endif /* USE_LDACBT_SPEC_INFO */
 
-        /* Decode Frame */
-        result = ldacBT_api_decode( hData, a_stream, a_pcm_out, fmt, n_read_bytes, &used_bytes,
-                                &wrote_bytes );
+        if (jitter >= 0) {
+            /* Simulate RTP Packet Arrivals through the Jitter Buffer */
+            fseek(fpi, data_pos, SEEK_SET);
+            status = ldac_jitter_proc( hData, fpi, fpo, pDecParam, sf, channel, &isf );
+            goto FINISH;
+        }
+        if (pDecParam->mix >= 0) {
+            /* Mix the Bit Stream with itself */
+            fseek(fpi, data_pos, SEEK_SET);
+            status = ldac_mix_proc( hData, fpi, fpo, pDecParam, sf, channel, &isf );
+            goto FINISH;
+        }
 
-        if (result) {
+        /* Simulate Packet Loss (deterministic pattern) */
+        lost = 0;
+        if ((loss > 0) && !stream) {
+            loss_seed = loss_seed * 1103515245 + 12345;
+            lost = (((loss_seed >> 16) % 100) < (unsigned int)loss) && (p_stream[0] == 0xAA);
+        }
+
+        if (stream) {
+            /* Decode Byte Stream */
+            frm_pcm_bytes = SHIFT_SAMPLES(sf > 2*48000 ? 512 : sf > 1*48000 ? 256 : 128,
+                                          pDecParam->nshift) * channel * wlength;
+            payload_bytes = 0;
+            do {
+                result = ldacBT_api_decode_stream( hData, a_payload+payload_bytes, a_pcm_out, fmt,
+                                                   n_read_bytes-payload_bytes, sizeof(a_pcm_out),
+                                                   &used_bytes, &wrote_bytes );
+                if (result) {
+                    int error_code;
+                    error_code = ldacBT_api_get_error_code( hData );
+                    fprintf(stderr, "<%d>[ERR] At %d-th su. error_code = %4d, %4d, %4d\n",
+                            pDecParam->ith, isf+nfrm, LDACBT_API_ERR(error_code),
+                            LDACBT_HANDLE_ERR(error_code), LDACBT_BLOCK_ERR(error_code));
+                    if( LDACBT_FATAL(error_code) ){
+                        status = -1;
+                        goto FINISH;
+                    }
+                }
+                if (wrote_bytes > 0) {
+                    int nskip = 0;
+                    if (nodelay && (isf+nfrm == 0)) {
+                        nskip = frm_pcm_bytes;
+                    }
+                    fwrite( a_pcm_out+nskip, sizeof(unsigned char), wrote_bytes-nskip, fpo);
+                    nfrm += wrote_bytes / frm_pcm_bytes;
+                }
+                payload_bytes += used_bytes;
+            } while ((payload_bytes < n_read_bytes) && (used_bytes > 0));
+            result = 0;
+            used_bytes = n_read_bytes;
+            wrote_bytes = 0;
+        }
+        else if (lost) {
+            /* Conceal Lost Frames */
+            used_bytes = packet ? payload_bytes : get_ldac_frame_bytes(a_stream);
+            result = ldacBT_api_decode_conceal( hData, a_pcm_out, fmt, nfrm, sizeof(a_pcm_out),
+                                                &wrote_bytes );
+            if (result) {
+                fprintf(stderr, "<%d>[ERR] At %d-th su. Concealment failed! Error code %s\n",
+                        pDecParam->ith, isf,
+                        get_error_code_string(ldacBT_api_get_error_code(hData)));
+                status = -1;
+                goto FINISH;
+            }
+            nlost += nfrm;
+        }
+        else if (packet) {
+            /* Decode Media Payload */
+            result = ldacBT_api_decode_packet( hData, a_payload, a_pcm_out, fmt, payload_bytes,
+                                               sizeof(a_pcm_out), &used_bytes, &wrote_bytes );
+            if (result) {
+                int error_code;
+                error_code = ldacBT_api_get_error_code( hData );
+                fprintf(stderr, "<%d>[ERR] At %d-th su. error_code = %4d, %4d, %4d"
+                        "PayloadHeader[%02x]\n", pDecParam->ith, isf,
+                        LDACBT_API_ERR(error_code), LDACBT_HANDLE_ERR(error_code),
+                        LDACBT_BLOCK_ERR(error_code), a_payload[0]);
+                if( LDACBT_FATAL(error_code) ){
+                    status = -1;
+                    goto FINISH;
+                }
+            }
+        }
+        else if (planar || spectrum) {
+            /* Decode Frame into Channel Buffers, and Interleave them here */
+            unsigned char *ap_planar[LDAC_PRCNCH];
+            int ich, ismpl, ib;
+            for (ich = 0; ich < LDAC_PRCNCH; ich++) {
+                ap_planar[ich] = (unsigned char *)(a_planar + ich * LDACBT_MAX_LSU);
+            }
+            if (spectrum) {
+                int a_idsf[LDAC_PRCNCH][LDACBT_MAX_NQUS], a_idwl[LDAC_PRCNCH][LDACBT_MAX_NQUS];
+                int *ap_idsf[LDAC_PRCNCH], *ap_idwl[LDAC_PRCNCH], a_nqus[LDAC_PRCNCH];
+                for (ich = 0; ich < LDAC_PRCNCH; ich++) {
+                    ap_idsf[ich] = a_idsf[ich];
+                    ap_idwl[ich] = a_idwl[ich];
+                    a_nqus[ich] = 0;
+                }
+                result = ldacBT_api_decode_spectrum( hData, a_stream, ap_planar, fmt, n_read_bytes,
+                                                     &used_bytes, &wrote_bytes,
+                                                     ap_idsf, ap_idwl, a_nqus );
+                for (ich = 0; ich < channel; ich++) {
+                    if (a_nqus[ich] > max_nqus) {
+                        max_nqus = a_nqus[ich];
+                    }
+                }
+            }
+            else {
+                result = ldacBT_api_decode_planar( hData, a_stream, ap_planar, fmt, n_read_bytes,
+                                                   &used_bytes, &wrote_bytes );
+            }
+            for (ismpl = 0; ismpl < wrote_bytes / wlength; ismpl++) {
+                for (ich = 0; ich < channel; ich++) {
+                    for (ib = 0; ib < wlength; ib++) {
+                        a_pcm_out[(ismpl*channel+ich)*wlength+ib] = ap_planar[ich][ismpl*wlength+ib];
+                    }
+                }
+            }
+            wrote_bytes *= channel;
+        }
+        else {
+            /* Decode Frame */
+            result = ldacBT_api_decode( hData, a_stream, a_pcm_out, fmt, n_read_bytes, &used_bytes,
+                                    &wrote_bytes );
+        }
+
+        if (result && !packet) {
             int error_code;
             error_code = ldacBT_api_get_error_code( hData );
             fprintf(stderr, "<%d>[ERR] At %d-th su. error_code = %4d, %4d, %4d"
@@ -569,7 +993,7 @@ ldac_decode_proc(void *data)
                 /* Recovery Process */
                 ldacBT_api_close_handle( hData );
                 /* Initialize LDAC Handle as Decoder */
-                if( ldacBT_api_init_handle_decode( hData, cm, sf, 0, 0, 0 ) < 0 ){
+                if( ldacBT_api_init_handle_decode( hData, cm, sf, pDecParam->nshift, 0, 0 ) < 0 ){
                     fprintf(stderr, "<%d>Error: Can not Get LDAC Handle!\n", pDecParam->ith);
                     status = -1;
                     goto FINISH;
@@ -632,7 +1056,7 @@ ldac_decode_proc(void *data)
                 else if(sf == 2*48000){ wrote_bytes = 256; }
                 else if(sf == 4*44100){ wrote_bytes = 512; }
                 else if(sf == 4*48000){ wrote_bytes = 512; }
-                wrote_bytes *= channel * wlength;
+                wrote_bytes = SHIFT_SAMPLES(wrote_bytes, pDecParam->nshift) * channel * wlength;
             }
         }
 
@@ -646,15 +1070,27 @@ ldac_decode_proc(void *data)
             if ( isf > 0 && wrote_bytes > 0) {
                 fwrite( a_pcm_out, sizeof(unsigned char), wrote_bytes, fpo);
             }
+            else if ( nfrm > 1 && wrote_bytes > 0) {
+                /* skip the delayed output of the first frame only */
+                fwrite( a_pcm_out + wrote_bytes/nfrm, sizeof(unsigned char),
+                        wrote_bytes - wrote_bytes/nfrm, fpo);
+            }
         }
 
         fseek(fpi, used_bytes-n_read_bytes, SEEK_CUR);
 
-        isf++;
+        isf += nfrm;
     }
 
 FINISH:
 
+    if (spectrum) {
+        fprintf(stderr, "<%d> Max Quantization Units : %d\n", pDecParam->ith, max_nqus);
+    }
+    if (loss > 0) {
+        fprintf(stderr, "<%d> Concealed Frames       : %d / %d\n", pDecParam->ith, nlost, isf);
+    }
+
     /* Close Files */
     if (fpi) fclose(fpi);
     if (fpo) fclose_wave_write(fpo);
@@ -827,6 +1263,277 @@ static int get_ldac_spec_info( unsigned char *p_stream, int *sf, int *cm, int *c
 }
 #endif /* USE_LDACBT_SPEC_INFO */
 
+/* Get the size of the LDAC frame including the frame header */
+static int get_ldac_frame_bytes( unsigned char *p_stream )
+{
+    return 3 + (((p_stream[1] & 0x07) << 6) | (p_stream[2] >> 2)) + 1;
+}
+
+/* The structure of a simulated RTP packet. */
+typedef struct _st_jitter_packet{
+    unsigned int arrival_us;
+    int offset;
+    int bytes;
+} JITTER_PACKET;
+
+static int compare_arrival( const void *p1, const void *p2 )
+{
+    const JITTER_PACKET *pPkt1 = (const JITTER_PACKET *)p1;
+    const JITTER_PACKET *pPkt2 = (const JITTER_PACKET *)p2;
+    if (pPkt1->arrival_us != pPkt2->arrival_us) {
+        return pPkt1->arrival_us < pPkt2->arrival_us ? -1 : 1;
+    }
+    return pPkt1->offset - pPkt2->offset;
+}
+
+/* Packetize the rest of the bit stream into RTP packets, let them arrive with random jitter,
+ * and play them out through the jitter buffer on the packet period clock.
+ */
+static int ldac_jitter_proc( HANDLE_LDAC_BT hData, FILE *fpi, FILE *fpo,
+                             LDAC_DECODE_PARAM *pDecParam, int sf, int channel, int *p_isf )
+{
+    unsigned char *p_data, *p_rtp;
+    JITTER_PACKET *p_pkt;
+    LDACBT_JB_STATS stats;
+    long data_pos, data_bytes;
+    long long ts, tick_samples;
+    unsigned int jitter_seed, first_us, tick_us;
+    int status, result, nfrm_pkt, frm_samples, frm_pcm_bytes, nskip;
+    int npkt, ipkt, pos, rtp_pos, nfrm, frmlen, wrote_bytes;
+    unsigned char a_pcm_out[LDACBT_PKT_NFRM_MASK*LDACBT_MAX_LSU*LDAC_PRCNCH*sizeof(int)];
+
+    status = 0;
+    p_data = p_rtp = NULL;
+    p_pkt = NULL;
+    nfrm_pkt = pDecParam->packet ? pDecParam->packet : 1;
+    frm_samples = sf > 2*48000 ? 512 : sf > 1*48000 ? 256 : 128;
+    frm_pcm_bytes = SHIFT_SAMPLES(frm_samples, pDecParam->nshift) * channel * pDecParam->wlen;
+
+    /* Read the rest of the bit stream */
+    data_pos = ftell(fpi);
+    fseek(fpi, 0, SEEK_END);
+    data_bytes = ftell(fpi) - data_pos;
+    fseek(fpi, data_pos, SEEK_SET);
+    p_data = (unsigned char *)malloc(data_bytes + 3);
+    p_rtp = (unsigned char *)malloc(data_bytes + (data_bytes / 3 + 1) * 13);
+    p_pkt = (JITTER_PACKET *)malloc((data_bytes / 3 + 1) * sizeof(JITTER_PACKET));
+    if ((p_data == NULL) || (p_rtp == NULL) || (p_pkt == NULL)) {
+        fprintf(stderr, "[ERR] malloc() for %ld bytes of bit stream.\n", data_bytes);
+        status = -1;
+        goto EXIT;
+    }
+    if (fread(p_data, sizeof(unsigned char), data_bytes, fpi) != (size_t)data_bytes) {
+        fprintf(stderr, "[ERR] Reading bit stream.\n");
+        status = -1;
+        goto EXIT;
+    }
+    memset(p_data + data_bytes, 0, 3);
+
+    /* Packetize */
+    jitter_seed = 1;
+    ts = 0;
+    npkt = 0;
+    pos = rtp_pos = 0;
+    while ((pos + 3 <= data_bytes) && (p_data[pos] == 0xAA)) {
+        unsigned char *p_hdr = p_rtp + rtp_pos;
+        p_hdr[0] = 0x80;
+        p_hdr[1] = 0x60;
+        p_hdr[2] = (unsigned char)(npkt >> 8);
+        p_hdr[3] = (unsigned char)npkt;
+        p_hdr[4] = (unsigned char)(ts >> 24);
+        p_hdr[5] = (unsigned char)(ts >> 16);
+        p_hdr[6] = (unsigned char)(ts >> 8);
+        p_hdr[7] = (unsigned char)ts;
+        memset(p_hdr+8, 0, 4);
+        p_pkt[npkt].offset = rtp_pos;
+        p_pkt[npkt].arrival_us = (unsigned int)(ts * 1000000 / sf);
+        jitter_seed = jitter_seed * 1103515245 + 12345;
+        p_pkt[npkt].arrival_us += (jitter_seed >> 8) % (pDecParam->jitter * 1000 + 1);
+        rtp_pos += 13;
+        for (nfrm = 0; (nfrm < nfrm_pkt) && (pos + 3 <= data_bytes) && (p_data[pos] == 0xAA); nfrm++) {
+            frmlen = get_ldac_frame_bytes(p_data + pos);
+            if (pos + frmlen > data_bytes) {
+                break;
+            }
+            memcpy(p_rtp + rtp_pos, p_data + pos, frmlen);
+            rtp_pos += frmlen;
+            pos += frmlen;
+        }
+        if (nfrm == 0) {
+            break;
+        }
+        p_hdr[12] = (unsigned char)nfrm;
+        p_pkt[npkt].bytes = rtp_pos - p_pkt[npkt].offset;
+        ts += nfrm * frm_samples;
+        npkt++;
+    }
+    if (npkt == 0) {
+        goto EXIT;
+    }
+    qsort(p_pkt, npkt, sizeof(JITTER_PACKET), compare_arrival);
+
+    result = ldacBT_api_jb_reset( hData, LDACBT_JB_MIN_DEPTH_DEFAULT, LDACBT_JB_MAX_DEPTH_DEFAULT );
+    if (result) {
+        fprintf(stderr, "<%d>[ERR] Resetting jitter buffer! Error code %s\n", pDecParam->ith,
+                get_error_code_string(ldacBT_api_get_error_code(hData)));
+        status = -1;
+        goto EXIT;
+    }
+
+    /* Play out on the packet period clock */
+    nskip = pDecParam->nodelay ? frm_pcm_bytes : 0;
+    first_us = p_pkt[0].arrival_us;
+    tick_samples = 0;
+    ipkt = 0;
+    while (1) {
+        tick_us = first_us + (unsigned int)(tick_samples * 1000000 / sf);
+        while ((ipkt < npkt) && (p_pkt[ipkt].arrival_us <= tick_us)) {
+            result = ldacBT_api_jb_put( hData, p_rtp + p_pkt[ipkt].offset, p_pkt[ipkt].bytes,
+                                        p_pkt[ipkt].arrival_us );
+            if (result) {
+                fprintf(stderr, "<%d>[ERR] Putting RTP packet! Error code %s\n", pDecParam->ith,
+                        get_error_code_string(ldacBT_api_get_error_code(hData)));
+                status = -1;
+                goto EXIT;
+            }
+            ipkt++;
+        }
+
+        result = ldacBT_api_jb_pull( hData, a_pcm_out, pDecParam->fmt, sizeof(a_pcm_out),
+                                     &wrote_bytes );
+        if (result) {
+            int error_code;
+            error_code = ldacBT_api_get_error_code( hData );
+            fprintf(stderr, "<%d>[ERR] At %d-th su. error_code = %4d, %4d, %4d\n",
+                    pDecParam->ith, *p_isf, LDACBT_API_ERR(error_code),
+                    LDACBT_HANDLE_ERR(error_code), LDACBT_BLOCK_ERR(error_code));
+            if( LDACBT_FATAL(error_code) ){
+                status = -1;
+                goto EXIT;
+            }
+        }
+        if (wrote_bytes > nskip) {
+            fwrite( a_pcm_out+nskip, sizeof(unsigned char), wrote_bytes-nskip, fpo);
+        }
+        if (wrote_bytes > 0) {
+            nskip = 0;
+            *p_isf += wrote_bytes / frm_pcm_bytes;
+        }
+
+        ldacBT_api_jb_get_stats( hData, &stats );
+        if ((ipkt >= npkt) && ((stats.depth == 0) || (wrote_bytes == 0))) {
+            break;
+        }
+        tick_samples += nfrm_pkt * frm_samples;
+    }
+
+    fprintf(stderr, "<%d> Jitter Buffer          : depth %d, target %d, jitter %d us\n",
+            pDecParam->ith, stats.depth, stats.target, stats.jitter);
+    fprintf(stderr, "<%d>  - Packets             : received %d, late %d, duplicate %d\n",
+            pDecParam->ith, stats.received, stats.late, stats.duplicate);
+    fprintf(stderr, "<%d>  - Playout             : lost %d, underrun %d, dropped %d\n",
+            pDecParam->ith, stats.lost, stats.underrun, stats.dropped);
+
+EXIT:
+    if (p_data) free(p_data);
+    if (p_rtp) free(p_rtp);
+    if (p_pkt) free(p_pkt);
+    return status;
+}
+
+/* Mix the rest of the bit stream with itself delayed by "mix" frames, in one decoder. */
+static int ldac_mix_proc( HANDLE_LDAC_BT hData, FILE *fpi, FILE *fpo,
+                          LDAC_DECODE_PARAM *pDecParam, int sf, int channel, int *p_isf )
+{
+    unsigned char *p_data;
+    int *p_offset;
+    long data_pos, data_bytes;
+    int status, result, nfrm, ifrm, nstrm, pos, frmlen, nskip, wrote_bytes;
+    unsigned char *ap_bs[2];
+    int a_bs_bytes[2], a_used_bytes[2];
+    unsigned char a_pcm_out[LDACBT_MAX_LSU*LDAC_PRCNCH*sizeof(int)];
+
+    status = 0;
+    p_offset = NULL;
+    nskip = 0;
+    if (pDecParam->nodelay) {
+        nskip = SHIFT_SAMPLES(sf > 2*48000 ? 512 : sf > 1*48000 ? 256 : 128, pDecParam->nshift)
+                * channel * pDecParam->wlen;
+    }
+
+    /* Read the rest of the bit stream */
+    data_pos = ftell(fpi);
+    fseek(fpi, 0, SEEK_END);
+    data_bytes = ftell(fpi) - data_pos;
+    fseek(fpi, data_pos, SEEK_SET);
+    p_data = (unsigned char *)malloc(data_bytes + 3);
+    p_offset = (int *)malloc((data_bytes / 3 + 1) * sizeof(int));
+    if ((p_data == NULL) || (p_offset == NULL)) {
+        fprintf(stderr, "[ERR] malloc() for %ld bytes of bit stream.\n", data_bytes);
+        status = -1;
+        goto EXIT;
+    }
+    if (fread(p_data, sizeof(unsigned char), data_bytes, fpi) != (size_t)data_bytes) {
+        fprintf(stderr, "[ERR] Reading bit stream.\n");
+        status = -1;
+        goto EXIT;
+    }
+    memset(p_data + data_bytes, 0, 3);
+
+    /* Find the frames */
+    nfrm = 0;
+    pos = 0;
+    while ((pos + 3 <= data_bytes) && (p_data[pos] == 0xAA)) {
+        frmlen = get_ldac_frame_bytes(p_data + pos);
+        if (pos + frmlen > data_bytes) {
+            break;
+        }
+        p_offset[nfrm++] = pos;
+        pos += frmlen;
+    }
+    p_offset[nfrm] = pos;
+
+    /* Decode the frames of both streams at a time */
+    for (ifrm = 0; ifrm < nfrm + pDecParam->mix; ifrm++) {
+        nstrm = 0;
+        if (ifrm < nfrm) {
+            ap_bs[nstrm] = p_data + p_offset[ifrm];
+            a_bs_bytes[nstrm] = p_offset[ifrm+1] - p_offset[ifrm];
+            nstrm++;
+        }
+        if (ifrm >= pDecParam->mix) {
+            ap_bs[nstrm] = p_data + p_offset[ifrm-pDecParam->mix];
+            a_bs_bytes[nstrm] = p_offset[ifrm-pDecParam->mix+1] - p_offset[ifrm-pDecParam->mix];
+            nstrm++;
+        }
+        result = ldacBT_api_decode_mix( hData, ap_bs, a_bs_bytes, nstrm, a_pcm_out, pDecParam->fmt,
+                                        a_used_bytes, &wrote_bytes );
+        if (result) {
+            int error_code;
+            error_code = ldacBT_api_get_error_code( hData );
+            fprintf(stderr, "<%d>[ERR] At %d-th su. error_code = %4d, %4d, %4d\n",
+                    pDecParam->ith, *p_isf, LDACBT_API_ERR(error_code),
+                    LDACBT_HANDLE_ERR(error_code), LDACBT_BLOCK_ERR(error_code));
+            if( LDACBT_FATAL(error_code) ){
+                status = -1;
+                goto EXIT;
+            }
+        }
+        if (wrote_bytes > nskip) {
+            fwrite( a_pcm_out+nskip, sizeof(unsigned char), wrote_bytes-nskip, fpo);
+        }
+        if (wrote_bytes > 0) {
+            nskip = 0;
+        }
+        ++*p_isf;
+    }
+
+EXIT:
+    if (p_data) free(p_data);
+    if (p_offset) free(p_offset);
+    return status;
+}
+
 
 
 
@@ -1248,6 +1955,8 @@ static const char * ldac_ErrCode2Str( int ErrCode )
         CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_GRADPAR_D);
         CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_NBANDS);
         CASE_RETURN_STR(LDACBT_ERR_PACK_BLOCK_FAILED);
+        CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_COMPLEXITY);
+        CASE_RETURN_STR(LDACBT_ERR_ENC_ILL_PACKMODE);
         CASE_RETURN_STR(LDACBT_ERR_DEC_INIT_ALLOC);
         CASE_RETURN_STR(LDACBT_ERR_INPUT_BUFFER_SIZE);
         CASE_RETURN_STR(LDACBT_ERR_UNPACK_BLOCK_FAILED);